@@ -0,0 +1,187 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "LinkFraming.h"
+
+#include <algorithm>
+
+namespace
+{
+const uint8_t START1 = 0x05;
+const uint8_t START2 = 0x64;
+const uint8_t HEADER_SIZE = 10;
+const uint8_t BLOCK_SIZE = 16;
+const uint8_t MIN_LENGTH = 5;
+
+std::array<uint16_t, 256> CreateCRCTable()
+{
+    std::array<uint16_t, 256> table{};
+
+    for (uint16_t i = 0; i < 256; ++i)
+    {
+        uint16_t crc = i;
+        for (int j = 0; j < 8; ++j)
+        {
+            crc = (crc & 0x0001) ? static_cast<uint16_t>((crc >> 1) ^ 0xA6BC) : static_cast<uint16_t>(crc >> 1);
+        }
+        table[i] = crc;
+    }
+
+    return table;
+}
+
+void WriteCRC(std::vector<uint8_t>& out, const uint8_t* data, size_t length)
+{
+    const auto crc = LinkFraming::CalcCRC(data, length);
+    out.push_back(static_cast<uint8_t>(crc & 0xFF));
+    out.push_back(static_cast<uint8_t>(crc >> 8));
+}
+
+bool IsCRCValid(const uint8_t* data, size_t length)
+{
+    const auto crc = LinkFraming::CalcCRC(data, length);
+    return data[length] == static_cast<uint8_t>(crc & 0xFF) && data[length + 1] == static_cast<uint8_t>(crc >> 8);
+}
+
+uint16_t ReadUInt16(const uint8_t* data)
+{
+    return static_cast<uint16_t>(data[0] | (data[1] << 8));
+}
+} // namespace
+
+uint16_t LinkFraming::CalcCRC(const uint8_t* data, size_t length)
+{
+    static const auto table = CreateCRCTable();
+
+    uint16_t crc = 0;
+    for (size_t i = 0; i < length; ++i)
+    {
+        crc = static_cast<uint16_t>((crc >> 8) ^ table[(crc ^ data[i]) & 0xFF]);
+    }
+
+    return static_cast<uint16_t>(~crc);
+}
+
+void LinkFraming::Write(std::vector<uint8_t>& out,
+                        opendnp3::LinkFunction function,
+                        uint16_t dest,
+                        uint16_t src,
+                        const uint8_t* data,
+                        uint8_t length)
+{
+    const auto start = out.size();
+
+    // DIR is clear in the function codes, which is what an outstation sends
+    out.push_back(START1);
+    out.push_back(START2);
+    out.push_back(static_cast<uint8_t>(MIN_LENGTH + length));
+    out.push_back(opendnp3::LinkFunctionSpec::to_type(function));
+    out.push_back(static_cast<uint8_t>(dest & 0xFF));
+    out.push_back(static_cast<uint8_t>(dest >> 8));
+    out.push_back(static_cast<uint8_t>(src & 0xFF));
+    out.push_back(static_cast<uint8_t>(src >> 8));
+    WriteCRC(out, out.data() + start, HEADER_SIZE - 2);
+
+    for (uint16_t pos = 0; pos < length; pos += BLOCK_SIZE)
+    {
+        const auto size = std::min<uint16_t>(BLOCK_SIZE, length - pos);
+        out.insert(out.end(), data + pos, data + pos + size);
+        WriteCRC(out, data + pos, size);
+    }
+}
+
+uint16_t LinkFraming::GetFrameSize(const uint8_t* header)
+{
+    const auto length = header[2] - MIN_LENGTH;
+    return static_cast<uint16_t>(HEADER_SIZE + length + 2 * ((length + BLOCK_SIZE - 1) / BLOCK_SIZE));
+}
+
+void LinkFrameParser::Append(const uint8_t* data, size_t length)
+{
+    if (this->begin > 0)
+    {
+        this->buffer.erase(this->buffer.begin(), this->buffer.begin() + this->begin);
+        this->begin = 0;
+    }
+
+    this->buffer.insert(this->buffer.end(), data, data + length);
+}
+
+bool LinkFrameParser::Next(Frame& frame)
+{
+    while (this->buffer.size() - this->begin >= HEADER_SIZE)
+    {
+        const auto header = this->buffer.data() + this->begin;
+
+        if (header[0] != START1 || header[1] != START2 || header[2] < MIN_LENGTH
+            || !IsCRCValid(header, HEADER_SIZE - 2))
+        {
+            ++this->begin;
+            continue;
+        }
+
+        const auto size = LinkFraming::GetFrameSize(header);
+        if (this->buffer.size() - this->begin < size)
+        {
+            return false;
+        }
+
+        if (this->TryRead(header, frame))
+        {
+            this->begin += size;
+            return true;
+        }
+
+        ++this->begin;
+    }
+
+    return false;
+}
+
+void LinkFrameParser::Reset()
+{
+    this->buffer.clear();
+    this->begin = 0;
+}
+
+bool LinkFrameParser::TryRead(const uint8_t* frame, Frame& result)
+{
+    const auto length = static_cast<uint8_t>(frame[2] - MIN_LENGTH);
+
+    auto block = frame + HEADER_SIZE;
+    for (uint16_t pos = 0; pos < length; pos += BLOCK_SIZE)
+    {
+        const auto size = std::min<uint16_t>(BLOCK_SIZE, length - pos);
+        if (!IsCRCValid(block, size))
+        {
+            return false;
+        }
+
+        std::copy(block, block + size, this->userData.begin() + pos);
+        block += size + 2;
+    }
+
+    result.control = frame[3];
+    result.dest = ReadUInt16(frame + 4);
+    result.src = ReadUInt16(frame + 6);
+    result.data = this->userData.data();
+    result.length = length;
+
+    return true;
+}
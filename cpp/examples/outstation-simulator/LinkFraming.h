@@ -0,0 +1,83 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_LINKFRAMING_H
+#define OPENDNP3_LINKFRAMING_H
+
+#include <opendnp3/gen/LinkFunction.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Minimal DNP3 link layer framing for the simulator: CRCs, frame formatting and a stream parser.
+ */
+namespace LinkFraming
+{
+const uint8_t MAX_USER_DATA_SIZE = 250;
+const uint16_t MAX_FRAME_SIZE = 292;
+
+uint16_t CalcCRC(const uint8_t* data, size_t length);
+
+// appends a frame sent by an outstation to 'out'
+void Write(std::vector<uint8_t>& out,
+           opendnp3::LinkFunction function,
+           uint16_t dest,
+           uint16_t src,
+           const uint8_t* data,
+           uint8_t length);
+
+// total length of the frame that starts at 'header', which must hold at least the length byte
+uint16_t GetFrameSize(const uint8_t* header);
+} // namespace LinkFraming
+
+/**
+ * Extracts the frames with valid CRCs from a stream of bytes, skipping anything else.
+ */
+class LinkFrameParser final
+{
+public:
+    struct Frame
+    {
+        uint8_t control;
+        uint16_t dest;
+        uint16_t src;
+        const uint8_t* data;
+        uint8_t length;
+    };
+
+    void Append(const uint8_t* data, size_t length);
+
+    // the frame's data is valid until the next call
+    bool Next(Frame& frame);
+
+    void Reset();
+
+private:
+    bool TryRead(const uint8_t* frame, Frame& result);
+
+    std::vector<uint8_t> buffer;
+    size_t begin = 0;
+
+    std::array<uint8_t, LinkFraming::MAX_USER_DATA_SIZE> userData;
+};
+
+#endif
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "OutstationSimulator.h"
+
+#include "SimulatorChannel.h"
+
+#include <stdexcept>
+
+namespace
+{
+const uint16_t MAX_LINK_ADDRESS = 0xFFEF;
+} // namespace
+
+OutstationSimulator::OutstationSimulator(const SimulatorSettings& settings) : settings(settings), model(settings)
+{
+    if (settings.numChannels == 0 || settings.numThreads == 0 || settings.tickPeriod.count() <= 0)
+    {
+        throw std::invalid_argument("at least one channel, one thread and a positive tick period are required");
+    }
+
+    // outstation i is served by channel i % numChannels, on address base + i / numChannels
+    const auto outstationsPerChannel = (settings.numOutstations + settings.numChannels - 1) / settings.numChannels;
+    const auto lastAddress = static_cast<uint32_t>(settings.baseOutstationAddress) + outstationsPerChannel - 1;
+    if (lastAddress > MAX_LINK_ADDRESS)
+    {
+        throw std::invalid_argument("not enough link addresses, use more channels");
+    }
+
+    if (settings.masterAddress >= settings.baseOutstationAddress && settings.masterAddress <= lastAddress)
+    {
+        throw std::invalid_argument("the master address overlaps the outstation addresses");
+    }
+
+    for (uint16_t i = 0; i < settings.numChannels; ++i)
+    {
+        const auto numOutstations = static_cast<uint16_t>(settings.numOutstations / settings.numChannels
+                                                          + (i < settings.numOutstations % settings.numChannels));
+
+        this->channels.push_back(std::make_shared<SimulatorChannel>(
+            this->context, this->model, this->settings, static_cast<uint16_t>(settings.basePort + i), numOutstations,
+            i + 1, this->numEventsInjected, this->numEventsConfirmed));
+    }
+}
+
+OutstationSimulator::~OutstationSimulator()
+{
+    this->Stop();
+}
+
+void OutstationSimulator::Start()
+{
+    if (this->running.exchange(true))
+        return;
+
+    for (auto& channel : this->channels)
+    {
+        channel->Start();
+    }
+
+    this->work = std::make_unique<asio::executor_work_guard<asio::io_context::executor_type>>(
+        this->context.get_executor());
+
+    for (uint32_t i = 0; i < this->settings.numThreads; ++i)
+    {
+        this->threads.emplace_back([this]() { this->context.run(); });
+    }
+}
+
+void OutstationSimulator::Stop()
+{
+    if (!this->running.exchange(false))
+        return;
+
+    for (auto& channel : this->channels)
+    {
+        channel->Shutdown();
+    }
+
+    // the threads return once the channels' handlers have all completed
+    this->work.reset();
+
+    for (auto& thread : this->threads)
+    {
+        thread.join();
+    }
+
+    this->threads.clear();
+}
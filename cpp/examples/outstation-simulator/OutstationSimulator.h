@@ -0,0 +1,86 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_OUTSTATIONSIMULATOR_H
+#define OPENDNP3_OUTSTATIONSIMULATOR_H
+
+#include "SimulatedOutstations.h"
+#include "SimulatorSettings.h"
+
+#include <opendnp3/util/Uncopyable.h>
+
+#include <asio.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+class SimulatorChannel;
+
+/**
+ * Serves many simulated outstations for load testing a master.
+ *
+ * The outstations aren't outstation stacks. They all share one immutable PointModel, and each one only keeps a
+ * few bytes of state, a slice of its channel's value arrays and an event ring (see SimulatedOutstations). Each
+ * channel serves its outstations on consecutive link addresses of one port, and runs both its network handlers and
+ * its value generation on its own strand, so a few threads drive all of them.
+ */
+class OutstationSimulator final : private opendnp3::Uncopyable
+{
+public:
+    explicit OutstationSimulator(const SimulatorSettings& settings);
+
+    ~OutstationSimulator();
+
+    void Start();
+
+    // the simulator can't be started again once stopped
+    void Stop();
+
+    uint64_t GetNumEventsInjected() const
+    {
+        return numEventsInjected.load(std::memory_order_relaxed);
+    }
+
+    // events the master confirmed, in solicited or unsolicited responses
+    uint64_t GetNumEventsConfirmed() const
+    {
+        return numEventsConfirmed.load(std::memory_order_relaxed);
+    }
+
+private:
+    const SimulatorSettings settings;
+
+    // shared by every outstation
+    const PointModel model;
+
+    asio::io_context context;
+    std::unique_ptr<asio::executor_work_guard<asio::io_context::executor_type>> work;
+
+    std::vector<std::shared_ptr<SimulatorChannel>> channels;
+    std::vector<std::thread> threads;
+
+    std::atomic<bool> running{false};
+    std::atomic<uint64_t> numEventsInjected{0};
+    std::atomic<uint64_t> numEventsConfirmed{0};
+};
+
+#endif
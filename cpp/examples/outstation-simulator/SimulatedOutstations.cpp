@@ -0,0 +1,835 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "SimulatedOutstations.h"
+
+#include "LinkFraming.h"
+
+#include <opendnp3/gen/LinkFunction.h>
+#include <opendnp3/gen/QualifierCode.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+using namespace opendnp3;
+
+namespace
+{
+const uint8_t TRANSPORT_FIN = 0x80;
+const uint8_t TRANSPORT_FIR = 0x40;
+const uint8_t TRANSPORT_SEQ = 0x3F;
+const size_t MAX_SEGMENT_PAYLOAD = LinkFraming::MAX_USER_DATA_SIZE - 1;
+
+const uint8_t APP_FIR = 0x80;
+const uint8_t APP_FIN = 0x40;
+const uint8_t APP_CON = 0x20;
+const uint8_t APP_UNS = 0x10;
+const uint8_t APP_SEQ = 0x0F;
+const size_t APP_HEADER_SIZE = 4;
+
+// group, variation, qualifier, start and stop
+const size_t STATIC_HEADER_SIZE = 7;
+// group, variation, qualifier and count, each event is prefixed by its index
+const size_t EVENT_HEADER_SIZE = 5;
+const size_t EVENT_INDEX_SIZE = 2;
+
+const uint8_t ONLINE = 0x01;
+const uint8_t BINARY_STATE = 0x80;
+
+// the only IIN bit a master may write, to clear the restart bit
+const uint16_t RESTART_IIN_INDEX = 7;
+
+uint32_t Next(uint32_t& state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+// advances one xorshift32 generator per value and moves the value by up to +/- step
+void Walk(float* values, uint32_t* states, size_t count, float step)
+{
+    const auto scale = step / 2147483648.0f;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto x = states[i];
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        states[i] = x;
+        values[i] += scale * static_cast<float>(static_cast<int32_t>(x));
+    }
+}
+
+uint32_t ToBits(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+void WriteUInt16(std::vector<uint8_t>& out, uint16_t value)
+{
+    out.push_back(static_cast<uint8_t>(value & 0xFF));
+    out.push_back(static_cast<uint8_t>(value >> 8));
+}
+
+void WriteUInt32(std::vector<uint8_t>& out, uint32_t value)
+{
+    WriteUInt16(out, static_cast<uint16_t>(value & 0xFFFF));
+    WriteUInt16(out, static_cast<uint16_t>(value >> 16));
+}
+
+void WriteHeader(std::vector<uint8_t>& out, GroupVariation variation, QualifierCode qualifier)
+{
+    const auto id = GroupVariationSpec::to_type(variation);
+    out.push_back(static_cast<uint8_t>(id >> 8));
+    out.push_back(static_cast<uint8_t>(id & 0xFF));
+    out.push_back(QualifierCodeSpec::to_type(qualifier));
+}
+
+IINBit GetClassBit(PointClass clazz)
+{
+    switch (clazz)
+    {
+    case (PointClass::Class1):
+        return IINBit::CLASS1_EVENTS;
+    case (PointClass::Class2):
+        return IINBit::CLASS2_EVENTS;
+    default:
+        return IINBit::CLASS3_EVENTS;
+    }
+}
+
+// reads the object headers of a request, only the qualifiers used by masters to poll are supported
+class HeaderReader
+{
+public:
+    struct Header
+    {
+        GroupVariation variation;
+        QualifierCode qualifier;
+        uint16_t start;
+        uint16_t stop;
+    };
+
+    HeaderReader(const uint8_t* data, size_t length) : pos(data), end(data + length) {}
+
+    // false once every header is read, or when the request is malformed (see IsValid)
+    bool Next(Header& header)
+    {
+        if (!this->valid || this->pos == this->end)
+            return false;
+
+        if (this->Remaining() < 3)
+            return this->Fail();
+
+        header.variation = GroupVariationSpec::from_type(static_cast<uint16_t>((pos[0] << 8) | pos[1]));
+        header.qualifier = QualifierCodeSpec::from_type(pos[2]);
+        this->pos += 3;
+
+        switch (header.qualifier)
+        {
+        case (QualifierCode::ALL_OBJECTS):
+            header.start = header.stop = 0;
+            return true;
+        case (QualifierCode::UINT8_START_STOP):
+            if (this->Remaining() < 2)
+                return this->Fail();
+            header.start = pos[0];
+            header.stop = pos[1];
+            this->pos += 2;
+            break;
+        case (QualifierCode::UINT16_START_STOP):
+            if (this->Remaining() < 4)
+                return this->Fail();
+            header.start = static_cast<uint16_t>(pos[0] | (pos[1] << 8));
+            header.stop = static_cast<uint16_t>(pos[2] | (pos[3] << 8));
+            this->pos += 4;
+            break;
+        default:
+            return this->Fail();
+        }
+
+        return (header.start <= header.stop) || this->Fail();
+    }
+
+    // object data following the last header, or nullptr if the request is too short
+    const uint8_t* Read(size_t count)
+    {
+        if (this->Remaining() < count)
+        {
+            this->Fail();
+            return nullptr;
+        }
+
+        const auto data = this->pos;
+        this->pos += count;
+        return data;
+    }
+
+    bool IsValid() const
+    {
+        return this->valid;
+    }
+
+private:
+    size_t Remaining() const
+    {
+        return static_cast<size_t>(this->end - this->pos);
+    }
+
+    bool Fail()
+    {
+        this->valid = false;
+        return false;
+    }
+
+    const uint8_t* pos;
+    const uint8_t* const end;
+    bool valid = true;
+};
+} // namespace
+
+PointModel::PointModel(const SimulatorSettings& settings)
+    : pointsPerType(settings.pointsPerType),
+      eventCapacity(settings.eventCapacity),
+      maxFragmentSize(settings.maxFragmentSize),
+      types{{
+          {GroupVariation::Group1Var2, GroupVariation::Group2Var1, PointClass::Class1, 1, 1},
+          {GroupVariation::Group20Var1, GroupVariation::Group22Var1, PointClass::Class3, 5, 5},
+          {GroupVariation::Group30Var5, GroupVariation::Group32Var5, PointClass::Class2, 5, 5},
+      }}
+{
+    if (this->pointsPerType == 0 || this->eventCapacity == 0)
+    {
+        throw std::invalid_argument("at least one point and one event per outstation are required");
+    }
+
+    size_t size = APP_HEADER_SIZE;
+    for (uint8_t type = 0; type < NUM_TYPES; ++type)
+    {
+        size += this->GetStaticSize(static_cast<Type>(type));
+    }
+
+    if (size > this->maxFragmentSize)
+    {
+        throw std::invalid_argument("static data doesn't fit in one fragment, use fewer points or larger fragments");
+    }
+}
+
+size_t PointModel::GetStaticSize(Type type) const
+{
+    return STATIC_HEADER_SIZE + static_cast<size_t>(this->pointsPerType) * this->Get(type).staticSize;
+}
+
+SimulatedOutstations::SimulatedOutstations(const PointModel& model,
+                                           const SimulatorSettings& settings,
+                                           uint16_t firstAddress,
+                                           uint16_t count,
+                                           uint32_t seed)
+    : model(model),
+      settings(settings),
+      firstAddress(firstAddress),
+      confirmTimeoutTicks(static_cast<uint32_t>(
+          std::max<int64_t>(1, settings.confirmTimeout.count() / std::max<int64_t>(1, settings.tickPeriod.count())))),
+      pickState(seed),
+      outstations(count),
+      analogs(static_cast<size_t>(count) * model.pointsPerType, 0.0f),
+      counters(analogs.size(), 0),
+      binaries(analogs.size(), 0),
+      walkState(analogs.size()),
+      events(static_cast<size_t>(count) * model.eventCapacity)
+{
+    // xorshift must not start at zero, and never returns to it
+    if (this->pickState == 0)
+    {
+        this->pickState = 1;
+    }
+
+    for (auto& state : this->walkState)
+    {
+        state = Next(this->pickState);
+    }
+
+    this->fragment.reserve(model.maxFragmentSize);
+}
+
+uint64_t SimulatedOutstations::OnUserData(uint16_t address,
+                                          const uint8_t* data,
+                                          size_t length,
+                                          std::vector<uint8_t>& tx)
+{
+    const uint8_t SINGLE_SEGMENT = TRANSPORT_FIR | TRANSPORT_FIN;
+
+    if (length < 1 || (data[0] & SINGLE_SEGMENT) != SINGLE_SEGMENT)
+        return 0;
+
+    const size_t i = address - this->firstAddress;
+
+    // events are only injected by ticks, so any that a request removes were confirmed
+    const auto numEvents = this->outstations[i].numEvents;
+
+    if (this->OnRequest(i, data + 1, length - 1))
+    {
+        this->SendResponse(i, tx);
+    }
+
+    return static_cast<uint64_t>(numEvents - this->outstations[i].numEvents);
+}
+
+uint64_t SimulatedOutstations::Tick(double seconds, bool online, std::vector<uint8_t>& tx)
+{
+    ++this->tick;
+
+    Walk(this->analogs.data(), this->walkState.data(), this->analogs.size(), this->settings.analogStep);
+
+    const auto expected = static_cast<float>(this->settings.eventsPerSecond * seconds);
+
+    uint64_t numEvents = 0;
+
+    for (size_t i = 0; i < this->outstations.size(); ++i)
+    {
+        auto& outstation = this->outstations[i];
+
+        outstation.pendingEvents += expected;
+        const auto count = static_cast<uint32_t>(outstation.pendingEvents);
+        outstation.pendingEvents -= static_cast<float>(count);
+
+        for (uint32_t j = 0; j < count; ++j)
+        {
+            this->InjectEvent(i);
+        }
+
+        numEvents += count;
+
+        if (!online)
+            continue;
+
+        if (outstation.confirm != Confirm::None && static_cast<int32_t>(this->tick - outstation.confirmDeadline) >= 0)
+        {
+            // the events are reported again, an unsolicited response with the same sequence number
+            this->Unselect(i);
+            outstation.confirm = Confirm::None;
+        }
+
+        if (outstation.confirm == Confirm::None && this->HasEvents(i, outstation.unsolClasses))
+        {
+            this->BeginResponse(FunctionCode::UNSOLICITED_RESPONSE,
+                                APP_FIR | APP_FIN | APP_CON | APP_UNS | outstation.unsolSeq);
+            this->WriteEvents(i, outstation.unsolClasses, this->model.maxFragmentSize);
+            this->EndResponse(i, IINField::Empty());
+
+            outstation.confirm = Confirm::Unsolicited;
+            outstation.confirmDeadline = this->tick + this->confirmTimeoutTicks;
+
+            this->SendResponse(i, tx);
+        }
+    }
+
+    return numEvents;
+}
+
+void SimulatedOutstations::OnConnectionClosed()
+{
+    for (size_t i = 0; i < this->outstations.size(); ++i)
+    {
+        if (this->outstations[i].confirm != Confirm::None)
+        {
+            this->Unselect(i);
+            this->outstations[i].confirm = Confirm::None;
+        }
+    }
+}
+
+bool SimulatedOutstations::OnRequest(size_t i, const uint8_t* apdu, size_t length)
+{
+    if (length < 2 || (apdu[0] & (APP_FIR | APP_FIN)) != (APP_FIR | APP_FIN))
+        return false;
+
+    const auto control = apdu[0];
+    const auto seq = static_cast<uint8_t>(control & APP_SEQ);
+    const auto objects = apdu + 2;
+    const auto size = length - 2;
+
+    const auto function = FunctionCodeSpec::from_type(apdu[1]);
+    switch (function)
+    {
+    case (FunctionCode::CONFIRM):
+        this->OnConfirm(i, control);
+        return false;
+    case (FunctionCode::READ):
+        this->OnRead(i, seq, objects, size);
+        return true;
+    case (FunctionCode::WRITE):
+        this->BeginResponse(FunctionCode::RESPONSE, APP_FIR | APP_FIN | seq);
+        this->EndResponse(i, this->OnWrite(i, objects, size));
+        return true;
+    case (FunctionCode::ENABLE_UNSOLICITED):
+    case (FunctionCode::DISABLE_UNSOLICITED):
+        this->BeginResponse(FunctionCode::RESPONSE, APP_FIR | APP_FIN | seq);
+        this->EndResponse(i,
+                          this->OnUnsolicitedControl(i, function == FunctionCode::ENABLE_UNSOLICITED, objects, size));
+        return true;
+    default:
+        this->BeginResponse(FunctionCode::RESPONSE, APP_FIR | APP_FIN | seq);
+        this->EndResponse(i, IINField(IINBit::FUNC_NOT_SUPPORTED));
+        return true;
+    }
+}
+
+void SimulatedOutstations::OnConfirm(size_t i, uint8_t control)
+{
+    auto& outstation = this->outstations[i];
+
+    const bool unsolicited = (control & APP_UNS) != 0;
+    const auto expected = unsolicited ? Confirm::Unsolicited : Confirm::Solicited;
+    const auto expectedSeq = unsolicited ? outstation.unsolSeq : outstation.confirmSeq;
+
+    if (outstation.confirm != expected || (control & APP_SEQ) != expectedSeq)
+        return;
+
+    this->RemoveSelected(i);
+    outstation.confirm = Confirm::None;
+
+    if (unsolicited)
+    {
+        outstation.unsolSeq = static_cast<uint8_t>((outstation.unsolSeq + 1) & APP_SEQ);
+    }
+}
+
+void SimulatedOutstations::OnRead(size_t i, uint8_t seq, const uint8_t* objects, size_t length)
+{
+    ClassField classes;
+    std::array<bool, PointModel::NUM_TYPES> staticTypes{};
+    IINField errors;
+
+    HeaderReader reader(objects, length);
+    HeaderReader::Header header;
+    while (reader.Next(header))
+    {
+        if (header.qualifier != QualifierCode::ALL_OBJECTS)
+        {
+            errors.SetBit(IINBit::PARAM_ERROR);
+            continue;
+        }
+
+        switch (header.variation)
+        {
+        case (GroupVariation::Group60Var1):
+            staticTypes.fill(true);
+            break;
+        case (GroupVariation::Group60Var2):
+            classes.Set(PointClass::Class1);
+            break;
+        case (GroupVariation::Group60Var3):
+            classes.Set(PointClass::Class2);
+            break;
+        case (GroupVariation::Group60Var4):
+            classes.Set(PointClass::Class3);
+            break;
+        case (GroupVariation::Group1Var0):
+        case (GroupVariation::Group1Var2):
+            staticTypes[static_cast<uint8_t>(PointModel::Type::Binary)] = true;
+            break;
+        case (GroupVariation::Group20Var0):
+        case (GroupVariation::Group20Var1):
+            staticTypes[static_cast<uint8_t>(PointModel::Type::Counter)] = true;
+            break;
+        case (GroupVariation::Group30Var0):
+        case (GroupVariation::Group30Var5):
+            staticTypes[static_cast<uint8_t>(PointModel::Type::Analog)] = true;
+            break;
+        default:
+            errors.SetBit(IINBit::OBJECT_UNKNOWN);
+            break;
+        }
+    }
+
+    if (!reader.IsValid())
+    {
+        errors.SetBit(IINBit::PARAM_ERROR);
+    }
+
+    auto& outstation = this->outstations[i];
+
+    this->BeginResponse(FunctionCode::RESPONSE, APP_FIR | APP_FIN | seq);
+
+    // a new read replaces a solicited response that was never confirmed
+    if (outstation.confirm == Confirm::Solicited)
+    {
+        this->Unselect(i);
+        outstation.confirm = Confirm::None;
+    }
+
+    // events wait while an unsolicited response is awaiting confirmation
+    if (classes.HasEventClass() && outstation.confirm == Confirm::None)
+    {
+        size_t staticSize = 0;
+        for (uint8_t type = 0; type < PointModel::NUM_TYPES; ++type)
+        {
+            if (staticTypes[type])
+            {
+                staticSize += this->model.GetStaticSize(static_cast<PointModel::Type>(type));
+            }
+        }
+
+        if (this->WriteEvents(i, classes, this->model.maxFragmentSize - staticSize) > 0)
+        {
+            this->fragment[0] |= APP_CON;
+            outstation.confirm = Confirm::Solicited;
+            outstation.confirmSeq = seq;
+            outstation.confirmDeadline = this->tick + this->confirmTimeoutTicks;
+        }
+    }
+
+    for (uint8_t type = 0; type < PointModel::NUM_TYPES; ++type)
+    {
+        if (staticTypes[type])
+        {
+            this->WriteStatic(i, static_cast<PointModel::Type>(type));
+        }
+    }
+
+    this->EndResponse(i, errors);
+}
+
+IINField SimulatedOutstations::OnWrite(size_t i, const uint8_t* objects, size_t length)
+{
+    IINField errors;
+
+    HeaderReader reader(objects, length);
+    HeaderReader::Header header;
+    while (reader.Next(header))
+    {
+        if (header.variation != GroupVariation::Group80Var1 || header.qualifier == QualifierCode::ALL_OBJECTS)
+        {
+            // the size of unknown objects isn't known, so nothing after them can be read
+            errors.SetBit(IINBit::OBJECT_UNKNOWN);
+            return errors;
+        }
+
+        const auto bits = reader.Read((header.stop - header.start + 8) / 8);
+        if (!bits)
+            break;
+
+        if (header.start != RESTART_IIN_INDEX || header.stop != RESTART_IIN_INDEX || (bits[0] & 0x01))
+        {
+            errors.SetBit(IINBit::PARAM_ERROR);
+            continue;
+        }
+
+        this->outstations[i].iin.ClearBit(IINBit::DEVICE_RESTART);
+    }
+
+    if (!reader.IsValid())
+    {
+        errors.SetBit(IINBit::PARAM_ERROR);
+    }
+
+    return errors;
+}
+
+IINField SimulatedOutstations::OnUnsolicitedControl(size_t i, bool enable, const uint8_t* objects, size_t length)
+{
+    if (!this->settings.allowUnsolicited)
+    {
+        return IINField(IINBit::FUNC_NOT_SUPPORTED);
+    }
+
+    ClassField classes;
+    IINField errors;
+
+    HeaderReader reader(objects, length);
+    HeaderReader::Header header;
+    while (reader.Next(header))
+    {
+        if (header.qualifier != QualifierCode::ALL_OBJECTS)
+        {
+            errors.SetBit(IINBit::PARAM_ERROR);
+            continue;
+        }
+
+        switch (header.variation)
+        {
+        case (GroupVariation::Group60Var2):
+            classes.Set(PointClass::Class1);
+            break;
+        case (GroupVariation::Group60Var3):
+            classes.Set(PointClass::Class2);
+            break;
+        case (GroupVariation::Group60Var4):
+            classes.Set(PointClass::Class3);
+            break;
+        default:
+            errors.SetBit(IINBit::OBJECT_UNKNOWN);
+            break;
+        }
+    }
+
+    if (!reader.IsValid())
+    {
+        errors.SetBit(IINBit::PARAM_ERROR);
+    }
+
+    auto& outstation = this->outstations[i];
+    if (enable)
+    {
+        outstation.unsolClasses.Set(classes);
+    }
+    else
+    {
+        outstation.unsolClasses.Clear(classes);
+    }
+
+    return errors;
+}
+
+void SimulatedOutstations::BeginResponse(FunctionCode function, uint8_t control)
+{
+    this->fragment.clear();
+    this->fragment.push_back(control);
+    this->fragment.push_back(FunctionCodeSpec::to_type(function));
+    // IIN, filled in by EndResponse
+    this->fragment.push_back(0);
+    this->fragment.push_back(0);
+}
+
+void SimulatedOutstations::EndResponse(size_t i, const IINField& errors)
+{
+    auto iin = this->outstations[i].iin | errors;
+
+    const auto& outstation = this->outstations[i];
+    for (uint16_t offset = 0; offset < outstation.numEvents; ++offset)
+    {
+        const auto& event = this->GetEvent(i, offset);
+        if (!event.selected)
+        {
+            iin.SetBit(GetClassBit(this->model.Get(event.type).eventClass));
+        }
+    }
+
+    this->fragment[2] = iin.LSB;
+    this->fragment[3] = iin.MSB;
+}
+
+void SimulatedOutstations::SendResponse(size_t i, std::vector<uint8_t>& tx)
+{
+    auto& outstation = this->outstations[i];
+    const auto address = static_cast<uint16_t>(this->firstAddress + i);
+
+    std::array<uint8_t, LinkFraming::MAX_USER_DATA_SIZE> segment;
+
+    for (size_t pos = 0; pos < this->fragment.size();)
+    {
+        const auto size = std::min(MAX_SEGMENT_PAYLOAD, this->fragment.size() - pos);
+
+        segment[0] = outstation.transportSeq;
+        if (pos == 0)
+            segment[0] |= TRANSPORT_FIR;
+        if (pos + size == this->fragment.size())
+            segment[0] |= TRANSPORT_FIN;
+        outstation.transportSeq = static_cast<uint8_t>((outstation.transportSeq + 1) & TRANSPORT_SEQ);
+
+        std::copy(this->fragment.begin() + pos, this->fragment.begin() + pos + size, segment.begin() + 1);
+        LinkFraming::Write(tx, LinkFunction::PRI_UNCONFIRMED_USER_DATA, this->settings.masterAddress, address,
+                           segment.data(), static_cast<uint8_t>(size + 1));
+
+        pos += size;
+    }
+}
+
+size_t SimulatedOutstations::WriteEvents(size_t i, const ClassField& classes, size_t limit)
+{
+    const auto& outstation = this->outstations[i];
+
+    size_t numWritten = 0;
+    // events of the same type following each other share a header
+    uint16_t count = 0;
+    size_t countPos = 0;
+    auto type = PointModel::Type::Binary;
+
+    for (uint16_t offset = 0; offset < outstation.numEvents; ++offset)
+    {
+        auto& event = this->GetEvent(i, offset);
+        const auto& info = this->model.Get(event.type);
+
+        if (event.selected || !classes.Intersects(ClassField(info.eventClass)))
+            continue;
+
+        const bool sameHeader = (count > 0) && (event.type == type);
+        const auto size = (sameHeader ? 0 : EVENT_HEADER_SIZE) + EVENT_INDEX_SIZE + info.eventSize;
+        if (this->fragment.size() + size > limit)
+            break;
+
+        if (!sameHeader)
+        {
+            WriteHeader(this->fragment, info.eventVariation, QualifierCode::UINT16_CNT_UINT16_INDEX);
+            countPos = this->fragment.size();
+            WriteUInt16(this->fragment, 0);
+            type = event.type;
+            count = 0;
+        }
+
+        WriteUInt16(this->fragment, event.index);
+        if (event.type == PointModel::Type::Binary)
+        {
+            this->fragment.push_back(static_cast<uint8_t>(ONLINE | (event.value ? BINARY_STATE : 0)));
+        }
+        else
+        {
+            this->fragment.push_back(ONLINE);
+            WriteUInt32(this->fragment, event.value);
+        }
+
+        ++count;
+        this->fragment[countPos] = static_cast<uint8_t>(count & 0xFF);
+        this->fragment[countPos + 1] = static_cast<uint8_t>(count >> 8);
+
+        event.selected = true;
+        ++numWritten;
+    }
+
+    return numWritten;
+}
+
+void SimulatedOutstations::WriteStatic(size_t i, PointModel::Type type)
+{
+    const auto& info = this->model.Get(type);
+
+    WriteHeader(this->fragment, info.staticVariation, QualifierCode::UINT16_START_STOP);
+    WriteUInt16(this->fragment, 0);
+    WriteUInt16(this->fragment, static_cast<uint16_t>(this->model.pointsPerType - 1));
+
+    const auto begin = i * this->model.pointsPerType;
+    const auto end = begin + this->model.pointsPerType;
+
+    for (auto point = begin; point < end; ++point)
+    {
+        switch (type)
+        {
+        case (PointModel::Type::Binary):
+            this->fragment.push_back(static_cast<uint8_t>(ONLINE | (this->binaries[point] ? BINARY_STATE : 0)));
+            break;
+        case (PointModel::Type::Counter):
+            this->fragment.push_back(ONLINE);
+            WriteUInt32(this->fragment, this->counters[point]);
+            break;
+        case (PointModel::Type::Analog):
+            this->fragment.push_back(ONLINE);
+            WriteUInt32(this->fragment, ToBits(this->analogs[point]));
+            break;
+        }
+    }
+}
+
+bool SimulatedOutstations::HasEvents(size_t i, const ClassField& classes) const
+{
+    if (!classes.HasEventClass())
+        return false;
+
+    const auto& outstation = this->outstations[i];
+    for (uint16_t offset = 0; offset < outstation.numEvents; ++offset)
+    {
+        const auto& event = this->GetEvent(i, offset);
+        if (!event.selected && classes.Intersects(ClassField(this->model.Get(event.type).eventClass)))
+            return true;
+    }
+
+    return false;
+}
+
+SimulatedOutstations::Event& SimulatedOutstations::GetEvent(size_t i, uint16_t offset)
+{
+    const auto& outstation = this->outstations[i];
+    return this->events[i * this->model.eventCapacity + (outstation.eventHead + offset) % this->model.eventCapacity];
+}
+
+const SimulatedOutstations::Event& SimulatedOutstations::GetEvent(size_t i, uint16_t offset) const
+{
+    const auto& outstation = this->outstations[i];
+    return this->events[i * this->model.eventCapacity + (outstation.eventHead + offset) % this->model.eventCapacity];
+}
+
+void SimulatedOutstations::AddEvent(size_t i, PointModel::Type type, uint16_t index, uint32_t value)
+{
+    auto& outstation = this->outstations[i];
+
+    if (outstation.numEvents == this->model.eventCapacity)
+    {
+        // drop the oldest
+        outstation.eventHead = static_cast<uint16_t>((outstation.eventHead + 1) % this->model.eventCapacity);
+        --outstation.numEvents;
+        outstation.iin.SetBit(IINBit::EVENT_BUFFER_OVERFLOW);
+    }
+
+    this->GetEvent(i, outstation.numEvents) = Event{value, index, type, false};
+    ++outstation.numEvents;
+}
+
+void SimulatedOutstations::InjectEvent(size_t i)
+{
+    const auto random = Next(this->pickState);
+    const auto index = static_cast<uint16_t>((random >> 2) % this->model.pointsPerType);
+    const auto point = i * this->model.pointsPerType + index;
+
+    switch (random % 3)
+    {
+    case (0):
+        this->AddEvent(i, PointModel::Type::Analog, index, ToBits(this->analogs[point]));
+        break;
+    case (1):
+        this->AddEvent(i, PointModel::Type::Counter, index, ++this->counters[point]);
+        break;
+    default:
+        this->binaries[point] ^= 1;
+        this->AddEvent(i, PointModel::Type::Binary, index, this->binaries[point]);
+        break;
+    }
+}
+
+void SimulatedOutstations::Unselect(size_t i)
+{
+    const auto& outstation = this->outstations[i];
+    for (uint16_t offset = 0; offset < outstation.numEvents; ++offset)
+    {
+        this->GetEvent(i, offset).selected = false;
+    }
+}
+
+void SimulatedOutstations::RemoveSelected(size_t i)
+{
+    auto& outstation = this->outstations[i];
+
+    uint16_t numKept = 0;
+    for (uint16_t offset = 0; offset < outstation.numEvents; ++offset)
+    {
+        const auto event = this->GetEvent(i, offset);
+        if (!event.selected)
+        {
+            this->GetEvent(i, numKept++) = event;
+        }
+    }
+
+    outstation.numEvents = numKept;
+    outstation.iin.ClearBit(IINBit::EVENT_BUFFER_OVERFLOW);
+}
@@ -0,0 +1,195 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_SIMULATEDOUTSTATIONS_H
+#define OPENDNP3_SIMULATEDOUTSTATIONS_H
+
+#include "SimulatorSettings.h"
+
+#include <opendnp3/app/ClassField.h>
+#include <opendnp3/app/IINField.h>
+#include <opendnp3/gen/FunctionCode.h>
+#include <opendnp3/gen/GroupVariation.h>
+#include <opendnp3/gen/PointClass.h>
+#include <opendnp3/util/Uncopyable.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * The point configuration shared by every simulated outstation. It's built once from the settings and only read
+ * afterwards, so one instance serves all the outstations of all the channels.
+ */
+class PointModel final
+{
+public:
+    enum class Type : uint8_t
+    {
+        Binary = 0,
+        Counter = 1,
+        Analog = 2
+    };
+
+    static const uint8_t NUM_TYPES = 3;
+
+    struct TypeInfo
+    {
+        opendnp3::GroupVariation staticVariation;
+        opendnp3::GroupVariation eventVariation;
+        opendnp3::PointClass eventClass;
+        // bytes per object, without the index prefix of events
+        uint8_t staticSize;
+        uint8_t eventSize;
+    };
+
+    explicit PointModel(const SimulatorSettings& settings);
+
+    const TypeInfo& Get(Type type) const
+    {
+        return types[static_cast<uint8_t>(type)];
+    }
+
+    // bytes needed to report every point of a type as static data, including the object header
+    size_t GetStaticSize(Type type) const;
+
+    const uint16_t pointsPerType;
+    const uint16_t eventCapacity;
+    const uint16_t maxFragmentSize;
+
+private:
+    const std::array<TypeInfo, NUM_TYPES> types;
+};
+
+/**
+ * The outstations served by one channel, on consecutive link addresses.
+ *
+ * Each outstation only keeps a few bytes of protocol state, a slice of the flat value arrays and a slice of the
+ * event storage used as a ring. Everything else comes from the shared PointModel. The application layer covers
+ * what a master needs for polling and unsolicited reporting: class and static reads, confirms, clearing the
+ * restart IIN and enabling or disabling unsolicited responses. Requests must fit in a single transport segment
+ * and anything else is answered with IIN2.0. No null unsolicited response is sent at startup.
+ *
+ * Not thread safe, the owning channel calls it from its strand.
+ */
+class SimulatedOutstations final : private opendnp3::Uncopyable
+{
+public:
+    SimulatedOutstations(const PointModel& model,
+                         const SimulatorSettings& settings,
+                         uint16_t firstAddress,
+                         uint16_t count,
+                         uint32_t seed);
+
+    bool Contains(uint16_t address) const
+    {
+        return address >= firstAddress && static_cast<size_t>(address - firstAddress) < outstations.size();
+    }
+
+    // handles a transport segment sent to 'address' and appends the link frames of any response to 'tx', returns the
+    // number of events the segment confirmed
+    uint64_t OnUserData(uint16_t address, const uint8_t* data, size_t length, std::vector<uint8_t>& tx);
+
+    // advances the values and injects events, returns the number of events injected. If 'online', unsolicited
+    // responses are appended to 'tx'.
+    uint64_t Tick(double seconds, bool online, std::vector<uint8_t>& tx);
+
+    // responses awaiting confirmation are dropped, their events are reported again
+    void OnConnectionClosed();
+
+private:
+    enum class Confirm : uint8_t
+    {
+        None,
+        Solicited,
+        Unsolicited
+    };
+
+    struct Event
+    {
+        uint32_t value;
+        uint16_t index;
+        PointModel::Type type;
+        // part of the response awaiting confirmation
+        bool selected;
+    };
+
+    struct Outstation
+    {
+        // fractional events carried over to the next tick
+        float pendingEvents = 0.0f;
+        // tick at which an unconfirmed unsolicited response is given up
+        uint32_t confirmDeadline = 0;
+        uint16_t eventHead = 0;
+        uint16_t numEvents = 0;
+        opendnp3::IINField iin = opendnp3::IINField(opendnp3::IINBit::DEVICE_RESTART);
+        opendnp3::ClassField unsolClasses;
+        Confirm confirm = Confirm::None;
+        uint8_t confirmSeq = 0;
+        uint8_t unsolSeq = 0;
+        uint8_t transportSeq = 0;
+    };
+
+    bool OnRequest(size_t i, const uint8_t* apdu, size_t length);
+    void OnConfirm(size_t i, uint8_t control);
+    void OnRead(size_t i, uint8_t seq, const uint8_t* objects, size_t length);
+    opendnp3::IINField OnWrite(size_t i, const uint8_t* objects, size_t length);
+    opendnp3::IINField OnUnsolicitedControl(size_t i, bool enable, const uint8_t* objects, size_t length);
+
+    void BeginResponse(opendnp3::FunctionCode function, uint8_t control);
+    void EndResponse(size_t i, const opendnp3::IINField& errors);
+    void SendResponse(size_t i, std::vector<uint8_t>& tx);
+
+    size_t WriteEvents(size_t i, const opendnp3::ClassField& classes, size_t limit);
+    void WriteStatic(size_t i, PointModel::Type type);
+    bool HasEvents(size_t i, const opendnp3::ClassField& classes) const;
+
+    Event& GetEvent(size_t i, uint16_t offset);
+    const Event& GetEvent(size_t i, uint16_t offset) const;
+    void AddEvent(size_t i, PointModel::Type type, uint16_t index, uint32_t value);
+    void InjectEvent(size_t i);
+    void Unselect(size_t i);
+    void RemoveSelected(size_t i);
+
+    const PointModel& model;
+    const SimulatorSettings& settings;
+    const uint16_t firstAddress;
+    const uint32_t confirmTimeoutTicks;
+
+    uint32_t tick = 0;
+    uint32_t pickState;
+
+    std::vector<Outstation> outstations;
+
+    // pointsPerType entries per outstation
+    std::vector<float> analogs;
+    std::vector<uint32_t> counters;
+    std::vector<uint8_t> binaries;
+    // one generator state per analog, so every lane of the walk is independent
+    std::vector<uint32_t> walkState;
+
+    // eventCapacity entries per outstation
+    std::vector<Event> events;
+
+    // the response being built
+    std::vector<uint8_t> fragment;
+};
+
+#endif
@@ -0,0 +1,324 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "SimulatorChannel.h"
+
+#include <opendnp3/gen/LinkFunction.h>
+
+#include <iostream>
+
+using namespace opendnp3;
+
+namespace
+{
+// frames from a master have DIR and PRM set, the function also keeps PRM
+const uint8_t LINK_DIR = 0x80;
+const uint8_t LINK_PRM = 0x40;
+const uint8_t LINK_FUNCTION_MASK = 0x4F;
+} // namespace
+
+SimulatorChannel::SimulatorChannel(asio::io_context& context,
+                                   const PointModel& model,
+                                   const SimulatorSettings& settings,
+                                   uint16_t port,
+                                   uint16_t numOutstations,
+                                   uint32_t seed,
+                                   std::atomic<uint64_t>& numEventsInjected,
+                                   std::atomic<uint64_t>& numEventsConfirmed)
+    : settings(settings),
+      port(port),
+      numEventsInjected(numEventsInjected),
+      numEventsConfirmed(numEventsConfirmed),
+      strand(context),
+      timer(context),
+      acceptor(context),
+      socket(context),
+      udpSocket(context),
+      outstations(model, settings, settings.baseOutstationAddress, numOutstations, seed)
+{
+    const auto address = asio::ip::address::from_string(settings.localAdapter);
+
+    if (this->IsTCP())
+    {
+        const asio::ip::tcp::endpoint endpoint(address, port);
+        this->acceptor.open(endpoint.protocol());
+        this->acceptor.set_option(asio::ip::tcp::acceptor::reuse_address(true));
+        this->acceptor.bind(endpoint);
+        this->acceptor.listen();
+    }
+    else
+    {
+        const asio::ip::udp::endpoint endpoint(address, port);
+        this->udpSocket.open(endpoint.protocol());
+        this->udpSocket.bind(endpoint);
+    }
+}
+
+void SimulatorChannel::Start()
+{
+    asio::post(this->strand, [self = shared_from_this()]() {
+        if (self->IsTCP())
+        {
+            self->StartAccept();
+        }
+        else
+        {
+            self->StartRead();
+        }
+
+        self->lastTick = std::chrono::steady_clock::now();
+        self->nextTick = self->lastTick + self->settings.tickPeriod;
+        self->StartTick();
+    });
+}
+
+void SimulatorChannel::Shutdown()
+{
+    asio::post(this->strand, [self = shared_from_this()]() {
+        self->isShutdown = true;
+
+        std::error_code ec;
+        self->acceptor.close(ec);
+        self->socket.close(ec);
+        self->udpSocket.close(ec);
+        self->timer.cancel(ec);
+    });
+}
+
+void SimulatorChannel::StartAccept()
+{
+    this->acceptor.async_accept(asio::bind_executor(
+        this->strand, [self = shared_from_this()](const std::error_code& ec, asio::ip::tcp::socket socket) {
+            if (self->isShutdown)
+                return;
+
+            if (ec)
+            {
+                std::cerr << "Port " << self->port << ": " << ec.message() << std::endl;
+            }
+            else
+            {
+                std::cout << "Port " << self->port << ": accepted a connection" << std::endl;
+
+                self->CloseConnection();
+                self->socket = std::move(socket);
+                self->isConnected = true;
+                self->StartRead();
+            }
+
+            self->StartAccept();
+        }));
+}
+
+void SimulatorChannel::StartRead()
+{
+    if (this->IsTCP())
+    {
+        const auto id = this->connectionId;
+        this->socket.async_read_some(
+            asio::buffer(this->rxBuffer),
+            asio::bind_executor(this->strand,
+                                [self = shared_from_this(), id](const std::error_code& ec, size_t num) {
+                                    if (self->isShutdown || id != self->connectionId)
+                                        return;
+
+                                    if (ec)
+                                    {
+                                        std::cout << "Port " << self->port << ": connection closed" << std::endl;
+                                        self->CloseConnection();
+                                        return;
+                                    }
+
+                                    self->OnData(self->rxBuffer.data(), num);
+                                    self->StartRead();
+                                }));
+    }
+    else
+    {
+        this->udpSocket.async_receive_from(
+            asio::buffer(this->rxBuffer), this->sender,
+            asio::bind_executor(this->strand, [self = shared_from_this()](const std::error_code& ec, size_t num) {
+                if (self->isShutdown)
+                    return;
+
+                // errors of earlier sends may be reported here, they don't stop the channel
+                if (!ec)
+                {
+                    // responses go to whoever sent the last request
+                    self->remote = self->sender;
+                    self->isConnected = true;
+
+                    // frames never span datagrams
+                    self->parser.Reset();
+                    self->OnData(self->rxBuffer.data(), num);
+                }
+
+                self->StartRead();
+            }));
+    }
+}
+
+void SimulatorChannel::StartTick()
+{
+    this->timer.expires_at(this->nextTick);
+    this->timer.async_wait(asio::bind_executor(this->strand, [self = shared_from_this()](const std::error_code& ec) {
+        if (ec || self->isShutdown)
+            return;
+
+        self->OnTick();
+    }));
+}
+
+void SimulatorChannel::OnTick()
+{
+    const auto now = std::chrono::steady_clock::now();
+    const auto seconds = std::chrono::duration<double>(now - this->lastTick).count();
+    this->lastTick = now;
+
+    const auto numEvents = this->outstations.Tick(seconds, this->isConnected, this->txPending);
+    this->numEventsInjected.fetch_add(numEvents, std::memory_order_relaxed);
+    this->Flush();
+
+    this->nextTick += this->settings.tickPeriod;
+    if (this->nextTick < now)
+    {
+        // fell behind, don't try to catch up with a burst of ticks
+        this->nextTick = now + this->settings.tickPeriod;
+    }
+
+    this->StartTick();
+}
+
+void SimulatorChannel::OnData(const uint8_t* data, size_t length)
+{
+    this->parser.Append(data, length);
+
+    LinkFrameParser::Frame frame;
+    while (this->parser.Next(frame))
+    {
+        this->OnFrame(frame);
+    }
+
+    this->Flush();
+}
+
+void SimulatorChannel::OnFrame(const LinkFrameParser::Frame& frame)
+{
+    if ((frame.control & (LINK_DIR | LINK_PRM)) != (LINK_DIR | LINK_PRM) || frame.src != this->settings.masterAddress
+        || !this->outstations.Contains(frame.dest))
+        return;
+
+    const auto reply = [&](LinkFunction function) {
+        LinkFraming::Write(this->txPending, function, frame.src, frame.dest, nullptr, 0);
+    };
+
+    const auto deliver = [&]() {
+        const auto numConfirmed = this->outstations.OnUserData(frame.dest, frame.data, frame.length, this->txPending);
+        this->numEventsConfirmed.fetch_add(numConfirmed, std::memory_order_relaxed);
+    };
+
+    switch (LinkFunctionSpec::from_type(frame.control & LINK_FUNCTION_MASK))
+    {
+    case (LinkFunction::PRI_RESET_LINK_STATES):
+    case (LinkFunction::PRI_TEST_LINK_STATES):
+        reply(LinkFunction::SEC_ACK);
+        break;
+    case (LinkFunction::PRI_REQUEST_LINK_STATUS):
+        reply(LinkFunction::SEC_LINK_STATUS);
+        break;
+    case (LinkFunction::PRI_CONFIRMED_USER_DATA):
+        reply(LinkFunction::SEC_ACK);
+        deliver();
+        break;
+    case (LinkFunction::PRI_UNCONFIRMED_USER_DATA):
+        deliver();
+        break;
+    default:
+        reply(LinkFunction::SEC_NOT_SUPPORTED);
+        break;
+    }
+}
+
+void SimulatorChannel::Flush()
+{
+    if (!this->isConnected)
+    {
+        this->txPending.clear();
+        return;
+    }
+
+    if (!this->IsTCP())
+    {
+        // one frame per datagram, a master's UDP channel reads at most a frame at a time
+        for (size_t pos = 0; pos < this->txPending.size();)
+        {
+            const auto size = LinkFraming::GetFrameSize(this->txPending.data() + pos);
+
+            std::error_code ec;
+            this->udpSocket.send_to(asio::buffer(this->txPending.data() + pos, size), this->remote, 0, ec);
+
+            pos += size;
+        }
+
+        this->txPending.clear();
+        return;
+    }
+
+    if (this->isWriting || this->txPending.empty())
+        return;
+
+    std::swap(this->txPending, this->txActive);
+    this->txPending.clear();
+    this->isWriting = true;
+
+    const auto id = this->connectionId;
+    asio::async_write(this->socket, asio::buffer(this->txActive),
+                      asio::bind_executor(this->strand, [self = shared_from_this(), id](const std::error_code& ec,
+                                                                                        size_t /*num*/) {
+                          // txActive is free again, even if the connection was replaced meanwhile
+                          self->isWriting = false;
+
+                          if (self->isShutdown)
+                              return;
+
+                          if (ec && id == self->connectionId)
+                          {
+                              self->CloseConnection();
+                              return;
+                          }
+
+                          self->Flush();
+                      }));
+}
+
+void SimulatorChannel::CloseConnection()
+{
+    if (!this->isConnected)
+        return;
+
+    this->isConnected = false;
+    ++this->connectionId;
+
+    std::error_code ec;
+    this->socket.close(ec);
+
+    this->parser.Reset();
+    this->txPending.clear();
+    this->outstations.OnConnectionClosed();
+}
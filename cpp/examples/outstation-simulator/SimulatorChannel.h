@@ -0,0 +1,111 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_SIMULATORCHANNEL_H
+#define OPENDNP3_SIMULATORCHANNEL_H
+
+#include "LinkFraming.h"
+#include "SimulatedOutstations.h"
+#include "SimulatorSettings.h"
+
+#include <opendnp3/util/Uncopyable.h>
+
+#include <asio.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+/**
+ * Serves the outstations of one port over TCP or UDP to a single master.
+ *
+ * The network handlers and the simulation ticks all run on the channel's strand, so the outstations need no locking
+ * and any number of channels share a few threads. A new TCP connection replaces the current one.
+ */
+class SimulatorChannel final : public std::enable_shared_from_this<SimulatorChannel>, private opendnp3::Uncopyable
+{
+public:
+    // binds the port, throws if that fails
+    SimulatorChannel(asio::io_context& context,
+                     const PointModel& model,
+                     const SimulatorSettings& settings,
+                     uint16_t port,
+                     uint16_t numOutstations,
+                     uint32_t seed,
+                     std::atomic<uint64_t>& numEventsInjected,
+                     std::atomic<uint64_t>& numEventsConfirmed);
+
+    void Start();
+
+    void Shutdown();
+
+private:
+    bool IsTCP() const
+    {
+        return this->settings.transport == SimulatorSettings::Transport::TCP;
+    }
+
+    void StartAccept();
+    void StartRead();
+    void StartTick();
+
+    void OnTick();
+    void OnData(const uint8_t* data, size_t length);
+    void OnFrame(const LinkFrameParser::Frame& frame);
+
+    void Flush();
+    void CloseConnection();
+
+    const SimulatorSettings& settings;
+    const uint16_t port;
+    std::atomic<uint64_t>& numEventsInjected;
+    std::atomic<uint64_t>& numEventsConfirmed;
+
+    asio::io_context::strand strand;
+    asio::steady_timer timer;
+
+    asio::ip::tcp::acceptor acceptor;
+    asio::ip::tcp::socket socket;
+
+    asio::ip::udp::socket udpSocket;
+    asio::ip::udp::endpoint sender;
+    asio::ip::udp::endpoint remote;
+
+    SimulatedOutstations outstations;
+    LinkFrameParser parser;
+
+    bool isShutdown = false;
+    // a TCP connection is open, or a UDP datagram was received from the master
+    bool isConnected = false;
+    bool isWriting = false;
+    // handlers of a replaced connection are ignored
+    uint32_t connectionId = 0;
+
+    std::chrono::steady_clock::time_point lastTick;
+    std::chrono::steady_clock::time_point nextTick;
+
+    std::array<uint8_t, 4096> rxBuffer;
+    // frames to send, swapped with txActive while a TCP write is in progress
+    std::vector<uint8_t> txPending;
+    std::vector<uint8_t> txActive;
+};
+
+#endif
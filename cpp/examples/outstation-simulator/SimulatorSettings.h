@@ -0,0 +1,64 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_SIMULATORSETTINGS_H
+#define OPENDNP3_SIMULATORSETTINGS_H
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+struct SimulatorSettings
+{
+    enum class Transport
+    {
+        TCP,
+        UDP
+    };
+
+    uint32_t numOutstations = 1000;
+    uint16_t pointsPerType = 100;
+    // events buffered per outstation before the oldest are dropped
+    uint16_t eventCapacity = 100;
+    // largest response fragment, static data of every type must fit in one
+    uint16_t maxFragmentSize = 2048;
+
+    // average number of events injected per outstation per second
+    double eventsPerSecond = 1.0;
+    // largest step of the analog random walk per tick
+    float analogStep = 1.0f;
+
+    bool allowUnsolicited = true;
+    std::chrono::milliseconds confirmTimeout = std::chrono::seconds(5);
+
+    uint32_t numThreads = std::thread::hardware_concurrency();
+    std::chrono::milliseconds tickPeriod = std::chrono::milliseconds(100);
+
+    Transport transport = Transport::TCP;
+    // outstations are spread over this many channels, sharing each one by link address
+    uint16_t numChannels = 10;
+    uint16_t basePort = 20000;
+    std::string localAdapter = "0.0.0.0";
+
+    uint16_t masterAddress = 1;
+    uint16_t baseOutstationAddress = 1024;
+};
+
+#endif
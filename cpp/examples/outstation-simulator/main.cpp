@@ -0,0 +1,174 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "OutstationSimulator.h"
+
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+
+using namespace std;
+
+using option_handler_t = std::function<void(SimulatorSettings&, const std::string& value)>;
+
+void init_options(std::map<std::string, option_handler_t>& map);
+void print_usage();
+
+int main(int argc, char* argv[])
+{
+    std::map<std::string, option_handler_t> options;
+    init_options(options);
+
+    SimulatorSettings settings;
+    uint32_t durationSeconds = 0;
+
+    try
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string name(argv[i]);
+
+            if (name == "--help")
+            {
+                print_usage();
+                return 0;
+            }
+
+            if (name == "--duration" && i + 1 < argc)
+            {
+                durationSeconds = static_cast<uint32_t>(std::stoul(argv[++i]));
+                continue;
+            }
+
+            const auto option = options.find(name);
+            if (option == options.end() || i + 1 >= argc)
+            {
+                std::cerr << "Unknown option or missing value: " << name << std::endl;
+                print_usage();
+                return -1;
+            }
+
+            option->second(settings, argv[++i]);
+        }
+
+        std::cout << "Starting " << settings.numOutstations << " outstations with " << settings.pointsPerType
+                  << " points per type on " << settings.numChannels << " channels" << std::endl;
+
+        OutstationSimulator simulator(settings);
+        simulator.Start();
+
+        // report the injection rate until the duration (if any) expires
+        const auto period = std::chrono::seconds(5);
+        auto previous = simulator.GetNumEventsInjected();
+        for (uint32_t elapsed = 0; durationSeconds == 0 || elapsed < durationSeconds; elapsed += 5)
+        {
+            std::this_thread::sleep_for(period);
+
+            const auto current = simulator.GetNumEventsInjected();
+            std::cout << (current - previous) / period.count() << " events per/sec" << std::endl;
+            previous = current;
+        }
+
+        simulator.Stop();
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
+
+void init_options(std::map<std::string, option_handler_t>& map)
+{
+    map["--outstations"] = [](SimulatorSettings& s, const std::string& v) { s.numOutstations = std::stoul(v); };
+    map["--points"] = [](SimulatorSettings& s, const std::string& v) {
+        s.pointsPerType = static_cast<uint16_t>(std::stoul(v));
+    };
+    map["--events"] = [](SimulatorSettings& s, const std::string& v) {
+        s.eventCapacity = static_cast<uint16_t>(std::stoul(v));
+    };
+    map["--fragment"] = [](SimulatorSettings& s, const std::string& v) {
+        s.maxFragmentSize = static_cast<uint16_t>(std::stoul(v));
+    };
+    map["--rate"] = [](SimulatorSettings& s, const std::string& v) { s.eventsPerSecond = std::stod(v); };
+    map["--step"] = [](SimulatorSettings& s, const std::string& v) { s.analogStep = std::stof(v); };
+    map["--unsolicited"] = [](SimulatorSettings& s, const std::string& v) {
+        if (v == "on")
+            s.allowUnsolicited = true;
+        else if (v == "off")
+            s.allowUnsolicited = false;
+        else
+            throw std::invalid_argument("unsolicited must be on or off");
+    };
+    map["--confirm-ms"] = [](SimulatorSettings& s, const std::string& v) {
+        s.confirmTimeout = std::chrono::milliseconds(std::stoul(v));
+    };
+    map["--threads"] = [](SimulatorSettings& s, const std::string& v) { s.numThreads = std::stoul(v); };
+    map["--tick-ms"] = [](SimulatorSettings& s, const std::string& v) {
+        s.tickPeriod = std::chrono::milliseconds(std::stoul(v));
+    };
+    map["--transport"] = [](SimulatorSettings& s, const std::string& v) {
+        if (v == "tcp")
+            s.transport = SimulatorSettings::Transport::TCP;
+        else if (v == "udp")
+            s.transport = SimulatorSettings::Transport::UDP;
+        else
+            throw std::invalid_argument("transport must be tcp or udp");
+    };
+    map["--channels"] = [](SimulatorSettings& s, const std::string& v) {
+        s.numChannels = static_cast<uint16_t>(std::stoul(v));
+    };
+    map["--port"] = [](SimulatorSettings& s, const std::string& v) {
+        s.basePort = static_cast<uint16_t>(std::stoul(v));
+    };
+    map["--adapter"] = [](SimulatorSettings& s, const std::string& v) { s.localAdapter = v; };
+    map["--master-address"] = [](SimulatorSettings& s, const std::string& v) {
+        s.masterAddress = static_cast<uint16_t>(std::stoul(v));
+    };
+    map["--address"] = [](SimulatorSettings& s, const std::string& v) {
+        s.baseOutstationAddress = static_cast<uint16_t>(std::stoul(v));
+    };
+}
+
+void print_usage()
+{
+    std::cout << "outstation-simulator [options]" << std::endl;
+    std::cout << "  --outstations <n>      number of simulated outstations (1000)" << std::endl;
+    std::cout << "  --points <n>           points of each type per outstation (100)" << std::endl;
+    std::cout << "  --events <n>           events buffered per outstation (100)" << std::endl;
+    std::cout << "  --fragment <bytes>     largest response fragment, must hold all static data (2048)" << std::endl;
+    std::cout << "  --rate <events/s>      events injected per outstation per second (1)" << std::endl;
+    std::cout << "  --step <value>         largest analog change per tick (1)" << std::endl;
+    std::cout << "  --unsolicited <on|off> accept requests to enable unsolicited responses (on)" << std::endl;
+    std::cout << "  --confirm-ms <ms>      how long responses with events wait for a confirm (5000)" << std::endl;
+    std::cout << "  --threads <n>          threads running the channels and the simulation (hardware concurrency)"
+              << std::endl;
+    std::cout << "  --tick-ms <ms>         period of the value generator (100)" << std::endl;
+    std::cout << "  --transport <tcp|udp>  transport of the channels (tcp)" << std::endl;
+    std::cout << "  --channels <n>         channels on consecutive ports, shared by link address (10)" << std::endl;
+    std::cout << "  --port <port>          port of the first channel (20000)" << std::endl;
+    std::cout << "  --adapter <address>    local adapter of the channels (0.0.0.0)" << std::endl;
+    std::cout << "  --master-address <n>   link address of the master (1)" << std::endl;
+    std::cout << "  --address <n>          link address of the first outstation on each channel (1024)" << std::endl;
+    std::cout << "  --duration <seconds>   exit after this long, 0 runs until killed (0)" << std::endl;
+}
@@ -26,6 +26,7 @@
 #include "opendnp3/channel/IChannelListener.h"
 #include "opendnp3/channel/IListener.h"
 #include "opendnp3/channel/IPEndpoint.h"
+#include "opendnp3/channel/ListenerConfig.h"
 #include "opendnp3/channel/SerialSettings.h"
 #include "opendnp3/channel/TLSConfig.h"
 #include "opendnp3/gen/ChannelState.h"
@@ -33,6 +34,7 @@
 #include "opendnp3/logging/ILogHandler.h"
 #include "opendnp3/logging/LogLevels.h"
 #include "opendnp3/master/IListenCallbacks.h"
+#include "opendnp3/util/IMemoryResource.h"
 #include "opendnp3/util/TimeDuration.h"
 
 #include <memory>
@@ -54,7 +56,8 @@ public:
     /**
      *	Construct a manager
      *
-     *	@param concurrencyHint How many threads to allocate in the thread pool
+     *	@param concurrencyHint How many threads to allocate in the thread pool. With a single thread, channels
+     *	invoke the completions of their I/O operations directly rather than through a strand.
      *	@param handler Callback interface for log messages
      *	@param onThreadStart Action to run when a thread pool thread starts
      *	@param onThreadExit Action to run just before a thread pool thread exits
@@ -72,6 +75,17 @@ public:
      */
     void Shutdown();
 
+    /**
+     * Set the memory resource that channels and stacks created from now on draw their long-lived state from,
+     * e.g. a MonotonicMemoryResource to keep it contiguous and capped. Null (the default) is the global heap.
+     * Individual channels can override this for their stacks with IChannel::SetMemoryResource.
+     *
+     * Everything allocated from the resource keeps it alive. Memory is only drawn from it while channels and stacks
+     * are created, so an exhausted resource makes the creating call fail (see IChannel::SetMemoryResource) and never
+     * affects the thread pool.
+     */
+    void SetMemoryResource(std::shared_ptr<IMemoryResource> resource);
+
     /**
      * Add a persistent TCP client channel. Automatically attempts to reconnect.
      *
@@ -143,6 +157,25 @@ public:
                                         SerialSettings settings,
                                         std::shared_ptr<IChannelListener> listener);
 
+    /**
+     * Add an in-process loopback channel.
+     *
+     * Two loopback channels added with the same name are connected to each other through memory
+     * instead of a socket, e.g. to run a master and an outstation in the same process for testing.
+     * If either side is shutdown, the other goes back to waiting for a new channel with the name.
+     *
+     * @param id Alias that will be used for logging purposes with this channel
+     * @param levels Bitfield that describes the logging level for this channel and associated sessions
+     * @param name Name that identifies the connection between the two channels
+     * @param listener optional callback interface (can be nullptr) for info about the running channel
+     * @throw DNP3Error if the manager was already shutdown
+     * @return shared_ptr to a channel interface
+     */
+    std::shared_ptr<IChannel> AddLoopbackChannel(const std::string& id,
+                                                 const opendnp3::LogLevels& levels,
+                                                 const std::string& name,
+                                                 std::shared_ptr<IChannelListener> listener);
+
     /**
      * Add a TLS client channel
      *
@@ -197,6 +230,26 @@ public:
                                               const IPEndpoint& endpoint,
                                               const std::shared_ptr<IListenCallbacks>& callbacks);
 
+    /**
+     * Create a TCP listener with scaling options for a large number of incoming connections
+     * @throw DNP3Error if the manager was already shutdown or if the server could not be binded properly
+     */
+    std::shared_ptr<IListener> CreateListener(std::string loggerid,
+                                              const opendnp3::LogLevels& loglevel,
+                                              const IPEndpoint& endpoint,
+                                              const ListenerConfig& config,
+                                              const std::shared_ptr<IListenCallbacks>& callbacks);
+
+    /**
+     * Create a UDP listener that creates a master session for every outstation (remote endpoint
+     * and link addresses) that sends it a frame. All sessions share a single bound socket.
+     * @throw DNP3Error if the manager was already shutdown or if the server could not be binded properly
+     */
+    std::shared_ptr<IListener> CreateUDPListener(std::string loggerid,
+                                                 const opendnp3::LogLevels& loglevel,
+                                                 const IPEndpoint& endpoint,
+                                                 const std::shared_ptr<IListenCallbacks>& callbacks);
+
     /**
      * Create a TLS listener that will be used to accept incoming connections
      * @throw DNP3Error if the manager was already shutdown, if the library was compiled without TLS support
@@ -63,6 +63,9 @@ struct StackStatistics
 
             /// number of segments ignored due to bad FIR/FIN or SEQ
             uint64_t numTransportIgnore = 0;
+
+            /// number of single segment (FIR and FIN) fragments passed up without copying them
+            uint64_t numTransportZeroCopyRx = 0;
         };
 
         struct Tx
@@ -78,12 +81,39 @@ struct StackStatistics
         Tx tx;
     };
 
+    struct Memory
+    {
+        /// bytes of link, transport, and application buffers currently held by the stack
+        uint64_t numBufferBytes = 0;
+
+        /// portion of numBufferBytes borrowed from the manager's buffer pool
+        uint64_t numPooledBufferBytes = 0;
+
+        /// bytes of long-lived stack state currently allocated from the memory resource of the channel
+        uint64_t numResourceBytes = 0;
+
+        void Add(uint64_t numBytes, bool pooled)
+        {
+            numBufferBytes += numBytes;
+            if (pooled)
+            {
+                numPooledBufferBytes += numBytes;
+            }
+        }
+    };
+
     StackStatistics() = default;
 
     StackStatistics(const Link& link, const Transport& transport) : link(link), transport(transport) {}
 
+    StackStatistics(const Link& link, const Transport& transport, const Memory& memory)
+        : link(link), transport(transport), memory(memory)
+    {
+    }
+
     Link link;
     Transport transport;
+    Memory memory;
 };
 
 } // namespace opendnp3
@@ -22,14 +22,18 @@
 
 #include "opendnp3/util/Buffer.h"
 
-#include <array>
 #include <cstdint>
 
 namespace opendnp3
 {
 
+class OctetBlock;
+
 /**
  * A base-class for bitstrings containing up to 255 bytes
+ *
+ * The bytes are held in a size-classed pool rather than inline, so a value only uses memory in proportion to its
+ * length. Copies share the pooled bytes and are as cheap as copying a pointer.
  */
 class OctetData
 {
@@ -64,6 +68,16 @@ public:
      */
     OctetData(const Buffer& input);
 
+    OctetData(const OctetData& other);
+
+    OctetData(OctetData&& other) noexcept;
+
+    OctetData& operator=(const OctetData& other);
+
+    OctetData& operator=(OctetData&& other) noexcept;
+
+    ~OctetData();
+
     inline uint8_t Size() const
     {
         return size;
@@ -101,7 +115,12 @@ public:
 private:
     static const Buffer ToSlice(const char* input);
 
-    std::array<uint8_t, MAX_SIZE> buffer = {0x00};
+    void Assign(const uint8_t* data, uint8_t length);
+
+    void Reset();
+
+    // null for the default value of [0x00]
+    OctetBlock* block = nullptr;
     uint8_t size;
 };
 
@@ -28,10 +28,13 @@
 #include "opendnp3/master/IMasterApplication.h"
 #include "opendnp3/master/ISOEHandler.h"
 #include "opendnp3/master/MasterStackConfig.h"
+#include "opendnp3/master/PollPlannerConfig.h"
+#include "opendnp3/outstation/IAsyncCommandHandler.h"
 #include "opendnp3/outstation/ICommandHandler.h"
 #include "opendnp3/outstation/IOutstation.h"
 #include "opendnp3/outstation/IOutstationApplication.h"
 #include "opendnp3/outstation/OutstationStackConfig.h"
+#include "opendnp3/util/IMemoryResource.h"
 
 #include <memory>
 
@@ -61,6 +64,21 @@ public:
      */
     virtual void SetLogFilters(const opendnp3::LogLevels& filters) = 0;
 
+    /**
+     *  @param config Controls how the tasks of the masters on this channel are ordered
+     */
+    virtual void SetPollPlanner(const PollPlannerConfig& config) = 0;
+
+    /**
+     *  @param resource Memory resource that masters and outstations added to the channel from now on draw their
+     *                  long-lived state from, overriding the one set on the manager. Null for the global heap.
+     *
+     *  Stacks only draw from the resource while they are added, never while running. If it is exhausted, AddMaster
+     *  and AddOutstation throw std::bad_alloc, or log an error and return nullptr if the stack couldn't be bound to
+     *  the channel. Stacks that were already added keep running.
+     */
+    virtual void SetMemoryResource(std::shared_ptr<IMemoryResource> resource) = 0;
+
     /**
      * Add a master to the channel
      *
@@ -91,6 +109,21 @@ public:
                                                        std::shared_ptr<IOutstationApplication> application,
                                                        const OutstationStackConfig& config)
         = 0;
+
+    /**
+     * Add an outstation whose commands complete asynchronously to the channel
+     *
+     * @param id An ID that gets used for logging
+     * @param commandHandler Callback object for handling command requests, completed through CommandCompletion
+     * @param application Callback object for user code
+     * @param config Configuration object that controls how the outstation behaves
+     * @return shared_ptr to the running outstation
+     */
+    virtual std::shared_ptr<IOutstation> AddOutstation(const std::string& id,
+                                                       std::shared_ptr<IAsyncCommandHandler> commandHandler,
+                                                       std::shared_ptr<IOutstationApplication> application,
+                                                       const OutstationStackConfig& config)
+        = 0;
 };
 
 } // namespace opendnp3
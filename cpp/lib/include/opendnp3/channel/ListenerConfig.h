@@ -0,0 +1,58 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_LISTENER_CONFIG_H
+#define OPENDNP3_LISTENER_CONFIG_H
+
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+ * Scaling options for TCP listeners that accept a large number of outstation connections
+ */
+struct ListenerConfig
+{
+    /**
+     * Construct a listener configuration
+     *
+     * @param numAcceptors Number of sockets accepting connections in parallel (default 1)
+     * @param sessionPoolSize Number of closed master sessions whose memory is retained for reuse (default 0)
+     */
+    ListenerConfig(uint16_t numAcceptors = 1, uint32_t sessionPoolSize = 0)
+        : numAcceptors(numAcceptors), sessionPoolSize(sessionPoolSize)
+    {
+    }
+
+    /// Number of sockets bound to the endpoint, each accepting on its own strand. Values greater than 1 use
+    /// SO_REUSEPORT so that the kernel balances incoming connections. Where SO_REUSEPORT is unavailable a single
+    /// socket is used. IListenCallbacks::AcceptConnection may be called concurrently when greater than 1.
+    uint16_t numAcceptors;
+
+    /// Number of closed master session stacks whose memory is kept for the next session instead of being returned
+    /// to the heap. Useful when outstations dial in and out frequently. This covers the stack object, its link and
+    /// transport layers, its fragment buffers and its scheduler. Objects the master creates while running, such as
+    /// tasks and values kept for MasterParams::suppressUnchangedStaticValues, still come from the heap.
+    uint32_t sessionPoolSize;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -25,6 +25,7 @@
 #include "opendnp3/gen/StopBits.h"
 #include "opendnp3/util/TimeDuration.h"
 
+#include <cstdint>
 #include <string>
 
 namespace opendnp3
@@ -41,7 +42,12 @@ struct SerialSettings
           stopBits(StopBits::One),
           parity(Parity::None),
           flowType(FlowControl::None),
-          asyncOpenDelay(TimeDuration::Milliseconds(500))
+          asyncOpenDelay(TimeDuration::Milliseconds(500)),
+          readBatchMin(0),
+          readBatchTimeout(TimeDuration::Zero()),
+          lowLatency(false),
+          frameGap(TimeDuration::Zero()),
+          txTurnaround(TimeDuration::Zero())
     {
     }
 
@@ -65,6 +71,26 @@ struct SerialSettings
 
     /// Some physical layers need time to "settle" so that the first tx isn't lost
     TimeDuration asyncOpenDelay;
+
+    /// Minimum number of bytes the driver buffers before waking the reader (termios VMIN, Linux only).
+    /// Only honored by the driver when readBatchTimeout is zero. 0 leaves the driver default in place.
+    uint8_t readBatchMin;
+
+    /// Inter-character timer applied by the driver (termios VTIME, Linux only, 100ms resolution).
+    /// Zero leaves the driver default in place.
+    TimeDuration readBatchTimeout;
+
+    /// Request ASYNC_LOW_LATENCY from the driver (Linux only). Best effort, ignored if the driver doesn't support it.
+    bool lowLatency;
+
+    /// Silent interval on the line that marks the end of a frame. When non-zero, received bytes are
+    /// accumulated until the line goes quiet for this long (or a complete link frame has been read)
+    /// and are then handed to the link layer in a single read. Zero disables batching.
+    TimeDuration frameGap;
+
+    /// Minimum time between the last received byte and the start of a transmission,
+    /// e.g. to give RS-485 transceivers time to switch direction. Zero disables the delay.
+    TimeDuration txTurnaround;
 };
 
 } // namespace opendnp3
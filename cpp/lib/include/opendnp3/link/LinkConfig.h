@@ -49,6 +49,7 @@ struct LinkConfig
         :
 
           IsMaster(isMaster),
+          UseConfirms(useConfirms),
           LocalAddr(isMaster ? 1 : 1024),
           RemoteAddr(isMaster ? 1024 : 1),
           Timeout(TimeDuration::Seconds(1)),
@@ -64,6 +65,19 @@ struct LinkConfig
     /// The master/outstation bit set on all messages
     bool IsMaster;
 
+    /// If true, user data is transmitted with CONFIRMED_USER_DATA and each frame must be acknowledged by the remote
+    bool UseConfirms = false;
+
+    /// The number of retransmissions of an unacknowledged frame before the transmission fails
+    uint32_t NumRetry = 0;
+
+    /// The maximum number of confirmed frames awaiting an ACK at once (1 to 16)
+    ///
+    /// The default of 1 is the stop-and-wait behavior required by the standard. Larger values pipeline the frames of
+    /// a fragment, but must only be used if the remote is configured with the same value: with more than one frame
+    /// outstanding, the secondary orders frames by their transport sequence number instead of the FCB.
+    uint8_t ConfirmWindow = 1;
+
     /// dnp3 address of the local device
     uint16_t LocalAddr;
 
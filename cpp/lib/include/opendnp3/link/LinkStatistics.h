@@ -73,6 +73,24 @@ struct LinkStatistics
 
         /// Number of frames transmitted
         size_t numLinkFrameTx = 0;
+
+        /// Number of non-broadcast frames received whose addresses matched no enabled session
+        size_t numUnknownRoute = 0;
+    };
+
+    struct Polling
+    {
+        /// Number of master tasks started on the channel
+        size_t numTasksStarted = 0;
+
+        /// Number of periodic tasks started ahead of schedule because the channel was idle
+        size_t numTasksStartedEarly = 0;
+
+        /// Time in microseconds during which a master task was in progress on the channel
+        uint64_t busyMicroseconds = 0;
+
+        /// Time in microseconds since the first master task was started on the channel
+        uint64_t elapsedMicroseconds = 0;
     };
 
     LinkStatistics() = default;
@@ -84,6 +102,9 @@ struct LinkStatistics
 
     /// statistics for the link parser
     Parser parser;
+
+    /// line utilization by the masters on the channel, busyMicroseconds / elapsedMicroseconds
+    Polling polling;
 };
 
 } // namespace opendnp3
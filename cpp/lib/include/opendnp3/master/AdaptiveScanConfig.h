@@ -0,0 +1,62 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_ADAPTIVESCANCONFIG_H
+#define OPENDNP3_ADAPTIVESCANCONFIG_H
+
+#include "opendnp3/util/TimeDuration.h"
+
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+ * Configuration of a scan whose period adapts to how busy the outstation is.
+ *
+ * After each poll the period is:
+ *
+ * - reset to minPeriod if the outstation reports pending events via IIN1.1-1.3, or returned
+ *   at least backlogEventCount events
+ * - left unchanged if some events were returned
+ * - doubled, up to maxPeriod, if no events were returned
+ *
+ * The period can be stretched further if the channel's adaptive scan bandwidth budget is exceeded,
+ * see PollPlannerConfig.
+ */
+struct AdaptiveScanConfig
+{
+    AdaptiveScanConfig(TimeDuration minPeriod, TimeDuration maxPeriod, uint32_t backlogEventCount = 1)
+        : minPeriod(minPeriod), maxPeriod(maxPeriod), backlogEventCount(backlogEventCount)
+    {
+    }
+
+    /// Period used when the outstation has a backlog of events, and when the scan starts
+    TimeDuration minPeriod;
+
+    /// Period an idle outstation backs off to
+    TimeDuration maxPeriod;
+
+    /// Number of events in a single poll that indicates a backlog
+    uint32_t backlogEventCount;
+};
+
+} // namespace opendnp3
+
+#endif
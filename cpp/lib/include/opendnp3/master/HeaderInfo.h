@@ -41,7 +41,8 @@ public:
           tsquality(TimestampQuality::INVALID),
           isEventVariation(false),
           flagsValid(false),
-          headerIndex(0)
+          headerIndex(0),
+          numUnchanged(0)
     {
     }
 
@@ -51,7 +52,8 @@ public:
           tsquality(tsquality_),
           isEventVariation(IsEvent(gv_)),
           flagsValid(HasFlags(gv_)),
-          headerIndex(headerIndex_)
+          headerIndex(headerIndex_),
+          numUnchanged(0)
     {
     }
 
@@ -67,6 +69,9 @@ public:
     bool flagsValid;
     /// The 0-based index of the header within the ASDU
     uint32_t headerIndex;
+    /// Number of static values in the header that were not passed to the handler because they were unchanged.
+    /// Always 0 unless MasterParams::suppressUnchangedStaticValues is set
+    uint32_t numUnchanged;
 };
 
 } // namespace opendnp3
@@ -49,7 +49,8 @@ public:
     /// Task start notification
     virtual void OnTaskStart(MasterTaskType type, TaskId id) {}
 
-    /// Task completion notification
+    /// Task completion notification, called after all the values of the task were passed to the ISOEHandler
+    /// (also when MasterParams::decodeOnThreadPool delivers them from another strand)
     virtual void OnTaskComplete(const TaskInfo& info) {}
 
     /// Called when the application layer is opened
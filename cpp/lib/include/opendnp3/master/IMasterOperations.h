@@ -26,6 +26,7 @@
 #include "opendnp3/gen/FunctionCode.h"
 #include "opendnp3/gen/RestartType.h"
 #include "opendnp3/logging/LogLevels.h"
+#include "opendnp3/master/AdaptiveScanConfig.h"
 #include "opendnp3/master/HeaderTypes.h"
 #include "opendnp3/master/ICommandProcessor.h"
 #include "opendnp3/master/IMasterScan.h"
@@ -96,6 +97,16 @@ public:
                                                       const TaskConfig& config = TaskConfig::Default())
         = 0;
 
+    /**
+     * Add a class-based scan whose period adapts to the event activity of the outstation
+     * @return A proxy class used to manipulate the scan
+     */
+    virtual std::shared_ptr<IMasterScan> AddAdaptiveClassScan(const ClassField& field,
+                                                              const AdaptiveScanConfig& scanConfig,
+                                                              std::shared_ptr<ISOEHandler> soe_handler,
+                                                              const TaskConfig& config = TaskConfig::Default())
+        = 0;
+
     /**
      * Initiate a single user defined scan via a vector of headers
      */
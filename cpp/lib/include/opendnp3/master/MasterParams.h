@@ -75,8 +75,31 @@ struct MasterParams
     uint32_t maxTxFragSize = DEFAULT_MAX_APDU_SIZE;
 
     /// maximum APDU rx size in bytes
+    ///
+    /// Sizes well above the default (e.g. 64 KiB) reduce the number of fragments and confirms of large responses,
+    /// but only if the outstation's maxTxFragSize is raised to match.
     uint32_t maxRxFragSize = DEFAULT_MAX_APDU_SIZE;
 
+    /// Borrow the rx reassembly and tx request buffers from the manager's pool only while a fragment is
+    /// in flight instead of holding them for the lifetime of the master. Reduces the memory of idle sessions.
+    bool poolFragmentBuffers = false;
+
+    /// Keep a copy of the last reported value of every static point and only pass static values that changed
+    /// (value, flags or time quality) to the ISOEHandler. Events are always passed on and update the copy.
+    /// HeaderInfo::numUnchanged reports how many were suppressed.
+    bool suppressUnchangedStaticValues = false;
+
+    /// Decode measurement responses and call the ISOEHandler on a strand of the manager's thread pool instead of the
+    /// channel strand, so a large integrity response doesn't hold up I/O for the channel. Responses are still
+    /// delivered to the ISOEHandler one at a time and in the order they were received.
+    /// IMasterApplication::OnTaskComplete and the task callbacks are called once all the values of the task were
+    /// delivered.
+    bool decodeOnThreadPool = false;
+
+    /// With decodeOnThreadPool, the number of received fragments that may wait to be delivered. Beyond this the
+    /// master holds back application layer confirms until the ISOEHandler catches up.
+    uint32_t maxQueuedDecodeFragments = 8;
+
     /// Control how the master chooses what qualifier to send when making requests
     /// The default behavior is to always use two bytes, but the one byte optimization
     /// can be enabled
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_POLLPLANNERCONFIG_H
+#define OPENDNP3_POLLPLANNERCONFIG_H
+
+#include "opendnp3/util/TimeDuration.h"
+
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+ * Controls how the tasks of all masters sharing a channel (e.g. a multidrop line) are ordered.
+ *
+ * Only one master can have a request outstanding on the channel at a time. The defaults
+ * run each task at its scheduled time, which can leave the channel idle between polls.
+ */
+struct PollPlannerConfig
+{
+    PollPlannerConfig() = default;
+
+    PollPlannerConfig(TimeDuration lookahead, bool interleaveOutstations)
+        : lookahead(lookahead), interleaveOutstations(interleaveOutstations)
+    {
+    }
+
+    /// How far ahead of its scheduled time a periodic task may be started when the channel would otherwise be idle.
+    /// The next period of the task is measured from its early completion.
+    TimeDuration lookahead = TimeDuration::Zero();
+
+    /// When tasks of different masters are equally urgent, start the one whose master was served least recently
+    /// instead of the one that was scheduled first
+    bool interleaveOutstations = false;
+
+    /// Bytes per second that the adaptive scans of all masters on the channel may exchange, 0 for no limit.
+    /// Adaptive scans that exceed the budget have their period stretched until it has recovered.
+    uint32_t adaptiveScanBytesPerSecond = 0;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -23,6 +23,7 @@
 #include "opendnp3/gen/MasterTaskType.h"
 #include "opendnp3/gen/TaskCompletion.h"
 #include "opendnp3/master/TaskId.h"
+#include "opendnp3/util/TimeDuration.h"
 
 namespace opendnp3
 {
@@ -34,11 +35,16 @@ class TaskInfo
 {
 
 public:
-    TaskInfo(MasterTaskType type_, TaskCompletion result_, TaskId id_) : type(type_), result(result_), id(id_) {}
+    TaskInfo(MasterTaskType type_, TaskCompletion result_, TaskId id_, TimeDuration period_ = TimeDuration::Min())
+        : type(type_), result(result_), id(id_), period(period_)
+    {
+    }
 
     MasterTaskType type;
     TaskCompletion result;
     TaskId id;
+    // effective period of a recurring task after this completion, negative if the task isn't periodic
+    TimeDuration period;
 };
 
 } // namespace opendnp3
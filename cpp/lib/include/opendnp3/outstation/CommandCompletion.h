@@ -0,0 +1,64 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_COMMANDCOMPLETION_H
+#define OPENDNP3_COMMANDCOMPLETION_H
+
+#include "opendnp3/gen/CommandStatus.h"
+
+#include <functional>
+#include <memory>
+
+namespace opendnp3
+{
+
+/**
+ * Token handed to an IAsyncCommandHandler for each command it operates.
+ *
+ * The handler reports the result of the command by calling Complete exactly once, from any thread, at any
+ * time after the call to Operate. Copies of a token share their state, so only the first call to Complete
+ * on any of them has an effect.
+ */
+class CommandCompletion final
+{
+public:
+    using Callback = std::function<void(CommandStatus)>;
+
+    /// An empty token that ignores completion
+    CommandCompletion() = default;
+
+    explicit CommandCompletion(Callback callback);
+
+    /**
+     * Report the result of the command
+     *
+     * @param status the status returned to the master for this command
+     * @return true if this was the first completion of the command
+     */
+    bool Complete(CommandStatus status) const;
+
+private:
+    struct State;
+
+    std::shared_ptr<State> state;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -0,0 +1,173 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_IASYNCCOMMANDHANDLER_H
+#define OPENDNP3_IASYNCCOMMANDHANDLER_H
+
+#include "IUpdateHandler.h"
+
+#include "opendnp3/app/AnalogOutput.h"
+#include "opendnp3/app/ControlRelayOutputBlock.h"
+#include "opendnp3/gen/OperateType.h"
+#include "opendnp3/outstation/CommandCompletion.h"
+
+namespace opendnp3
+{
+
+/**
+ * Variant of ICommandHandler for applications whose commands complete asynchronously, e.g. because they are
+ * forwarded to field I/O or another process.
+ *
+ * Selects are answered synchronously as with ICommandHandler. An operate hands the handler a CommandCompletion
+ * instead of expecting a status. The outstation keeps processing confirms, timers and the other sessions of its
+ * channel while the commands are outstanding, and sends the response to the master once every command of the
+ * request has completed. Commands still outstanding after OutstationParams::commandResponseTimeout are answered
+ * with CommandStatus::TIMEOUT and their late completions are ignored.
+ *
+ * For DIRECT_OPERATE_NR requests nothing is sent back to the master, and the completions are ignored.
+ */
+class IAsyncCommandHandler
+{
+public:
+    virtual ~IAsyncCommandHandler() = default;
+
+    /**
+     * called when a command APDU begins processing
+     */
+    virtual void Begin() = 0;
+
+    /**
+     * called when every command of an APDU has been dispatched. Completions may still be outstanding.
+     */
+    virtual void End() = 0;
+
+    /**
+     * Ask if the application supports a ControlRelayOutputBlock - group 12 variation 1
+     *
+     * @param command command to select
+     * @param index index of the command
+     * @return result of request
+     */
+    virtual CommandStatus Select(const ControlRelayOutputBlock& command, uint16_t index) = 0;
+
+    /**
+     * Operate a ControlRelayOutputBlock - group 12 variation 1
+     *
+     * @param command command to operate
+     * @param index index of the command
+     * @param handler interface for loading measurement changes, only valid for the duration of the call.
+     *                Use IOutstation::Apply for changes made when the command completes.
+     * @param opType the operation type the outstation received.
+     * @param completion token used to report the result of the command
+     */
+    virtual void Operate(const ControlRelayOutputBlock& command,
+                         uint16_t index,
+                         IUpdateHandler& handler,
+                         OperateType opType,
+                         const CommandCompletion& completion)
+        = 0;
+
+    /**
+     * Ask if the application supports a 16 bit analog output - group 41 variation 2
+     *
+     * @param command command to select
+     * @param index index of the command
+     * @return result of request
+     */
+    virtual CommandStatus Select(const AnalogOutputInt16& command, uint16_t index) = 0;
+
+    /**
+     * Operate a 16 bit analog output - group 41 variation 2
+     *
+     * @see Operate(const ControlRelayOutputBlock&, uint16_t, IUpdateHandler&, OperateType, const CommandCompletion&)
+     */
+    virtual void Operate(const AnalogOutputInt16& command,
+                         uint16_t index,
+                         IUpdateHandler& handler,
+                         OperateType opType,
+                         const CommandCompletion& completion)
+        = 0;
+
+    /**
+     * Ask if the application supports a 32 bit analog output - group 41 variation 1
+     *
+     * @param command command to select
+     * @param index index of the command
+     * @return result of request
+     */
+    virtual CommandStatus Select(const AnalogOutputInt32& command, uint16_t index) = 0;
+
+    /**
+     * Operate a 32 bit analog output - group 41 variation 1
+     *
+     * @see Operate(const ControlRelayOutputBlock&, uint16_t, IUpdateHandler&, OperateType, const CommandCompletion&)
+     */
+    virtual void Operate(const AnalogOutputInt32& command,
+                         uint16_t index,
+                         IUpdateHandler& handler,
+                         OperateType opType,
+                         const CommandCompletion& completion)
+        = 0;
+
+    /**
+     * Ask if the application supports a single precision, floating point analog output - group 41 variation 3
+     *
+     * @param command command to select
+     * @param index index of the command
+     * @return result of request
+     */
+    virtual CommandStatus Select(const AnalogOutputFloat32& command, uint16_t index) = 0;
+
+    /**
+     * Operate a single precision, floating point analog output - group 41 variation 3
+     *
+     * @see Operate(const ControlRelayOutputBlock&, uint16_t, IUpdateHandler&, OperateType, const CommandCompletion&)
+     */
+    virtual void Operate(const AnalogOutputFloat32& command,
+                         uint16_t index,
+                         IUpdateHandler& handler,
+                         OperateType opType,
+                         const CommandCompletion& completion)
+        = 0;
+
+    /**
+     * Ask if the application supports a double precision, floating point analog output - group 41 variation 4
+     *
+     * @param command command to select
+     * @param index index of the command
+     * @return result of request
+     */
+    virtual CommandStatus Select(const AnalogOutputDouble64& command, uint16_t index) = 0;
+
+    /**
+     * Operate a double precision, floating point analog output - group 41 variation 4
+     *
+     * @see Operate(const ControlRelayOutputBlock&, uint16_t, IUpdateHandler&, OperateType, const CommandCompletion&)
+     */
+    virtual void Operate(const AnalogOutputDouble64& command,
+                         uint16_t index,
+                         IUpdateHandler& handler,
+                         OperateType opType,
+                         const CommandCompletion& completion)
+        = 0;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -24,6 +24,7 @@
 #include "opendnp3/app/ClassField.h"
 #include "opendnp3/outstation/NumRetries.h"
 #include "opendnp3/outstation/StaticTypeBitfield.h"
+#include "opendnp3/outstation/UnsolicitedBatchPolicy.h"
 #include "opendnp3/util/TimeDuration.h"
 
 namespace opendnp3
@@ -40,6 +41,10 @@ struct OutstationParams
     /// How long the outstation will allow an operate to proceed after a prior select
     TimeDuration selectTimeout = TimeDuration::Seconds(10);
 
+    /// How long the outstation waits for an IAsyncCommandHandler to complete the commands of a request before
+    /// answering the outstanding ones with TIMEOUT. Keep it below the response timeout of the master.
+    TimeDuration commandResponseTimeout = TimeDuration::Seconds(4);
+
     /// Timeout for solicited confirms
     TimeDuration solConfirmTimeout = DEFAULT_APP_TIMEOUT;
 
@@ -56,11 +61,17 @@ struct OutstationParams
     bool noDefferedReadDuringUnsolicitedNullResponse = false;
 
     /// The maximum fragment size the outstation will use for fragments it sends
+    ///
+    /// Sizes above the default of 2048 bytes are only understood by a master whose maxRxFragSize is at least as large
     uint32_t maxTxFragSize = DEFAULT_MAX_APDU_SIZE;
 
     /// The maximum fragment size the outstation will be able to receive
     uint32_t maxRxFragSize = DEFAULT_MAX_APDU_SIZE;
 
+    /// Borrow the rx reassembly and deferred request buffers from the manager's pool only while a fragment is
+    /// in flight instead of holding them for the lifetime of the outstation. Reduces the memory of idle sessions.
+    bool poolFragmentBuffers = false;
+
     /// Global enabled / disable for unsolicited messages. If false, the NULL unsolicited message is not even sent
     bool allowUnsolicited = false;
 
@@ -70,6 +81,14 @@ struct OutstationParams
     /// Class mask for unsolicted, default to 0 as unsolicited has to be enabled
     ClassField unsolClassMask = ClassField::None();
 
+    /// How events are coalesced into unsolicited responses. Defaults to reporting events immediately.
+    UnsolicitedBatchPolicy unsolBatchPolicy;
+
+    /// Report binary and double-bit events whose default variation has absolute time (2/2, 4/2) with relative time
+    /// (2/3, 4/3) instead. Events within 65535 ms of the first event of a header share its common time of occurrence
+    /// (51/1, 51/2), shrinking each event by 4 bytes. Reads of a specific variation are not affected.
+    bool useRelativeTimeEvents = false;
+
     /// If true, the outstation processes responds to any request/confirmation as if it came from the expected master
     /// address
     bool respondToAnyMaster = false;
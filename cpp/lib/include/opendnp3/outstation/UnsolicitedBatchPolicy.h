@@ -0,0 +1,90 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_UNSOLICITEDBATCHPOLICY_H
+#define OPENDNP3_UNSOLICITEDBATCHPOLICY_H
+
+#include "opendnp3/app/EventType.h"
+#include "opendnp3/util/TimeDuration.h"
+
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+ * Unsolicited reporting thresholds for a single event class
+ */
+struct UnsolicitedClassPolicy
+{
+    UnsolicitedClassPolicy() = default;
+
+    UnsolicitedClassPolicy(TimeDuration holdTime, uint32_t eventCount) : holdTime(holdTime), eventCount(eventCount) {}
+
+    /// Maximum time the oldest unreported event of the class is held back waiting for others.
+    /// Zero reports events as soon as they are available.
+    TimeDuration holdTime = TimeDuration::Zero();
+
+    /// Number of unreported events of the class that triggers a report before the hold time expires.
+    /// Zero disables the count trigger.
+    uint32_t eventCount = 0;
+};
+
+/**
+ * Controls how the outstation coalesces events into unsolicited responses.
+ *
+ * An unsolicited response is sent as soon as any enabled class reaches its hold time or event count,
+ * or when the pending events fill maxBytes of the fragment. The defaults report every event immediately.
+ */
+struct UnsolicitedBatchPolicy
+{
+    /// Hold every event class for up to holdTime, or until eventCount events of the class are pending
+    static UnsolicitedBatchPolicy AllClasses(TimeDuration holdTime, uint32_t eventCount, uint32_t maxBytes = 0)
+    {
+        UnsolicitedBatchPolicy policy;
+        policy.class1 = policy.class2 = policy.class3 = UnsolicitedClassPolicy(holdTime, eventCount);
+        policy.maxBytes = maxBytes;
+        return policy;
+    }
+
+    const UnsolicitedClassPolicy& Get(EventClass clazz) const
+    {
+        switch (clazz)
+        {
+        case (EventClass::EC1):
+            return class1;
+        case (EventClass::EC2):
+            return class2;
+        default:
+            return class3;
+        }
+    }
+
+    UnsolicitedClassPolicy class1;
+    UnsolicitedClassPolicy class2;
+    UnsolicitedClassPolicy class3;
+
+    /// Send as soon as the pending events encode to at least this many bytes. Zero disables the byte trigger.
+    /// Pending events that no longer fit in a single fragment are always sent.
+    uint32_t maxBytes = 0;
+};
+
+} // namespace opendnp3
+
+#endif
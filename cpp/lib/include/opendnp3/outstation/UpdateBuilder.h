@@ -23,9 +23,18 @@
 #include "opendnp3/outstation/IUpdateHandler.h"
 #include "opendnp3/outstation/Updates.h"
 
+#include <memory>
+#include <vector>
+
 namespace opendnp3
 {
 
+/**
+ * Builds a batch of updates to apply to an outstation.
+ *
+ * The storage of a batch is recycled by the next batches of the same builder once the outstation has applied it,
+ * so reusing one builder keeps applying updates free of heap allocations in the steady state.
+ */
 class UpdateBuilder final : public IUpdateHandler
 {
 
@@ -44,11 +53,13 @@ public:
     Updates Build();
 
 private:
-    template<class T> bool AddMeas(const T& meas, uint16_t index, EventMode mode);
+    // buffers kept for reuse once every Updates built from them is gone
+    static const size_t MAX_RECYCLED_BUFFERS = 4;
 
-    bool Add(const update_func_t& fun);
+    UpdateBuffer& GetBuffer();
 
-    std::shared_ptr<shared_updates_t> updates;
+    std::shared_ptr<UpdateBuffer> updates;
+    std::vector<std::shared_ptr<UpdateBuffer>> recycled;
 };
 
 } // namespace opendnp3
@@ -29,34 +29,29 @@
 namespace opendnp3
 {
 
-typedef std::function<void(IUpdateHandler&)> update_func_t;
-typedef std::vector<update_func_t> shared_updates_t;
+// Updates no longer store one function per value. These are kept for source compatibility only.
+using update_func_t [[deprecated("Updates no longer store update functions")]] = std::function<void(IUpdateHandler&)>;
+using shared_updates_t [[deprecated("Updates no longer store update functions")]]
+    = std::vector<std::function<void(IUpdateHandler&)>>;
 
+class UpdateBuffer;
+
+/**
+ * An immutable batch of updates produced by UpdateBuilder. Copies share the same storage.
+ */
 class Updates
 {
     friend class UpdateBuilder;
 
 public:
-    void Apply(IUpdateHandler& handler) const
-    {
-        if (!updates)
-            return;
-
-        for (auto& update : *updates)
-        {
-            update(handler);
-        }
-    }
+    void Apply(IUpdateHandler& handler) const;
 
-    bool IsEmpty() const
-    {
-        return updates ? updates->empty() : true;
-    }
+    bool IsEmpty() const;
 
 private:
-    Updates(std::shared_ptr<shared_updates_t> updates) : updates(std::move(updates)) {}
+    Updates(std::shared_ptr<const UpdateBuffer> updates) : updates(std::move(updates)) {}
 
-    const std::shared_ptr<shared_updates_t> updates;
+    std::shared_ptr<const UpdateBuffer> updates;
 };
 
 } // namespace opendnp3
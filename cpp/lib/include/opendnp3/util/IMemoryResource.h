@@ -0,0 +1,46 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_IMEMORYRESOURCE_H
+#define OPENDNP3_IMEMORYRESOURCE_H
+
+#include <cstddef>
+
+namespace opendnp3
+{
+
+/**
+ * Source of memory for the long-lived state of channels and stacks, modelled on std::pmr::memory_resource
+ *
+ * Implementations must be thread-safe. Stacks are created on user threads and free their memory on the thread pool.
+ */
+class IMemoryResource
+{
+public:
+    virtual ~IMemoryResource() = default;
+
+    /// @throw std::bad_alloc if the request can't be satisfied
+    virtual void* Allocate(std::size_t bytes, std::size_t alignment) = 0;
+
+    virtual void Deallocate(void* p, std::size_t bytes, std::size_t alignment) = 0;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_MONOTONICMEMORYRESOURCE_H
+#define OPENDNP3_MONOTONICMEMORYRESOURCE_H
+
+#include "opendnp3/util/IMemoryResource.h"
+#include "opendnp3/util/Uncopyable.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace opendnp3
+{
+
+/**
+ * Hands out memory from a single contiguous block and never reuses it, like std::pmr::monotonic_buffer_resource
+ * without an upstream resource. Requests that don't fit in the remaining space throw std::bad_alloc, so the
+ * capacity is a hard cap on the memory of everything created from it.
+ */
+class MonotonicMemoryResource final : public IMemoryResource, private Uncopyable
+{
+public:
+    explicit MonotonicMemoryResource(std::size_t capacity);
+
+    void* Allocate(std::size_t bytes, std::size_t alignment) override;
+
+    /// memory is only released when the resource is destroyed
+    void Deallocate(void* /*p*/, std::size_t /*bytes*/, std::size_t /*alignment*/) override {}
+
+    std::size_t Capacity() const
+    {
+        return capacity;
+    }
+
+    /// bytes handed out so far, including alignment padding
+    std::size_t NumAllocatedBytes() const;
+
+private:
+    const std::size_t capacity;
+    const std::unique_ptr<uint8_t[]> block;
+
+    mutable std::mutex mutex;
+    std::size_t offset = 0;
+};
+
+} // namespace opendnp3
+
+#endif
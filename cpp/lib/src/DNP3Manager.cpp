@@ -41,6 +41,11 @@ void DNP3Manager::Shutdown()
     impl->Shutdown();
 }
 
+void DNP3Manager::SetMemoryResource(std::shared_ptr<IMemoryResource> resource)
+{
+    impl->SetMemoryResource(std::move(resource));
+}
+
 std::shared_ptr<IChannel> DNP3Manager::AddTCPClient(const std::string& id,
                                                     const LogLevels& levels,
                                                     const ChannelRetry& retry,
@@ -79,6 +84,14 @@ std::shared_ptr<IChannel> DNP3Manager::AddSerial(const std::string& id,
     return this->impl->AddSerial(id, levels, retry, std::move(settings), std::move(listener));
 }
 
+std::shared_ptr<IChannel> DNP3Manager::AddLoopbackChannel(const std::string& id,
+                                                          const LogLevels& levels,
+                                                          const std::string& name,
+                                                          std::shared_ptr<IChannelListener> listener)
+{
+    return this->impl->AddLoopbackChannel(id, levels, name, std::move(listener));
+}
+
 std::shared_ptr<IChannel> DNP3Manager::AddTLSClient(const std::string& id,
                                                     const LogLevels& levels,
                                                     const ChannelRetry& retry,
@@ -108,6 +121,23 @@ std::shared_ptr<IListener> DNP3Manager::CreateListener(std::string loggerid,
     return impl->CreateListener(std::move(loggerid), loglevel, endpoint, callbacks);
 }
 
+std::shared_ptr<IListener> DNP3Manager::CreateListener(std::string loggerid,
+                                                       const LogLevels& loglevel,
+                                                       const IPEndpoint& endpoint,
+                                                       const ListenerConfig& config,
+                                                       const std::shared_ptr<IListenCallbacks>& callbacks)
+{
+    return impl->CreateListener(std::move(loggerid), loglevel, endpoint, config, callbacks);
+}
+
+std::shared_ptr<IListener> DNP3Manager::CreateUDPListener(std::string loggerid,
+                                                          const LogLevels& loglevel,
+                                                          const IPEndpoint& endpoint,
+                                                          const std::shared_ptr<IListenCallbacks>& callbacks)
+{
+    return impl->CreateUDPListener(std::move(loggerid), loglevel, endpoint, callbacks);
+}
+
 std::shared_ptr<IListener> DNP3Manager::CreateListener(std::string loggerid,
                                                        const LogLevels& loglevel,
                                                        const IPEndpoint& endpoint,
@@ -20,6 +20,7 @@
 
 #include "DNP3ManagerImpl.h"
 
+#include <algorithm>
 #include <utility>
 
 #ifdef OPENDNP3_USE_TLS
@@ -29,11 +30,14 @@
 #endif
 
 #include "channel/DNP3Channel.h"
+#include "channel/LoopbackIOHandler.h"
 #include "channel/SerialIOHandler.h"
+#include "channel/SingleThreadContext.h"
 #include "channel/TCPClientIOHandler.h"
 #include "channel/TCPServerIOHandler.h"
 #include "channel/UDPClientIOHandler.h"
 #include "master/MasterTCPServer.h"
+#include "master/MasterUDPServer.h"
 
 #include "opendnp3/ErrorCodes.h"
 #include "opendnp3/logging/LogLevels.h"
@@ -41,14 +45,31 @@
 namespace opendnp3
 {
 
+namespace
+{
+    std::shared_ptr<asio::io_context> CreateContext(uint32_t concurrencyHint)
+    {
+        // the thread pool always runs at least one thread
+        const auto numThreads = std::max<uint32_t>(concurrencyHint, 1);
+
+        auto io = std::make_shared<asio::io_context>(static_cast<int>(numThreads));
+        if (numThreads == 1)
+        {
+            SingleThreadContext::Mark(*io);
+        }
+        return io;
+    }
+} // namespace
+
 DNP3ManagerImpl::DNP3ManagerImpl(uint32_t concurrencyHint,
                                  std::shared_ptr<ILogHandler> handler,
                                  std::function<void(uint32_t)> onThreadStart,
                                  std::function<void(uint32_t)> onThreadExit)
     : logger(std::move(handler), ModuleId(), "manager", levels::ALL),
-      io(std::make_shared<asio::io_context>()),
+      io(CreateContext(concurrencyHint)),
       threadpool(io, concurrencyHint, std::move(onThreadStart), std::move(onThreadExit)),
-      resources(ResourceManager::Create())
+      resources(ResourceManager::Create()),
+      loopbacks(std::make_shared<LoopbackRegistry>())
 {
 }
 
@@ -66,6 +87,14 @@ void DNP3ManagerImpl::Shutdown()
     }
 }
 
+void DNP3ManagerImpl::SetMemoryResource(std::shared_ptr<IMemoryResource> resource)
+{
+    if (resources)
+    {
+        resources->SetMemoryResource(std::move(resource));
+    }
+}
+
 std::shared_ptr<IChannel> DNP3ManagerImpl::AddTCPClient(const std::string& id,
                                                         const LogLevels& levels,
                                                         const ChannelRetry& retry,
@@ -165,6 +194,28 @@ std::shared_ptr<IChannel> DNP3ManagerImpl::AddSerial(const std::string& id,
     return channel;
 }
 
+std::shared_ptr<IChannel> DNP3ManagerImpl::AddLoopbackChannel(const std::string& id,
+                                                              const LogLevels& levels,
+                                                              const std::string& name,
+                                                              std::shared_ptr<IChannelListener> listener)
+{
+    auto create = [&]() -> std::shared_ptr<IChannel> {
+        auto clogger = this->logger.detach(id, levels);
+        auto executor = exe4cpp::StrandExecutor::create(this->io);
+        auto iohandler = LoopbackIOHandler::Create(clogger, listener, executor, this->loopbacks, name);
+        return DNP3Channel::Create(clogger, executor, iohandler, this->resources);
+    };
+
+    auto channel = this->resources->Bind<IChannel>(create);
+
+    if (!channel)
+    {
+        throw DNP3Error(Error::SHUTTING_DOWN);
+    }
+
+    return channel;
+}
+
 std::shared_ptr<IChannel> DNP3ManagerImpl::AddTLSClient(const std::string& id,
                                                         const LogLevels& levels,
                                                         const ChannelRetry& retry,
@@ -234,11 +285,47 @@ std::shared_ptr<IListener> DNP3ManagerImpl::CreateListener(std::string loggerid,
                                                            const LogLevels& levels,
                                                            const IPEndpoint& endpoint,
                                                            const std::shared_ptr<IListenCallbacks>& callbacks)
+{
+    return this->CreateListener(std::move(loggerid), levels, endpoint, ListenerConfig(), callbacks);
+}
+
+std::shared_ptr<IListener> DNP3ManagerImpl::CreateListener(std::string loggerid,
+                                                           const LogLevels& levels,
+                                                           const IPEndpoint& endpoint,
+                                                           const ListenerConfig& config,
+                                                           const std::shared_ptr<IListenCallbacks>& callbacks)
 {
     auto create = [&]() -> std::shared_ptr<IListener> {
         std::error_code ec;
         auto server
             = MasterTCPServer::Create(this->logger.detach(loggerid, levels), exe4cpp::StrandExecutor::create(this->io),
+                                      endpoint, config, callbacks, this->resources, ec);
+        if (ec)
+        {
+            throw DNP3Error(Error::UNABLE_TO_BIND_SERVER, ec);
+        }
+        return server;
+    };
+
+    auto listener = this->resources->Bind<IListener>(create);
+
+    if (!listener)
+    {
+        throw DNP3Error(Error::SHUTTING_DOWN);
+    }
+
+    return listener;
+}
+
+std::shared_ptr<IListener> DNP3ManagerImpl::CreateUDPListener(std::string loggerid,
+                                                              const LogLevels& levels,
+                                                              const IPEndpoint& endpoint,
+                                                              const std::shared_ptr<IListenCallbacks>& callbacks)
+{
+    auto create = [&]() -> std::shared_ptr<IListener> {
+        std::error_code ec;
+        auto server
+            = MasterUDPServer::Create(this->logger.detach(loggerid, levels), exe4cpp::StrandExecutor::create(this->io),
                                       endpoint, callbacks, this->resources, ec);
         if (ec)
         {
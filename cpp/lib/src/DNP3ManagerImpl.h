@@ -22,12 +22,14 @@
 #define OPENDNP3_DNP3MANAGERIMPL_H
 
 #include "ResourceManager.h"
+#include "channel/LoopbackRegistry.h"
 
 #include "opendnp3/channel/ChannelRetry.h"
 #include "opendnp3/channel/IChannel.h"
 #include "opendnp3/channel/IChannelListener.h"
 #include "opendnp3/channel/IListener.h"
 #include "opendnp3/channel/IPEndpoint.h"
+#include "opendnp3/channel/ListenerConfig.h"
 #include "opendnp3/channel/SerialSettings.h"
 #include "opendnp3/channel/TLSConfig.h"
 #include "opendnp3/gen/ServerAcceptMode.h"
@@ -53,6 +55,8 @@ public:
 
     void Shutdown();
 
+    void SetMemoryResource(std::shared_ptr<IMemoryResource> resource);
+
     std::shared_ptr<IChannel> AddTCPClient(const std::string& id,
                                            const opendnp3::LogLevels& levels,
                                            const ChannelRetry& retry,
@@ -79,6 +83,11 @@ public:
                                         SerialSettings settings,
                                         std::shared_ptr<IChannelListener> listener);
 
+    std::shared_ptr<IChannel> AddLoopbackChannel(const std::string& id,
+                                                 const opendnp3::LogLevels& levels,
+                                                 const std::string& name,
+                                                 std::shared_ptr<IChannelListener> listener);
+
     std::shared_ptr<IChannel> AddTLSClient(const std::string& id,
                                            const opendnp3::LogLevels& levels,
                                            const ChannelRetry& retry,
@@ -99,6 +108,17 @@ public:
                                               const IPEndpoint& endpoint,
                                               const std::shared_ptr<IListenCallbacks>& callbacks);
 
+    std::shared_ptr<IListener> CreateListener(std::string loggerid,
+                                              const opendnp3::LogLevels& levels,
+                                              const IPEndpoint& endpoint,
+                                              const ListenerConfig& config,
+                                              const std::shared_ptr<IListenCallbacks>& callbacks);
+
+    std::shared_ptr<IListener> CreateUDPListener(std::string loggerid,
+                                                 const opendnp3::LogLevels& levels,
+                                                 const IPEndpoint& endpoint,
+                                                 const std::shared_ptr<IListenCallbacks>& callbacks);
+
     std::shared_ptr<IListener> CreateListener(std::string loggerid,
                                               const opendnp3::LogLevels& levels,
                                               const IPEndpoint& endpoint,
@@ -110,6 +130,7 @@ private:
     const std::shared_ptr<asio::io_context> io;
     exe4cpp::ThreadPool threadpool;
     std::shared_ptr<ResourceManager> resources;
+    const std::shared_ptr<LoopbackRegistry> loopbacks;
 };
 
 } // namespace opendnp3
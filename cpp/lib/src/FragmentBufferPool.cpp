@@ -0,0 +1,105 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "FragmentBufferPool.h"
+
+#include <utility>
+
+namespace opendnp3
+{
+
+FragmentBufferPool::FragmentBufferPool(size_t maxRetainedBytes) : maxRetainedBytes(maxRetainedBytes) {}
+
+std::unique_ptr<uint8_t[]> FragmentBufferPool::Borrow(size_t size)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    this->numBorrowedBytes += size;
+
+    auto iter = this->freeLists.find(size);
+    if (iter != this->freeLists.end() && !iter->second.empty())
+    {
+        auto block = std::move(iter->second.back());
+        iter->second.pop_back();
+        this->numRetainedBytes -= size;
+        return block;
+    }
+
+    return std::unique_ptr<uint8_t[]>(new uint8_t[size]);
+}
+
+void FragmentBufferPool::Return(std::unique_ptr<uint8_t[]> block, size_t size)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    this->numBorrowedBytes -= size;
+
+    if (this->numRetainedBytes + size <= this->maxRetainedBytes)
+    {
+        this->freeLists[size].push_back(std::move(block));
+        this->numRetainedBytes += size;
+    }
+}
+
+size_t FragmentBufferPool::NumBorrowedBytes()
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->numBorrowedBytes;
+}
+
+size_t FragmentBufferPool::NumRetainedBytes()
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->numRetainedBytes;
+}
+
+FragmentBuffer::FragmentBuffer(uint32_t size, std::shared_ptr<FragmentBufferPool> pool)
+    : size(size),
+      pool(std::move(pool)),
+      owned(this->pool ? 0 : size),
+      data(this->pool ? nullptr : this->owned.data())
+{
+}
+
+FragmentBuffer::~FragmentBuffer()
+{
+    this->Release();
+}
+
+ser4cpp::wseq_t FragmentBuffer::as_wslice()
+{
+    if (!this->data)
+    {
+        this->borrowed = this->pool->Borrow(this->size);
+        this->data = this->borrowed.get();
+    }
+
+    return ser4cpp::wseq_t(this->data, this->size);
+}
+
+void FragmentBuffer::Release()
+{
+    if (this->pool && this->data)
+    {
+        this->pool->Return(std::move(this->borrowed), this->size);
+        this->data = nullptr;
+    }
+}
+
+} // namespace opendnp3
@@ -0,0 +1,122 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_FRAGMENTBUFFERPOOL_H
+#define OPENDNP3_FRAGMENTBUFFERPOOL_H
+
+#include "MemoryAccount.h"
+
+#include "opendnp3/util/Uncopyable.h"
+
+#include <ser4cpp/container/SequenceTypes.h>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+ * Manager-wide pool of fragment sized buffers. Stacks borrow from it only while a fragment is in flight,
+ * so that idle sessions don't each hold their own reassembly and request buffers.
+ *
+ * Thread-safe: stacks on different strands borrow and return concurrently.
+ */
+class FragmentBufferPool final : private Uncopyable
+{
+public:
+    /// upper bound on the bytes kept in the free lists, anything beyond goes back to the heap
+    static const size_t DEFAULT_MAX_RETAINED_BYTES = 4 * 1024 * 1024;
+
+    explicit FragmentBufferPool(size_t maxRetainedBytes = DEFAULT_MAX_RETAINED_BYTES);
+
+    std::unique_ptr<uint8_t[]> Borrow(size_t size);
+
+    void Return(std::unique_ptr<uint8_t[]> block, size_t size);
+
+    /// bytes currently lent out to stacks
+    size_t NumBorrowedBytes();
+
+    /// bytes sitting in the free lists
+    size_t NumRetainedBytes();
+
+private:
+    const size_t maxRetainedBytes;
+
+    std::mutex mutex;
+    size_t numBorrowedBytes = 0;
+    size_t numRetainedBytes = 0;
+    std::map<size_t, std::vector<std::unique_ptr<uint8_t[]>>> freeLists;
+};
+
+/**
+ * A fixed size buffer that is either allocated for its whole lifetime (no pool) or
+ * borrowed from a FragmentBufferPool when first written and returned on Release().
+ *
+ * Buffers allocated for their whole lifetime come from the memory resource in scope when they are created.
+ */
+class FragmentBuffer final : private Uncopyable
+{
+public:
+    FragmentBuffer(uint32_t size, std::shared_ptr<FragmentBufferPool> pool);
+
+    ~FragmentBuffer();
+
+    /// borrows the memory from the pool if it isn't already held
+    ser4cpp::wseq_t as_wslice();
+
+    /// only valid while the memory is held
+    ser4cpp::rseq_t as_rslice() const
+    {
+        return ser4cpp::rseq_t(data, data ? size : 0);
+    }
+
+    uint32_t length() const
+    {
+        return size;
+    }
+
+    /// return the memory to the pool, no-op if the buffer isn't pooled
+    void Release();
+
+    bool IsPooled() const
+    {
+        return static_cast<bool>(pool);
+    }
+
+    /// bytes currently held by this buffer
+    uint32_t NumHeldBytes() const
+    {
+        return data ? size : 0;
+    }
+
+private:
+    const uint32_t size;
+    const std::shared_ptr<FragmentBufferPool> pool;
+    std::vector<uint8_t, ResourceAllocator<uint8_t>> owned;
+    std::unique_ptr<uint8_t[]> borrowed;
+    uint8_t* data;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -20,6 +20,8 @@
 #ifndef OPENDNP3_IRESOURCEMANAGER_H
 #define OPENDNP3_IRESOURCEMANAGER_H
 
+#include "FragmentBufferPool.h"
+
 #include "opendnp3/IResource.h"
 
 #include <memory>
@@ -36,6 +38,9 @@ public:
     /// notify the handler that the resource is shutting down, and it doesn't
     /// have to track it anymore
     virtual void Detach(const std::shared_ptr<IResource>& resource) = 0;
+
+    /// buffer pool shared by all the stacks of the manager
+    virtual std::shared_ptr<FragmentBufferPool> GetBufferPool() = 0;
 };
 
 } // namespace opendnp3
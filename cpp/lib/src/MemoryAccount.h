@@ -0,0 +1,141 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_MEMORYACCOUNT_H
+#define OPENDNP3_MEMORYACCOUNT_H
+
+#include "opendnp3/util/IMemoryResource.h"
+#include "opendnp3/util/Uncopyable.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+namespace opendnp3
+{
+
+/**
+ * The memory resource of one stack (or channel), counting the bytes it currently has allocated from it
+ */
+class MemoryAccount final : private Uncopyable
+{
+public:
+    explicit MemoryAccount(std::shared_ptr<IMemoryResource> resource) : resource(std::move(resource)) {}
+
+    static std::shared_ptr<MemoryAccount> Create(const std::shared_ptr<IMemoryResource>& resource)
+    {
+        return resource ? std::make_shared<MemoryAccount>(resource) : nullptr;
+    }
+
+    void* Allocate(std::size_t bytes, std::size_t alignment)
+    {
+        auto ret = this->resource->Allocate(bytes, alignment);
+        this->numAllocatedBytes += bytes;
+        return ret;
+    }
+
+    void Deallocate(void* p, std::size_t bytes, std::size_t alignment)
+    {
+        this->resource->Deallocate(p, bytes, alignment);
+        this->numAllocatedBytes -= bytes;
+    }
+
+    std::size_t NumAllocatedBytes() const
+    {
+        return numAllocatedBytes;
+    }
+
+    const std::shared_ptr<IMemoryResource>& GetResource() const
+    {
+        return resource;
+    }
+
+private:
+    const std::shared_ptr<IMemoryResource> resource;
+    std::atomic<std::size_t> numAllocatedBytes{0};
+};
+
+/**
+ * Makes an account the source of memory for every ResourceAllocator constructed on this thread while the scope
+ * is alive. A null account means the global heap.
+ */
+class MemoryScope final : private Uncopyable
+{
+public:
+    explicit MemoryScope(std::shared_ptr<MemoryAccount> account);
+
+    ~MemoryScope();
+
+    static std::shared_ptr<MemoryAccount> Current();
+
+private:
+    std::shared_ptr<MemoryAccount> previous;
+};
+
+/**
+ * Standard allocator drawing from the account that was in scope when it was constructed. Containers and
+ * std::allocate_shared keep a copy, so memory that a container acquires later comes from the same account.
+ */
+template<class T> class ResourceAllocator
+{
+    template<class U> friend class ResourceAllocator;
+
+public:
+    using value_type = T;
+
+    ResourceAllocator() : account(MemoryScope::Current()) {}
+
+    template<class U> ResourceAllocator(const ResourceAllocator<U>& other) : account(other.account) {}
+
+    T* allocate(std::size_t n)
+    {
+        const auto bytes = n * sizeof(T);
+        return static_cast<T*>(account ? account->Allocate(bytes, alignof(T)) : ::operator new(bytes));
+    }
+
+    void deallocate(T* p, std::size_t n)
+    {
+        if (account)
+        {
+            account->Deallocate(p, n * sizeof(T), alignof(T));
+        }
+        else
+        {
+            ::operator delete(p);
+        }
+    }
+
+    template<class U> bool operator==(const ResourceAllocator<U>& other) const
+    {
+        return account == other.account;
+    }
+
+    template<class U> bool operator!=(const ResourceAllocator<U>& other) const
+    {
+        return account != other.account;
+    }
+
+private:
+    std::shared_ptr<MemoryAccount> account;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_POSTEDACTION_H
+#define OPENDNP3_POSTEDACTION_H
+
+#include "opendnp3/util/Uncopyable.h"
+
+#include <exe4cpp/IExecutor.h>
+
+#include <functional>
+#include <memory>
+
+namespace opendnp3
+{
+
+/**
+ * An action that is posted to an executor over and over without allocating.
+ *
+ * A posted lambda is heap allocated by std::function whenever its captures aren't trivially copyable, e.g. a
+ * shared_ptr keeping the target alive. The std::function posted here only references this object, so it is
+ * always stored inline. The target is instead kept alive by a reference held here until the action runs, so at
+ * most one post can be pending at a time, and an executor that discards the action without running it leaks the
+ * target.
+ *
+ * Post() and the action must be serialized, either by running on the same strand or by a lock of the owner.
+ */
+template<class T> class PostedAction final : private Uncopyable
+{
+public:
+    using function_t = void (*)(T& target);
+
+    explicit PostedAction(function_t function) : function(function), action(std::ref(*this)) {}
+
+    // returns false, without posting, if the action is already pending
+    bool Post(exe4cpp::IExecutor& executor, std::shared_ptr<T> target)
+    {
+        if (this->target)
+        {
+            return false;
+        }
+
+        this->target = std::move(target);
+        executor.post(this->action);
+        return true;
+    }
+
+    bool IsPending() const
+    {
+        return static_cast<bool>(this->target);
+    }
+
+    void operator()()
+    {
+        // released when the call returns, so the target can't be destroyed while it runs
+        const auto target = std::move(this->target);
+        this->function(*target);
+    }
+
+private:
+    const function_t function;
+    std::shared_ptr<T> target;
+    const std::function<void()> action;
+};
+
+} // namespace opendnp3
+
+#endif
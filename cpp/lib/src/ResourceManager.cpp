@@ -29,6 +29,12 @@ void ResourceManager::Detach(const std::shared_ptr<IResource>& resource)
     this->resources.erase(resource);
 }
 
+void ResourceManager::SetMemoryResource(std::shared_ptr<IMemoryResource> resource)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->memoryResource = std::move(resource);
+}
+
 void ResourceManager::Shutdown()
 {
     std::set<std::shared_ptr<IResource>> copy;
@@ -21,6 +21,7 @@
 #define OPENDNP3_RESOURCEMANAGER_H
 
 #include "IResourceManager.h"
+#include "MemoryAccount.h"
 
 #include <memory>
 #include <mutex>
@@ -40,6 +41,13 @@ public:
 
     void Detach(const std::shared_ptr<IResource>& resource) final;
 
+    std::shared_ptr<FragmentBufferPool> GetBufferPool() final
+    {
+        return this->bufferPool;
+    }
+
+    void SetMemoryResource(std::shared_ptr<IMemoryResource> resource);
+
     void Shutdown();
 
     template<class R, class T> std::shared_ptr<R> Bind(const T& create)
@@ -52,6 +60,9 @@ public:
         }
         else
         {
+            // whatever is created keeps drawing its long-lived state from the memory resource, if there is one
+            MemoryScope scope(this->memoryResource ? std::make_shared<MemoryAccount>(this->memoryResource)
+                                                   : MemoryScope::Current());
             auto item = create();
             if (item)
             {
@@ -65,6 +76,8 @@ private:
     std::mutex mutex;
     bool is_shutting_down = false;
     std::set<std::shared_ptr<IResource>> resources;
+    std::shared_ptr<IMemoryResource> memoryResource;
+    const std::shared_ptr<FragmentBufferPool> bufferPool = std::make_shared<FragmentBufferPool>();
 };
 
 } // namespace opendnp3
@@ -21,6 +21,7 @@
 #define OPENDNP3_STACKBASE_H
 
 #include "IResourceManager.h"
+#include "MemoryAccount.h"
 #include "channel/IOHandler.h"
 #include "transport/TransportStack.h"
 
@@ -44,18 +45,26 @@ protected:
               const std::shared_ptr<IOHandler>& iohandler,
               const std::shared_ptr<IResourceManager>& manager,
               uint32_t maxRxFragSize,
-              const LinkLayerConfig& config)
+              const LinkLayerConfig& config,
+              const std::shared_ptr<FragmentBufferPool>& pool)
         : logger(logger),
           executor(executor),
           iohandler(iohandler),
           manager(manager),
-          tstack(logger, executor, listener, maxRxFragSize, config)
+          account(MemoryScope::Current()),
+          tstack(logger, executor, listener, maxRxFragSize, config, pool)
     {
     }
 
     StackStatistics CreateStatistics() const
     {
-        return StackStatistics(tstack.link->GetStatistics(), tstack.transport->GetStatistics());
+        StackStatistics::Memory memory;
+        tstack.RecordMemory(memory);
+        if (this->account)
+        {
+            memory.numResourceBytes = this->account->NumAllocatedBytes();
+        }
+        return StackStatistics(tstack.link->GetStatistics(), tstack.transport->GetStatistics(), memory);
     }
 
     template<class T> void PerformShutdown(const std::shared_ptr<T>& self);
@@ -64,6 +73,8 @@ protected:
     const std::shared_ptr<exe4cpp::StrandExecutor> executor;
     const std::shared_ptr<IOHandler> iohandler;
     const std::shared_ptr<IResourceManager> manager;
+    // the memory resource account the stack was created in, if any
+    const std::shared_ptr<MemoryAccount> account;
     TransportStack tstack;
 };
 
@@ -20,8 +20,12 @@
 #ifndef OPENDNP3_BITFIELDRANGEWRITEITERATOR_H
 #define OPENDNP3_BITFIELDRANGEWRITEITERATOR_H
 
+#include "app/PackedBits.h"
+
 #include <ser4cpp/serialization/LittleEndian.h>
 
+#include <algorithm>
+
 namespace opendnp3
 {
 
@@ -47,7 +51,8 @@ public:
         {
             IndexType::write_to(range, start_);
             pPosition->advance(2 * IndexType::size);
-            maxCount = pPosition->length() * 8;
+            // large fragments hold more bits than the stop index can address
+            maxCount = std::min<size_t>(pPosition->length() * 8, size_t(IndexType::max_value) - start_ + 1);
         }
     }
 
@@ -55,7 +60,7 @@ public:
     {
         if (isValid && count > 0)
         {
-            typename IndexType::type_t stop = start + count - 1;
+            const auto stop = static_cast<typename IndexType::type_t>(start + count - 1);
             IndexType::write_to(range, stop);
 
             auto num = count / 8;
@@ -95,6 +100,46 @@ public:
         }
     }
 
+    // write as many bits of a packed array as fit, a word at a time, returns the number written
+    size_t Write(const PackedBits& bits, size_t first, size_t num)
+    {
+        if (!isValid)
+        {
+            return 0;
+        }
+
+        num = std::min(num, maxCount - count);
+
+        if ((count % 8) != 0)
+        {
+            // the destination isn't byte aligned, so there is nothing to gain over single bits
+            for (size_t i = 0; i < num; ++i)
+            {
+                this->Write(bits.get(first + i));
+            }
+            return num;
+        }
+
+        for (size_t i = 0; i < num; i += 64)
+        {
+            const auto num_bits = std::min<size_t>(64, num - i);
+            auto word = bits.read_word(first + i);
+            if (num_bits < 64)
+            {
+                word &= (uint64_t(1) << num_bits) - 1;
+            }
+
+            const auto byte = (count + i) / 8;
+            for (size_t j = 0; j < (num_bits + 7) / 8; ++j)
+            {
+                (*pPosition)[byte + j] = static_cast<uint8_t>(word >> (8 * j));
+            }
+        }
+
+        count += static_cast<uint32_t>(num);
+        return num;
+    }
+
     bool IsValid() const
     {
         return isValid;
@@ -102,7 +147,7 @@ public:
 
 private:
     typename IndexType::type_t start;
-    typename IndexType::type_t count;
+    uint32_t count;
 
     size_t maxCount;
 
@@ -30,6 +30,8 @@ namespace opendnp3
 template<class T> class DNP3Serializer : public Serializer<T>
 {
 public:
+    DNP3Serializer() = default;
+
     DNP3Serializer(GroupVariationID id,
                    size_t size,
                    typename Serializer<T>::read_func_t read_func,
@@ -34,6 +34,8 @@
 #include <ser4cpp/container/Settable.h>
 #include <ser4cpp/serialization/LittleEndian.h>
 
+#include <algorithm>
+
 namespace opendnp3
 {
 
@@ -59,6 +61,14 @@ public:
     template<class IndexType>
     bool WriteCountHeader(QualifierCode qc, GroupVariationID gvId, typename IndexType::type_t count);
 
+    // writes a range header followed by as many of the pre-encoded objects as fit, returns the number written
+    template<class IndexType>
+    size_t WriteEncodedRange(QualifierCode qc,
+                             GroupVariationID gvId,
+                             typename IndexType::type_t start,
+                             size_t objectSize,
+                             const ser4cpp::rseq_t& objects);
+
     template<class CountType, class WriteType>
     CountWriteIterator<CountType, WriteType> IterateOverCount(QualifierCode qc,
                                                               const DNP3Serializer<WriteType>& serializer);
@@ -137,6 +147,28 @@ bool HeaderWriter::WriteCountHeader(QualifierCode qc, GroupVariationID gvId, typ
     }
 }
 
+template<class IndexType>
+size_t HeaderWriter::WriteEncodedRange(QualifierCode qc,
+                                       GroupVariationID gvId,
+                                       typename IndexType::type_t start,
+                                       size_t objectSize,
+                                       const ser4cpp::rseq_t& objects)
+{
+    if (!WriteHeaderWithReserve(gvId, qc, 2 * IndexType::size + objectSize))
+    {
+        return 0;
+    }
+
+    const size_t maxByIndex = IndexType::max_value - start + 1;
+    const size_t maxBySpace = (position->length() - 2 * IndexType::size) / objectSize;
+    const auto count = std::min(objects.length() / objectSize, std::min(maxByIndex, maxBySpace));
+
+    IndexType::write_to(*position, start);
+    IndexType::write_to(*position, static_cast<typename IndexType::type_t>(start + count - 1));
+    position->copy_from(objects.take(count * objectSize));
+    return count;
+}
+
 template<class CountType, class ValueType>
 bool HeaderWriter::WriteSingleValue(QualifierCode qc,
                                     const DNP3Serializer<ValueType>& serializer,
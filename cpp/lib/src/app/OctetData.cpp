@@ -19,45 +19,90 @@
  */
 #include "opendnp3/app/OctetData.h"
 
-#include <ser4cpp/container/SequenceTypes.h>
-#include <ser4cpp/util/Comparisons.h>
+#include "app/OctetStringPool.h"
 
 #include <cstring>
 
 namespace opendnp3
 {
 
+namespace
+{
+    const uint8_t DEFAULT_VALUE[1] = {0x00};
+}
+
 OctetData::OctetData() : size(1) {}
 
 OctetData::OctetData(const char* input) : OctetData(ToSlice(input)) {}
 
-OctetData::OctetData(const Buffer& input)
-    : size(input.length == 0 ? 1 : ser4cpp::min<uint8_t>(MAX_SIZE, static_cast<uint8_t>(input.length)))
+OctetData::OctetData(const Buffer& input) : size(1)
+{
+    if (input.length > 0)
+    {
+        this->Assign(input.data, input.length > MAX_SIZE ? MAX_SIZE : static_cast<uint8_t>(input.length));
+    }
+}
+
+OctetData::OctetData(const OctetData& other) : block(other.block), size(other.size)
+{
+    if (this->block)
+    {
+        this->block->Retain();
+    }
+}
+
+OctetData::OctetData(OctetData&& other) noexcept : block(other.block), size(other.size)
+{
+    other.block = nullptr;
+    other.size = 1;
+}
+
+OctetData& OctetData::operator=(const OctetData& other)
+{
+    if (this != &other)
+    {
+        if (other.block)
+        {
+            other.block->Retain();
+        }
+        this->Reset();
+        this->block = other.block;
+        this->size = other.size;
+    }
+    return *this;
+}
+
+OctetData& OctetData::operator=(OctetData&& other) noexcept
 {
-    ser4cpp::rseq_t input_slice(input.data, input.length);
-    if (input_slice.is_not_empty())
+    if (this != &other)
     {
-        ser4cpp::wseq_t dest(buffer.data(), buffer.size());
-        dest.copy_from(input_slice.take(size));
+        this->Reset();
+        this->block = other.block;
+        this->size = other.size;
+        other.block = nullptr;
+        other.size = 1;
     }
+    return *this;
+}
+
+OctetData::~OctetData()
+{
+    this->Reset();
 }
 
 bool OctetData::Set(const Buffer& input)
 {
-    ser4cpp::rseq_t input_slice(input.data, input.length);
-    if (input_slice.is_empty())
+    if (input.length == 0)
     {
+        this->Reset();
         this->size = 0;
-        this->buffer[0] = 0x00;
         return false;
     }
 
-    const bool is_oversized = input_slice.length() > MAX_SIZE;
-    const uint8_t usable_size = is_oversized ? MAX_SIZE : static_cast<uint8_t>(input_slice.length());
+    const bool is_oversized = input.length > MAX_SIZE;
+    const uint8_t usable_size = is_oversized ? MAX_SIZE : static_cast<uint8_t>(input.length);
 
-    ser4cpp::wseq_t dest(buffer.data(), buffer.size());
-    dest.copy_from(input_slice.take(usable_size));
-    this->size = usable_size;
+    this->Assign(input.data, usable_size);
     return !is_oversized;
 }
 
@@ -69,7 +114,7 @@ bool OctetData::Set(const char* input)
 
 const Buffer OctetData::ToBuffer() const
 {
-    return Buffer(buffer.data(), size);
+    return Buffer(this->block ? this->block->Data() : DEFAULT_VALUE, size);
 }
 
 const Buffer OctetData::ToSlice(const char* input)
@@ -80,4 +125,29 @@ const Buffer OctetData::ToSlice(const char* input)
     return Buffer(reinterpret_cast<const uint8_t*>(input), length > MAX_SIZE ? MAX_SIZE : length);
 }
 
+void OctetData::Assign(const uint8_t* data, uint8_t length)
+{
+    // the block is only written in place while this value is its sole owner and it's of the right size class
+    const bool reuse = this->block && !this->block->IsShared()
+        && (this->block->Capacity() == OctetStringPool::CapacityFor(length));
+
+    if (!reuse)
+    {
+        this->Reset();
+        this->block = OctetStringPool::Allocate(length);
+    }
+
+    std::memcpy(this->block->Data(), data, length);
+    this->size = length;
+}
+
+void OctetData::Reset()
+{
+    if (this->block)
+    {
+        this->block->Release();
+        this->block = nullptr;
+    }
+}
+
 } // namespace opendnp3
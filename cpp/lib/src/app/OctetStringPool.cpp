@@ -0,0 +1,165 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "app/OctetStringPool.h"
+
+#include <array>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace opendnp3
+{
+
+namespace
+{
+    // capacity of the blocks in each size class, the last one holds the largest octet string
+    const size_t NUM_SIZE_CLASSES = 6;
+    const uint8_t CAPACITIES[NUM_SIZE_CLASSES] = {8, 16, 32, 64, 128, 255};
+
+    // memory carved into blocks at a time
+    const size_t SLAB_SIZE = 4096;
+
+    size_t BlockSize(size_t sizeClass)
+    {
+        const size_t size = sizeof(OctetBlock) + CAPACITIES[sizeClass];
+        // keep the following block, and the free list link in the data of a free block, aligned
+        return (size + alignof(void*) - 1) & ~(alignof(void*) - 1);
+    }
+
+    uint8_t SizeClassOf(uint8_t size)
+    {
+        uint8_t sizeClass = 0;
+        while (CAPACITIES[sizeClass] < size)
+        {
+            ++sizeClass;
+        }
+        return sizeClass;
+    }
+
+    static_assert(sizeof(OctetBlock) % alignof(void*) == 0, "the data of a block must be pointer aligned");
+
+    struct SizeClass
+    {
+        std::mutex mutex;
+        // free blocks are linked through their data
+        void* freeList = nullptr;
+        std::vector<void*> slabs;
+        size_t numUsed = 0;
+    };
+
+    struct Pool
+    {
+        std::array<SizeClass, NUM_SIZE_CLASSES> classes;
+    };
+
+    Pool& GetPool()
+    {
+        // never destroyed, so values in static storage can still be released during exit
+        static Pool* pool = new Pool();
+        return *pool;
+    }
+} // namespace
+
+uint8_t OctetBlock::Capacity() const
+{
+    return CAPACITIES[this->sizeClass];
+}
+
+void OctetBlock::Release()
+{
+    if (refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        OctetStringPool::Free(this);
+    }
+}
+
+OctetBlock* OctetStringPool::Allocate(uint8_t size)
+{
+    const auto sizeClass = SizeClassOf(size);
+    auto& entry = GetPool().classes[sizeClass];
+
+    void* memory = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(entry.mutex);
+
+        if (!entry.freeList)
+        {
+            const auto blockSize = BlockSize(sizeClass);
+            auto slab = static_cast<uint8_t*>(::operator new(SLAB_SIZE));
+            entry.slabs.push_back(slab);
+
+            for (size_t offset = 0; offset + blockSize <= SLAB_SIZE; offset += blockSize)
+            {
+                auto block = slab + offset;
+                *reinterpret_cast<void**>(block + sizeof(OctetBlock)) = entry.freeList;
+                entry.freeList = block;
+            }
+        }
+
+        memory = entry.freeList;
+        entry.freeList = *reinterpret_cast<void**>(static_cast<uint8_t*>(memory) + sizeof(OctetBlock));
+        ++entry.numUsed;
+    }
+
+    return new (memory) OctetBlock(sizeClass);
+}
+
+void OctetStringPool::Free(OctetBlock* block)
+{
+    auto& entry = GetPool().classes[block->sizeClass];
+    block->~OctetBlock();
+
+    std::lock_guard<std::mutex> lock(entry.mutex);
+    *reinterpret_cast<void**>(reinterpret_cast<uint8_t*>(block) + sizeof(OctetBlock)) = entry.freeList;
+    entry.freeList = block;
+    --entry.numUsed;
+}
+
+uint8_t OctetStringPool::CapacityFor(uint8_t size)
+{
+    return CAPACITIES[SizeClassOf(size)];
+}
+
+size_t OctetStringPool::NumReservedBytes()
+{
+    size_t total = 0;
+    for (auto& entry : GetPool().classes)
+    {
+        std::lock_guard<std::mutex> lock(entry.mutex);
+        total += entry.slabs.size() * SLAB_SIZE;
+    }
+    return total;
+}
+
+size_t OctetStringPool::NumUsedBytes()
+{
+    size_t total = 0;
+    for (size_t i = 0; i < NUM_SIZE_CLASSES; ++i)
+    {
+        auto& entry = GetPool().classes[i];
+        std::lock_guard<std::mutex> lock(entry.mutex);
+        total += entry.numUsed * BlockSize(i);
+    }
+    return total;
+}
+
+} // namespace opendnp3
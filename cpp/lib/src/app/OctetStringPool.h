@@ -0,0 +1,107 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_OCTETSTRINGPOOL_H
+#define OPENDNP3_OCTETSTRINGPOOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+ * Reference counted storage for the bytes of an OctetData value, carved from a slab of the OctetStringPool.
+ *
+ * Copies of a value share the block. A block is only written while a single value references it.
+ */
+class OctetBlock final
+{
+    friend class OctetStringPool;
+
+public:
+    OctetBlock(const OctetBlock&) = delete;
+    OctetBlock& operator=(const OctetBlock&) = delete;
+
+    uint8_t* Data()
+    {
+        return reinterpret_cast<uint8_t*>(this + 1);
+    }
+
+    const uint8_t* Data() const
+    {
+        return reinterpret_cast<const uint8_t*>(this + 1);
+    }
+
+    uint8_t Capacity() const;
+
+    bool IsShared() const
+    {
+        return refs.load(std::memory_order_acquire) > 1;
+    }
+
+    void Retain()
+    {
+        refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// drop a reference, returning the block to the pool with the last one
+    void Release();
+
+private:
+    OctetBlock(uint8_t sizeClass) : refs(1), sizeClass(sizeClass) {}
+
+    std::atomic<uint32_t> refs;
+    const uint8_t sizeClass;
+};
+
+/**
+ * Process-wide slab pool of OctetBlocks in a few size classes, so that octet strings only use memory in
+ * proportion to their length instead of reserving the maximum of 255 bytes.
+ *
+ * Slabs are never returned to the heap. Freed blocks are recycled through a free list per size class, so
+ * the pool settles at the high water mark of each class. Thread-safe.
+ */
+class OctetStringPool final
+{
+public:
+    OctetStringPool() = delete;
+
+    /// allocate a block holding at least 'size' bytes with a single reference
+    static OctetBlock* Allocate(uint8_t size);
+
+    /// capacity of the blocks allocated for 'size' bytes
+    static uint8_t CapacityFor(uint8_t size);
+
+    /// bytes of the slabs allocated so far
+    static size_t NumReservedBytes();
+
+    /// bytes of the blocks currently referenced by values
+    static size_t NumUsedBytes();
+
+private:
+    friend class OctetBlock;
+
+    static void Free(OctetBlock* block);
+};
+
+} // namespace opendnp3
+
+#endif
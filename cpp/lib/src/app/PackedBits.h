@@ -0,0 +1,97 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_PACKEDBITS_H
+#define OPENDNP3_PACKEDBITS_H
+
+#include "MemoryAccount.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+ * A fixed size array of bits packed into 64-bit words, least significant bit first.
+ *
+ * Any bits past the size of the array are kept at zero.
+ */
+class PackedBits
+{
+public:
+    // resize the array, all bits are cleared
+    void resize(size_t num_bits)
+    {
+        this->num_bits = num_bits;
+        this->words.assign((num_bits + 63) / 64, 0);
+    }
+
+    size_t size() const
+    {
+        return this->num_bits;
+    }
+
+    bool get(size_t bit) const
+    {
+        return (this->words[bit / 64] >> (bit % 64)) & 1;
+    }
+
+    void set(size_t bit, bool value)
+    {
+        const auto mask = uint64_t(1) << (bit % 64);
+        auto& word = this->words[bit / 64];
+        word = value ? (word | mask) : (word & ~mask);
+    }
+
+    // the 64 bits starting at a bit, zero past the end of the array
+    uint64_t read_word(size_t bit) const
+    {
+        const auto index = bit / 64;
+        const auto shift = bit % 64;
+
+        auto word = this->words[index] >> shift;
+        if (shift > 0 && (index + 1) < this->words.size())
+        {
+            word |= this->words[index + 1] << (64 - shift);
+        }
+        return word;
+    }
+
+    // true if any bit is set, checked a word at a time
+    bool any() const
+    {
+        for (const auto word : this->words)
+        {
+            if (word != 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    size_t num_bits = 0;
+    std::vector<uint64_t, ResourceAllocator<uint64_t>> words;
+};
+
+} // namespace opendnp3
+
+#endif
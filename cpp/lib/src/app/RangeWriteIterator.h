@@ -64,7 +64,10 @@ public:
 
     bool Write(const WriteType& value)
     {
-        if (isValid && (pPosition->length() >= serializer.get_size()) && (count <= IndexType::max_value))
+        // the stop index must stay addressable by the index type
+        const bool indexAvailable = count <= uint32_t(IndexType::max_value - start);
+
+        if (isValid && (pPosition->length() >= serializer.get_size()) && indexAvailable)
         {
             serializer.write(value, *pPosition);
             ++count;
@@ -54,6 +54,11 @@ public:
         return control;
     }
 
+    size_t Capacity() const
+    {
+        return buffer.length();
+    }
+
 private:
     ser4cpp::rseq_t lastResponse;
     AppControlField control;
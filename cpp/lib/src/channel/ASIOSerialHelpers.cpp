@@ -19,6 +19,15 @@
  */
 #include "channel/ASIOSerialHelpers.h"
 
+#ifdef __linux__
+#include <linux/serial.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+
+#include <algorithm>
+#include <cerrno>
+#endif
+
 namespace opendnp3
 {
 
@@ -118,4 +127,56 @@ bool Configure(const SerialSettings& settings, asio::serial_port& port, std::err
     return !ec;
 }
 
+bool ConfigureDriver(const SerialSettings& settings, asio::serial_port& port, std::error_code& ec)
+{
+#ifdef __linux__
+    const auto fd = port.native_handle();
+
+    if (settings.readBatchMin > 0 || settings.readBatchTimeout > TimeDuration::Zero())
+    {
+        termios tio{};
+        if (tcgetattr(fd, &tio) < 0)
+        {
+            ec = std::error_code(errno, std::system_category());
+            return false;
+        }
+
+        if (settings.readBatchMin > 0)
+        {
+            tio.c_cc[VMIN] = settings.readBatchMin;
+        }
+
+        if (settings.readBatchTimeout > TimeDuration::Zero())
+        {
+            // VTIME is expressed in tenths of a second, round up and saturate
+            const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(settings.readBatchTimeout.value).count();
+            tio.c_cc[VTIME] = static_cast<cc_t>(std::min<int64_t>((ms + 99) / 100, 255));
+        }
+
+        if (tcsetattr(fd, TCSANOW, &tio) < 0)
+        {
+            ec = std::error_code(errno, std::system_category());
+            return false;
+        }
+    }
+
+    if (settings.lowLatency)
+    {
+        // not every driver (USB adapters, ptys) implements TIOCSSERIAL, so this is best effort
+        serial_struct ss{};
+        if (ioctl(fd, TIOCGSERIAL, &ss) == 0)
+        {
+            ss.flags |= ASYNC_LOW_LATENCY;
+            ioctl(fd, TIOCSSERIAL, &ss);
+        }
+    }
+#else
+    (void)settings;
+    (void)port;
+    (void)ec;
+#endif
+
+    return true;
+}
+
 } // namespace opendnp3
@@ -30,6 +30,9 @@ namespace opendnp3
 // Serial port configuration functions "free" to keep the classes simple.
 bool Configure(const SerialSettings& settings, asio::serial_port& port, std::error_code& ec);
 
+// Driver level read batching (VMIN/VTIME) and low latency mode. No-op on platforms other than Linux.
+bool ConfigureDriver(const SerialSettings& settings, asio::serial_port& port, std::error_code& ec);
+
 } // namespace opendnp3
 
 #endif
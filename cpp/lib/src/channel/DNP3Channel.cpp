@@ -42,7 +42,8 @@ DNP3Channel::DNP3Channel(const Logger& logger,
       scheduler(std::make_shared<MasterSchedulerBackend>(executor)),
       iohandler(std::move(iohandler)),
       manager(std::move(manager)),
-      resources(ResourceManager::Create())
+      resources(ResourceManager::Create()),
+      memoryResource(MemoryScope::Current() ? MemoryScope::Current()->GetResource() : nullptr)
 {
 }
 
@@ -87,7 +88,11 @@ void DNP3Channel::ShutdownImpl()
 
 LinkStatistics DNP3Channel::GetStatistics()
 {
-    auto get = [this]() { return this->iohandler->Statistics(); };
+    auto get = [this]() {
+        auto statistics = this->iohandler->Statistics();
+        statistics.polling = this->scheduler->GetStatistics();
+        return statistics;
+    };
     return this->executor->return_from<LinkStatistics>(get);
 }
 
@@ -103,11 +108,35 @@ void DNP3Channel::SetLogFilters(const LogLevels& filters)
     this->executor->post(set);
 }
 
+void DNP3Channel::SetPollPlanner(const PollPlannerConfig& config)
+{
+    auto set = [self = this->shared_from_this(), config]() {
+        if (self->scheduler)
+        {
+            self->scheduler->SetPollPlanner(config);
+        }
+    };
+    this->executor->post(set);
+}
+
+void DNP3Channel::SetMemoryResource(std::shared_ptr<IMemoryResource> resource)
+{
+    std::lock_guard<std::mutex> lock(this->memoryMutex);
+    this->memoryResource = std::move(resource);
+}
+
+std::shared_ptr<MemoryAccount> DNP3Channel::CreateStackAccount()
+{
+    std::lock_guard<std::mutex> lock(this->memoryMutex);
+    return MemoryAccount::Create(this->memoryResource);
+}
+
 std::shared_ptr<IMaster> DNP3Channel::AddMaster(const std::string& id,
                                                 std::shared_ptr<ISOEHandler> SOEHandler,
                                                 std::shared_ptr<IMasterApplication> application,
                                                 const MasterStackConfig& config)
 {
+    MemoryScope scope(this->CreateStackAccount());
     auto stack = MasterStack::Create(this->logger.detach(id), this->executor, SOEHandler, application, this->scheduler,
                                      this->iohandler, this->resources, config);
 
@@ -119,12 +148,25 @@ std::shared_ptr<IOutstation> DNP3Channel::AddOutstation(const std::string& id,
                                                         std::shared_ptr<IOutstationApplication> application,
                                                         const OutstationStackConfig& config)
 {
+    MemoryScope scope(this->CreateStackAccount());
     auto stack = OutstationStack::Create(this->logger.detach(id), this->executor, commandHandler, application,
                                          this->iohandler, this->resources, config);
 
     return this->AddStack(config.link, stack);
 }
 
+std::shared_ptr<IOutstation> DNP3Channel::AddOutstation(const std::string& id,
+                                                        std::shared_ptr<IAsyncCommandHandler> commandHandler,
+                                                        std::shared_ptr<IOutstationApplication> application,
+                                                        const OutstationStackConfig& config)
+{
+    MemoryScope scope(this->CreateStackAccount());
+    auto stack = OutstationStack::Create(this->logger.detach(id), this->executor, nullptr, application,
+                                         this->iohandler, this->resources, config, commandHandler);
+
+    return this->AddStack(config.link, stack);
+}
+
 template<class T> std::shared_ptr<T> DNP3Channel::AddStack(const LinkConfig& link, const std::shared_ptr<T>& stack)
 {
 
@@ -20,12 +20,15 @@
 #ifndef OPENDNP3_DNP3CHANNEL_H
 #define OPENDNP3_DNP3CHANNEL_H
 
+#include "MemoryAccount.h"
 #include "ResourceManager.h"
 #include "channel/IOHandler.h"
 #include "master/IMasterScheduler.h"
 
 #include "opendnp3/channel/IChannel.h"
 
+#include <mutex>
+
 namespace opendnp3
 {
 
@@ -43,7 +46,8 @@ public:
                                                const std::shared_ptr<IOHandler>& iohandler,
                                                const std::shared_ptr<IResourceManager>& manager)
     {
-        return std::make_shared<DNP3Channel>(logger, executor, iohandler, manager);
+        return std::allocate_shared<DNP3Channel>(ResourceAllocator<DNP3Channel>(), logger, executor, iohandler,
+                                                 manager);
     }
 
     ~DNP3Channel();
@@ -58,6 +62,10 @@ public:
 
     void SetLogFilters(const opendnp3::LogLevels& filters) final;
 
+    void SetPollPlanner(const PollPlannerConfig& config) final;
+
+    void SetMemoryResource(std::shared_ptr<IMemoryResource> resource) final;
+
     std::shared_ptr<IMaster> AddMaster(const std::string& id,
                                        std::shared_ptr<ISOEHandler> SOEHandler,
                                        std::shared_ptr<IMasterApplication> application,
@@ -68,6 +76,11 @@ public:
                                                std::shared_ptr<IOutstationApplication> application,
                                                const OutstationStackConfig& config) final;
 
+    std::shared_ptr<IOutstation> AddOutstation(const std::string& id,
+                                               std::shared_ptr<IAsyncCommandHandler> commandHandler,
+                                               std::shared_ptr<IOutstationApplication> application,
+                                               const OutstationStackConfig& config) final;
+
 private:
     void ShutdownImpl();
 
@@ -81,6 +94,13 @@ private:
     std::shared_ptr<IOHandler> iohandler;
     std::shared_ptr<IResourceManager> manager;
     std::shared_ptr<ResourceManager> resources;
+
+    // source of memory for the stacks added to the channel, set from user threads
+    std::mutex memoryMutex;
+    std::shared_ptr<IMemoryResource> memoryResource;
+
+    // a new account on the channel's memory resource, or null for the global heap
+    std::shared_ptr<MemoryAccount> CreateStackAccount();
 };
 
 } // namespace opendnp3
@@ -21,6 +21,7 @@
 #define OPENDNP3_IASYNCCHANNEL_H
 
 #include "channel/IChannelCallbacks.h"
+#include "channel/SingleThreadContext.h"
 
 #include "opendnp3/util/Uncopyable.h"
 
@@ -37,7 +38,10 @@ namespace opendnp3
 class IAsyncChannel : public std::enable_shared_from_this<IAsyncChannel>, private Uncopyable
 {
 public:
-    IAsyncChannel(const std::shared_ptr<exe4cpp::StrandExecutor>& executor) : executor(executor) {}
+    IAsyncChannel(const std::shared_ptr<exe4cpp::StrandExecutor>& executor)
+        : executor(executor), direct(SingleThreadContext::IsMarked(*executor))
+    {
+    }
 
     virtual ~IAsyncChannel() {}
 
@@ -107,6 +111,19 @@ public:
     const std::shared_ptr<exe4cpp::StrandExecutor> executor;
 
 protected:
+    // starts an asynchronous operation with its handler bound to the strand, unless the io_context has a single thread
+    template<class Initiate, class Handler> void Start(const Initiate& initiate, const Handler& handler)
+    {
+        if (this->direct)
+        {
+            initiate(handler);
+        }
+        else
+        {
+            initiate(this->executor->wrap(handler));
+        }
+    }
+
     inline void OnReadCallback(const std::error_code& ec, size_t num)
     {
         this->reading = false;
@@ -142,6 +159,9 @@ private:
 
     std::shared_ptr<IChannelCallbacks> callbacks;
 
+    // completion handlers are invoked without the strand
+    const bool direct;
+
     bool is_shutting_down = false;
     bool reading = false;
     bool writing = false;
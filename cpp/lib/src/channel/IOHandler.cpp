@@ -24,6 +24,8 @@
 
 #include "opendnp3/logging/LogLevels.h"
 
+#include <algorithm>
+#include <new>
 #include <utility>
 
 namespace opendnp3
@@ -83,10 +85,9 @@ void IOHandler::OnWriteComplete(const std::error_code& ec, size_t num)
     {
         this->statistics.numBytesTx += num;
 
-        if (!this->txQueue.empty())
+        if (this->txHead < this->txQueue.size())
         {
-            const auto session = this->txQueue.front().session;
-            this->txQueue.pop_front();
+            const auto session = this->PopTransmission();
             session->OnTxReady();
         }
 
@@ -98,6 +99,11 @@ void IOHandler::BeginTransmit(const std::shared_ptr<ILinkSession>& session, cons
 {
     if (this->channel)
     {
+        if (auto route = this->routes.Find(session.get()))
+        {
+            ++route->statistics.numLinkFrameTx;
+        }
+
         this->txQueue.emplace_back(data, session);
         this->CheckForSend();
     }
@@ -115,34 +121,38 @@ bool IOHandler::AddContext(const std::shared_ptr<ILinkSession>& session, const A
         return false;
     }
 
-    if (this->IsSessionInUse(session))
+    if (this->routes.Find(session.get()))
     {
         SIMPLE_LOG_BLOCK(logger, flags::ERR, "Context cannot be bound 2x");
         return false;
     }
 
-    sessions.emplace_back(session, addresses); // record is always disabled by default
-
-    return true;
+    try
+    {
+        return this->routes.Add(session, addresses); // record is always disabled by default
+    }
+    catch (const std::bad_alloc&)
+    {
+        SIMPLE_LOG_BLOCK(logger, flags::ERR, "Memory resource exhausted, unable to bind context");
+        return false;
+    }
 }
 
 bool IOHandler::Enable(const std::shared_ptr<ILinkSession>& session)
 {
-    auto matches = [&](const Session& rec) { return rec.Matches(session); };
+    const auto route = this->routes.Find(session.get());
 
-    const auto iter = std::find_if(sessions.begin(), sessions.end(), matches);
-
-    if (iter == sessions.end())
+    if (!route)
         return false;
 
-    if (iter->enabled)
+    if (route->enabled)
         return true; // already enabled
 
-    iter->enabled = true;
+    route->enabled = true;
 
     if (this->channel)
     {
-        iter->LowerLayerUp();
+        route->LowerLayerUp();
     }
     else
     {
@@ -156,21 +166,19 @@ bool IOHandler::Enable(const std::shared_ptr<ILinkSession>& session)
 
 bool IOHandler::Disable(const std::shared_ptr<ILinkSession>& session)
 {
-    auto matches = [&](const Session& rec) { return rec.Matches(session); };
-
-    const auto iter = std::find_if(sessions.begin(), sessions.end(), matches);
+    const auto route = this->routes.Find(session.get());
 
-    if (iter == sessions.end())
+    if (!route)
         return false;
 
-    if (!iter->enabled)
+    if (!route->enabled)
         return true; // already disabled
 
-    iter->enabled = false;
+    route->enabled = false;
 
     if (channel)
     {
-        iter->LowerLayerDown();
+        route->LowerLayerDown();
     }
 
     if (!this->IsAnySessionEnabled())
@@ -184,19 +192,17 @@ bool IOHandler::Disable(const std::shared_ptr<ILinkSession>& session)
 
 bool IOHandler::Remove(const std::shared_ptr<ILinkSession>& session)
 {
-    auto matches = [&](const Session& rec) { return rec.Matches(session); };
+    const auto route = this->routes.Find(session.get());
 
-    const auto iter = std::find_if(sessions.begin(), sessions.end(), matches);
-
-    if (iter == sessions.end())
+    if (!route)
         return false;
 
     if (channel)
     {
-        iter->LowerLayerDown();
+        route->LowerLayerDown();
     }
 
-    sessions.erase(iter);
+    this->routes.Remove(session.get());
 
     if (!this->IsAnySessionEnabled())
     {
@@ -228,18 +234,18 @@ void IOHandler::OnNewChannel(const std::shared_ptr<IAsyncChannel>& channel)
 
     this->BeginRead();
 
-    for (auto& session : this->sessions)
+    for (auto& route : this->routes)
     {
-        if (session.enabled)
+        if (route.enabled)
         {
-            session.LowerLayerUp();
+            route.LowerLayerUp();
         }
     }
 }
 
 bool IOHandler::OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata)
 {
-    if (this->SendToSession(header.addresses, header, userdata))
+    if (this->SendToSession(header, userdata))
     {
         return true;
     }
@@ -256,24 +262,57 @@ void IOHandler::BeginRead()
 
 void IOHandler::CheckForSend()
 {
-    if (this->txQueue.empty() || !this->channel || !this->channel->CanWrite())
+    if (this->txHead == this->txQueue.size() || !this->channel || !this->channel->CanWrite())
         return;
 
     ++statistics.numLinkFrameTx;
-    this->channel->BeginWrite(this->txQueue.front().txdata);
+    this->channel->BeginWrite(this->txQueue[this->txHead].txdata);
+}
+
+std::shared_ptr<ILinkSession> IOHandler::PopTransmission()
+{
+    auto session = std::move(this->txQueue[this->txHead].session);
+    ++this->txHead;
+
+    if (this->txHead == this->txQueue.size())
+    {
+        this->txQueue.clear();
+        this->txHead = 0;
+    }
+    else if (this->txHead >= MIN_TX_COMPACTION && 2 * this->txHead >= this->txQueue.size())
+    {
+        // the queue never drained, so drop the consumed entries in one go
+        this->txQueue.erase(this->txQueue.begin(), this->txQueue.begin() + static_cast<std::ptrdiff_t>(this->txHead));
+        this->txHead = 0;
+    }
+
+    return session;
 }
 
-bool IOHandler::SendToSession(const Addresses& /*addresses*/,
-                              const LinkHeaderFields& header,
-                              const ser4cpp::rseq_t& userdata)
+bool IOHandler::SendToSession(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata)
 {
+    if (!header.addresses.IsBroadcast())
+    {
+        const auto route = this->routes.Find(header.addresses);
+        if (route && route->enabled)
+        {
+            ++route->statistics.numLinkFrameRx;
+            return route->OnFrame(header, userdata);
+        }
+
+        ++this->statistics.numUnknownRoute;
+    }
+
+    // broadcasts go to every session, as do frames without a route so that sessions accepting
+    // any source can take them and the others report the unknown addresses to their listeners
     bool accepted = false;
 
-    for (auto& session : sessions)
+    for (auto& route : this->routes)
     {
-        if (session.enabled)
+        if (route.enabled)
         {
-            accepted |= session.OnFrame(header, userdata);
+            ++route.statistics.numLinkFrameRx;
+            accepted |= route.OnFrame(header, userdata);
         }
     }
 
@@ -282,23 +321,20 @@ bool IOHandler::SendToSession(const Addresses& /*addresses*/,
 
 bool IOHandler::IsRouteInUse(const Addresses& addresses) const
 {
-    auto matches = [addresses](const Session& record) { return record.Matches(addresses); };
-
-    return std::find_if(sessions.begin(), sessions.end(), matches) != sessions.end();
+    return this->routes.Find(addresses) != nullptr;
 }
 
-bool IOHandler::IsSessionInUse(const std::shared_ptr<ILinkSession>& session) const
+Route::Statistics IOHandler::GetRouteStatistics(const Addresses& addresses) const
 {
-    auto matches = [&](const Session& record) { return record.Matches(session); };
-
-    return std::find_if(sessions.begin(), sessions.end(), matches) != sessions.end();
+    const auto route = this->routes.Find(addresses);
+    return route ? route->statistics : Route::Statistics();
 }
 
 bool IOHandler::IsAnySessionEnabled() const
 {
-    auto matches = [&](const Session& record) { return record.enabled; };
+    auto matches = [&](const Route& route) { return route.enabled; };
 
-    return std::find_if(sessions.begin(), sessions.end(), matches) != sessions.end();
+    return std::find_if(this->routes.begin(), this->routes.end(), matches) != this->routes.end();
 }
 
 void IOHandler::Reset()
@@ -314,7 +350,7 @@ void IOHandler::Reset()
         this->UpdateListener(ChannelState::CLOSED);
 
         // notify any sessions that are online that this layer is offline
-        for (auto& item : this->sessions)
+        for (auto& item : this->routes)
         {
             item.LowerLayerDown();
         }
@@ -325,6 +361,7 @@ void IOHandler::Reset()
 
     // clear any pending tranmissions
     this->txQueue.clear();
+    this->txHead = 0;
 }
 
 } // namespace opendnp3
@@ -20,7 +20,9 @@
 #ifndef OPENDNP3_IOHANDLER_H
 #define OPENDNP3_IOHANDLER_H
 
+#include "MemoryAccount.h"
 #include "channel/IAsyncChannel.h"
+#include "channel/RouteTable.h"
 #include "link/ILinkTx.h"
 #include "link/LinkLayerParser.h"
 
@@ -28,7 +30,6 @@
 #include "opendnp3/link/Addresses.h"
 #include "opendnp3/logging/Logger.h"
 
-#include <deque>
 #include <vector>
 
 namespace opendnp3
@@ -73,6 +74,9 @@ public:
     // Query to see if a route is in use
     bool IsRouteInUse(const Addresses& addresses) const;
 
+    // Counters of the session bound to a route, all zero if the route isn't in use
+    Route::Statistics GetRouteStatistics(const Addresses& addresses) const;
+
 protected:
     // ------ Implement IChannelCallbacks -----
 
@@ -114,72 +118,13 @@ private:
     // called by the parser when a complete frame is read
     bool OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata) final;
 
-    bool IsSessionInUse(const std::shared_ptr<ILinkSession>& session) const;
     bool IsAnySessionEnabled() const;
     void Reset();
     void BeginRead();
     void CheckForSend();
+    std::shared_ptr<ILinkSession> PopTransmission();
 
-    bool SendToSession(const Addresses& addresses, const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata);
-
-    class Session
-    {
-
-    public:
-        Session(const std::shared_ptr<ILinkSession>& session, const Addresses& addresses)
-            : addresses(addresses), session(session)
-        {
-        }
-
-        Session() = default;
-
-        inline bool Matches(const std::shared_ptr<ILinkSession>& session) const
-        {
-            return this->session == session;
-        }
-        inline bool Matches(const Addresses& addresses) const
-        {
-            return this->addresses == addresses;
-        }
-
-        inline bool OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata)
-        {
-            return this->session->OnFrame(header, userdata);
-        }
-
-        inline bool LowerLayerUp()
-        {
-            if (!online)
-            {
-                online = true;
-                return this->session->OnLowerLayerUp();
-            }
-            else
-            {
-                return false;
-            }
-        }
-
-        inline bool LowerLayerDown()
-        {
-            if (online)
-            {
-                online = false;
-                return this->session->OnLowerLayerDown();
-            }
-            else
-            {
-                return false;
-            }
-        }
-
-        bool enabled = false;
-
-    private:
-        Addresses addresses;
-        bool online = false;
-        std::shared_ptr<ILinkSession> session;
-    };
+    bool SendToSession(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata);
 
     struct Transmission
     {
@@ -194,8 +139,11 @@ private:
         std::shared_ptr<ILinkSession> session;
     };
 
-    std::vector<Session> sessions;
-    std::deque<Transmission> txQueue;
+    RouteTable routes;
+    // a FIFO that keeps its capacity, so that steady state transmission doesn't allocate
+    static const size_t MIN_TX_COMPACTION = 32;
+    std::vector<Transmission> txQueue;
+    size_t txHead = 0;
 
     LinkLayerParser parser;
 
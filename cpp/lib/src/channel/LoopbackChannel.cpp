@@ -0,0 +1,174 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "channel/LoopbackChannel.h"
+
+#include <utility>
+
+namespace opendnp3
+{
+
+LoopbackChannel::Pair LoopbackChannel::CreatePair(const std::shared_ptr<exe4cpp::StrandExecutor>& executor1,
+                                                  const std::shared_ptr<exe4cpp::StrandExecutor>& executor2)
+{
+    auto forward = std::make_shared<LoopbackPipe>();
+    auto reverse = std::make_shared<LoopbackPipe>();
+
+    auto first = std::make_shared<LoopbackChannel>(executor1, reverse, forward);
+    auto second = std::make_shared<LoopbackChannel>(executor2, forward, reverse);
+
+    first->peer = second;
+    second->peer = first;
+
+    return Pair(first, second);
+}
+
+LoopbackChannel::LoopbackChannel(const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
+                                 std::shared_ptr<LoopbackPipe> rx,
+                                 std::shared_ptr<LoopbackPipe> tx)
+    : IAsyncChannel(executor), rx(std::move(rx)), tx(std::move(tx))
+{
+}
+
+void LoopbackChannel::BeginReadImpl(ser4cpp::wseq_t buffer)
+{
+    this->readBuffer = buffer;
+    this->readPending = true;
+
+    // a read started from within the read callback is picked up by the delivery loop, otherwise complete it
+    // asynchronously like a socket read, the caller doesn't expect to be re-entered
+    if (!this->delivering)
+    {
+        this->executor->post([self = Self()]() { self->TryRead(); });
+    }
+}
+
+void LoopbackChannel::BeginWriteImpl(const ser4cpp::rseq_t& buffer)
+{
+    this->writeRemaining = buffer;
+    this->writeLength = buffer.length();
+    this->writePending = true;
+    this->TryWrite();
+}
+
+void LoopbackChannel::ShutdownImpl()
+{
+    this->rx->Close();
+    this->tx->Close();
+    this->NotifyPeer();
+
+    // nothing will ever complete these operations, so do it here to let the shutdown finish
+    if (this->readPending)
+    {
+        this->readPending = false;
+        this->OnReadCallback(asio::error::operation_aborted, 0);
+    }
+
+    if (this->writePending)
+    {
+        this->writePending = false;
+        this->OnWriteCallback(asio::error::operation_aborted, 0);
+    }
+}
+
+void LoopbackChannel::OnNotify()
+{
+    // cleared before looking at the pipes so that anything the peer does from here on posts again
+    this->notifyPending.store(false, std::memory_order_release);
+
+    this->TryRead();
+    this->TryWrite();
+}
+
+void LoopbackChannel::NotifyPeer()
+{
+    auto peer = this->peer.lock();
+
+    if (peer && !peer->notifyPending.exchange(true, std::memory_order_acq_rel))
+    {
+        peer->executor->post([peer]() { peer->OnNotify(); });
+    }
+}
+
+void LoopbackChannel::TryRead()
+{
+    if (this->delivering)
+        return;
+
+    auto self = Self();
+    this->delivering = true;
+
+    while (this->readPending)
+    {
+        // observe the close before reading, so that every byte written before it is delivered first
+        const auto closed = this->rx->IsClosed();
+        const auto num = this->rx->Read(this->readBuffer);
+
+        if (num > 0)
+        {
+            // the peer may be waiting for space to finish a write
+            this->NotifyPeer();
+            this->readPending = false;
+            this->OnReadCallback(std::error_code(), num);
+        }
+        else if (closed)
+        {
+            this->readPending = false;
+            this->OnReadCallback(asio::error::eof, 0);
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    this->delivering = false;
+}
+
+void LoopbackChannel::TryWrite()
+{
+    if (!this->writePending)
+        return;
+
+    if (this->tx->IsClosed())
+    {
+        this->writePending = false;
+        this->executor->post([self = Self()]() { self->OnWriteCallback(asio::error::broken_pipe, 0); });
+        return;
+    }
+
+    const auto num = this->tx->Write(this->writeRemaining);
+
+    if (num > 0)
+    {
+        this->writeRemaining.advance(num);
+        this->NotifyPeer();
+    }
+
+    if (this->writeRemaining.is_empty())
+    {
+        // completed asynchronously like a socket write, the caller doesn't expect to be re-entered
+        this->writePending = false;
+        this->executor->post(
+            [self = Self(), num = this->writeLength]() { self->OnWriteCallback(std::error_code(), num); });
+    }
+}
+
+} // namespace opendnp3
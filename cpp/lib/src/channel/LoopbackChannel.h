@@ -0,0 +1,90 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_LOOPBACKCHANNEL_H
+#define OPENDNP3_LOOPBACKCHANNEL_H
+
+#include "channel/IAsyncChannel.h"
+#include "channel/LoopbackPipe.h"
+
+#include <atomic>
+#include <utility>
+
+namespace opendnp3
+{
+
+/**
+ * One end of an in-memory connection between two channels in the same process.
+ *
+ * Each direction is a LoopbackPipe, so moving bytes never takes a lock or a syscall. The ends
+ * live on different strands and only post to each other when one of them is waiting on the
+ * other, i.e. a read found the pipe empty or a write found it full.
+ */
+class LoopbackChannel final : public IAsyncChannel
+{
+public:
+    using Pair = std::pair<std::shared_ptr<LoopbackChannel>, std::shared_ptr<LoopbackChannel>>;
+
+    static Pair CreatePair(const std::shared_ptr<exe4cpp::StrandExecutor>& executor1,
+                           const std::shared_ptr<exe4cpp::StrandExecutor>& executor2);
+
+    LoopbackChannel(const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
+                    std::shared_ptr<LoopbackPipe> rx,
+                    std::shared_ptr<LoopbackPipe> tx);
+
+private:
+    void BeginReadImpl(ser4cpp::wseq_t buffer) final;
+    void BeginWriteImpl(const ser4cpp::rseq_t& buffer) final;
+    void ShutdownImpl() final;
+
+    // called on this strand when the peer has read or written something
+    void OnNotify();
+
+    // wakes the peer if it isn't already going to run
+    void NotifyPeer();
+
+    void TryRead();
+    void TryWrite();
+
+    std::shared_ptr<LoopbackChannel> Self()
+    {
+        return std::static_pointer_cast<LoopbackChannel>(shared_from_this());
+    }
+
+    const std::shared_ptr<LoopbackPipe> rx;
+    const std::shared_ptr<LoopbackPipe> tx;
+
+    std::weak_ptr<LoopbackChannel> peer;
+
+    // set by the peer when it posts OnNotify, so that bursts of activity are coalesced into one post
+    std::atomic<bool> notifyPending{false};
+
+    // only accessed from the channel strand
+    bool readPending = false;
+    bool delivering = false;
+    ser4cpp::wseq_t readBuffer;
+
+    bool writePending = false;
+    size_t writeLength = 0;
+    ser4cpp::rseq_t writeRemaining;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "channel/LoopbackIOHandler.h"
+
+#include "logging/LogMacros.h"
+
+#include <utility>
+
+namespace opendnp3
+{
+
+LoopbackIOHandler::LoopbackIOHandler(const Logger& logger,
+                                     const std::shared_ptr<IChannelListener>& listener,
+                                     const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
+                                     std::shared_ptr<LoopbackRegistry> registry,
+                                     std::string name)
+    : IOHandler(logger, false, listener), executor(executor), registry(std::move(registry)), name(std::move(name))
+{
+}
+
+void LoopbackIOHandler::OnConnect(const std::shared_ptr<IAsyncChannel>& channel)
+{
+    if (!this->listening)
+    {
+        // stopped accepting while the pairing was in flight, the peer will see the close and listen again
+        channel->Shutdown();
+        return;
+    }
+
+    this->listening = false;
+
+    FORMAT_LOG_BLOCK(this->logger, flags::INFO, "Loopback channel connected: %s", this->name.c_str());
+
+    this->OnNewChannel(channel);
+}
+
+void LoopbackIOHandler::ShutdownImpl()
+{
+    this->SuspendChannelAccept();
+}
+
+void LoopbackIOHandler::BeginChannelAccept()
+{
+    this->listening = true;
+    this->registry->Listen(this->name, this->Self());
+}
+
+void LoopbackIOHandler::SuspendChannelAccept()
+{
+    this->listening = false;
+    this->registry->Remove(this->name, this);
+}
+
+void LoopbackIOHandler::OnChannelShutdown()
+{
+    this->BeginChannelAccept();
+}
+
+} // namespace opendnp3
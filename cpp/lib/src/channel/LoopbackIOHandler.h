@@ -0,0 +1,75 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_LOOPBACKIOHANDLER_H
+#define OPENDNP3_LOOPBACKIOHANDLER_H
+
+#include "channel/IOHandler.h"
+#include "channel/LoopbackRegistry.h"
+
+#include <string>
+
+namespace opendnp3
+{
+
+class LoopbackIOHandler final : public IOHandler
+{
+
+public:
+    static std::shared_ptr<LoopbackIOHandler> Create(const Logger& logger,
+                                                     const std::shared_ptr<IChannelListener>& listener,
+                                                     const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
+                                                     const std::shared_ptr<LoopbackRegistry>& registry,
+                                                     const std::string& name)
+    {
+        return std::make_shared<LoopbackIOHandler>(logger, listener, executor, registry, name);
+    }
+
+    LoopbackIOHandler(const Logger& logger,
+                      const std::shared_ptr<IChannelListener>& listener,
+                      const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
+                      std::shared_ptr<LoopbackRegistry> registry,
+                      std::string name);
+
+    // called by the registry on the handler's strand once it has been paired with a peer
+    void OnConnect(const std::shared_ptr<IAsyncChannel>& channel);
+
+    const std::shared_ptr<exe4cpp::StrandExecutor> executor;
+
+protected:
+    void ShutdownImpl() final;
+    void BeginChannelAccept() final;
+    void SuspendChannelAccept() final;
+    void OnChannelShutdown() final;
+
+private:
+    std::shared_ptr<LoopbackIOHandler> Self()
+    {
+        return std::static_pointer_cast<LoopbackIOHandler>(shared_from_this());
+    }
+
+    const std::shared_ptr<LoopbackRegistry> registry;
+    const std::string name;
+
+    bool listening = false;
+};
+
+} // namespace opendnp3
+
+#endif
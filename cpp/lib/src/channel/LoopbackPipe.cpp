@@ -0,0 +1,84 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "channel/LoopbackPipe.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace opendnp3
+{
+
+size_t LoopbackPipe::Write(const ser4cpp::rseq_t& data)
+{
+    if (this->IsClosed())
+    {
+        return 0;
+    }
+
+    const auto tail = this->tail.load(std::memory_order_relaxed);
+    const auto head = this->head.load(std::memory_order_acquire);
+
+    const auto num = std::min(data.length(), CAPACITY - (tail - head));
+    if (num == 0)
+    {
+        return 0;
+    }
+
+    const auto src = static_cast<const uint8_t*>(data);
+    // the free space may wrap around the end of the buffer
+    const auto offset = tail & (CAPACITY - 1);
+    const auto first = std::min(num, CAPACITY - offset);
+    std::memcpy(this->buffer.data() + offset, src, first);
+    std::memcpy(this->buffer.data(), src + first, num - first);
+
+    this->tail.store(tail + num, std::memory_order_release);
+
+    return num;
+}
+
+size_t LoopbackPipe::Read(ser4cpp::wseq_t buffer)
+{
+    const auto head = this->head.load(std::memory_order_relaxed);
+    const auto tail = this->tail.load(std::memory_order_acquire);
+
+    const auto num = std::min(buffer.length(), tail - head);
+    if (num == 0)
+    {
+        return 0;
+    }
+
+    const auto dest = static_cast<uint8_t*>(buffer);
+    const auto offset = head & (CAPACITY - 1);
+    const auto first = std::min(num, CAPACITY - offset);
+    std::memcpy(dest, this->buffer.data() + offset, first);
+    std::memcpy(dest + first, this->buffer.data(), num - first);
+
+    this->head.store(head + num, std::memory_order_release);
+
+    return num;
+}
+
+void LoopbackPipe::Close()
+{
+    this->closed.store(true, std::memory_order_release);
+}
+
+} // namespace opendnp3
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_LOOPBACKPIPE_H
+#define OPENDNP3_LOOPBACKPIPE_H
+
+#include "opendnp3/util/Uncopyable.h"
+
+#include <ser4cpp/container/SequenceTypes.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+ * Fixed size byte ring that moves data in one direction between two strands.
+ *
+ * Lock-free for a single producer calling Write() and a single consumer calling Read().
+ * Either side may Close() the pipe, after which writes are refused and the consumer
+ * drains whatever was written before the close.
+ */
+class LoopbackPipe : private Uncopyable
+{
+public:
+    static const size_t CAPACITY = 4096;
+
+    // copies as much of the data as fits, returning the number of bytes written
+    size_t Write(const ser4cpp::rseq_t& data);
+
+    // copies as much buffered data as fits into the buffer, returning the number of bytes read
+    size_t Read(ser4cpp::wseq_t buffer);
+
+    void Close();
+
+    bool IsClosed() const
+    {
+        return this->closed.load(std::memory_order_acquire);
+    }
+
+private:
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "capacity must be a power of 2");
+
+    // free running counters, the index into the buffer is the counter modulo the capacity
+    std::atomic<size_t> head{0}; // advanced by the consumer
+    std::atomic<size_t> tail{0}; // advanced by the producer
+    std::atomic<bool> closed{false};
+
+    std::array<uint8_t, CAPACITY> buffer;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "channel/LoopbackRegistry.h"
+
+#include "channel/LoopbackChannel.h"
+#include "channel/LoopbackIOHandler.h"
+
+namespace opendnp3
+{
+
+void LoopbackRegistry::Listen(const std::string& name, const std::shared_ptr<LoopbackIOHandler>& handler)
+{
+    std::shared_ptr<LoopbackIOHandler> other;
+
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        auto iter = this->waiting.find(name);
+
+        if (iter == this->waiting.end())
+        {
+            this->waiting.emplace(name, handler);
+            return;
+        }
+
+        other = iter->second.lock();
+
+        if (other == handler)
+        {
+            return;
+        }
+
+        if (!other)
+        {
+            // the previous handler went away without removing itself
+            iter->second = handler;
+            return;
+        }
+
+        this->waiting.erase(iter);
+    }
+
+    auto channels = LoopbackChannel::CreatePair(other->executor, handler->executor);
+
+    other->executor->post([other, channel = channels.first]() { other->OnConnect(channel); });
+    handler->executor->post([handler, channel = channels.second]() { handler->OnConnect(channel); });
+}
+
+void LoopbackRegistry::Remove(const std::string& name, const LoopbackIOHandler* handler)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    auto iter = this->waiting.find(name);
+
+    if (iter != this->waiting.end())
+    {
+        auto current = iter->second.lock();
+        if (!current || current.get() == handler)
+        {
+            this->waiting.erase(iter);
+        }
+    }
+}
+
+} // namespace opendnp3
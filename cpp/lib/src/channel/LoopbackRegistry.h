@@ -0,0 +1,56 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_LOOPBACKREGISTRY_H
+#define OPENDNP3_LOOPBACKREGISTRY_H
+
+#include "opendnp3/util/Uncopyable.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace opendnp3
+{
+
+class LoopbackIOHandler;
+
+/**
+ * Pairs up loopback IO handlers that are waiting on the same name.
+ *
+ * Shared by all the loopback channels of a manager, and called from their strands.
+ */
+class LoopbackRegistry : private Uncopyable
+{
+public:
+    // connect the handler to another one waiting on the same name, or wait for one to arrive
+    void Listen(const std::string& name, const std::shared_ptr<LoopbackIOHandler>& handler);
+
+    // stop waiting on the name, if the handler still is
+    void Remove(const std::string& name, const LoopbackIOHandler* handler);
+
+private:
+    std::mutex mutex;
+    std::map<std::string, std::weak_ptr<LoopbackIOHandler>> waiting;
+};
+
+} // namespace opendnp3
+
+#endif
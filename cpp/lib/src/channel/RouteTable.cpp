@@ -0,0 +1,210 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "channel/RouteTable.h"
+
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace opendnp3
+{
+
+namespace
+{
+    // integer finalizer that spreads every input bit over the low bits used as the slot index
+    uint32_t Mix(uint32_t value)
+    {
+        value ^= value >> 16;
+        value *= 0x7feb352dU;
+        value ^= value >> 15;
+        value *= 0x846ca68bU;
+        value ^= value >> 16;
+        return value;
+    }
+} // namespace
+
+Route* RouteTable::Find(const Addresses& addresses)
+{
+    const auto slot = this->FindSlot(this->byAddresses, addresses);
+    return (slot == this->byAddresses.size()) ? nullptr : &this->routes[this->byAddresses[slot] - 1];
+}
+
+const Route* RouteTable::Find(const Addresses& addresses) const
+{
+    const auto slot = this->FindSlot(this->byAddresses, addresses);
+    return (slot == this->byAddresses.size()) ? nullptr : &this->routes[this->byAddresses[slot] - 1];
+}
+
+Route* RouteTable::Find(const ILinkSession* session)
+{
+    const auto slot = this->FindSlot(this->bySession, session);
+    return (slot == this->bySession.size()) ? nullptr : &this->routes[this->bySession[slot] - 1];
+}
+
+bool RouteTable::Add(const std::shared_ptr<ILinkSession>& session, const Addresses& addresses)
+{
+    if (this->Find(addresses) || this->Find(session.get()))
+    {
+        return false;
+    }
+
+    this->routes.emplace_back(session, addresses);
+
+    // keep the load factor at or below one half so probe sequences stay short
+    if (2 * this->routes.size() > this->byAddresses.size())
+    {
+        try
+        {
+            this->Rehash(this->byAddresses.empty() ? MIN_CAPACITY : 2 * this->byAddresses.size());
+        }
+        catch (const std::bad_alloc&)
+        {
+            this->routes.pop_back();
+            throw;
+        }
+    }
+    else
+    {
+        const auto value = static_cast<uint32_t>(this->routes.size());
+        this->Insert(this->byAddresses, Hash(addresses), value);
+        this->Insert(this->bySession, Hash(session.get()), value);
+    }
+
+    return true;
+}
+
+bool RouteTable::Remove(const ILinkSession* session)
+{
+    const auto sessionSlot = this->FindSlot(this->bySession, session);
+    if (sessionSlot == this->bySession.size())
+    {
+        return false;
+    }
+
+    const auto position = this->bySession[sessionSlot] - 1;
+    this->Erase(this->bySession, sessionSlot, false);
+    this->Erase(this->byAddresses, this->FindSlot(this->byAddresses, this->routes[position].addresses), true);
+
+    // fill the hole with the last route so that routes stay contiguous
+    const auto last = this->routes.size() - 1;
+    if (position != last)
+    {
+        const auto value = static_cast<uint32_t>(position + 1);
+        this->byAddresses[this->FindSlot(this->byAddresses, this->routes[last].addresses)] = value;
+        this->bySession[this->FindSlot(this->bySession, this->routes[last].session.get())] = value;
+        this->routes[position] = std::move(this->routes[last]);
+    }
+
+    this->routes.pop_back();
+    return true;
+}
+
+size_t RouteTable::Hash(const Addresses& addresses)
+{
+    return Mix((static_cast<uint32_t>(addresses.source) << 16) | addresses.destination);
+}
+
+size_t RouteTable::Hash(const ILinkSession* session)
+{
+    // the low bits of a heap address are always zero
+    const auto value = reinterpret_cast<uintptr_t>(session) >> 4;
+    return Mix(static_cast<uint32_t>(value) ^ static_cast<uint32_t>(static_cast<uint64_t>(value) >> 32));
+}
+
+template<class Matches>
+size_t RouteTable::Probe(const slot_vector_t& slots, size_t hash, const Matches& matches) const
+{
+    if (!slots.empty())
+    {
+        const auto mask = slots.size() - 1;
+        for (auto slot = hash & mask; slots[slot] != 0; slot = (slot + 1) & mask)
+        {
+            if (matches(this->routes[slots[slot] - 1]))
+            {
+                return slot;
+            }
+        }
+    }
+
+    return slots.size();
+}
+
+size_t RouteTable::FindSlot(const slot_vector_t& slots, const Addresses& addresses) const
+{
+    return this->Probe(slots, Hash(addresses), [&](const Route& route) { return route.addresses == addresses; });
+}
+
+size_t RouteTable::FindSlot(const slot_vector_t& slots, const ILinkSession* session) const
+{
+    return this->Probe(slots, Hash(session), [&](const Route& route) { return route.session.get() == session; });
+}
+
+void RouteTable::Insert(slot_vector_t& slots, size_t hash, uint32_t value)
+{
+    const auto mask = slots.size() - 1;
+    auto slot = hash & mask;
+    while (slots[slot] != 0)
+    {
+        slot = (slot + 1) & mask;
+    }
+    slots[slot] = value;
+}
+
+void RouteTable::Erase(slot_vector_t& slots, size_t slot, bool byAddresses)
+{
+    // backward shift deletion, so that lookups never need tombstones
+    const auto mask = slots.size() - 1;
+    auto hole = slot;
+    slots[hole] = 0;
+
+    for (auto next = (hole + 1) & mask; slots[next] != 0; next = (next + 1) & mask)
+    {
+        const auto& route = this->routes[slots[next] - 1];
+        const auto home = (byAddresses ? Hash(route.addresses) : Hash(route.session.get())) & mask;
+
+        // the entry can move into the hole unless its home slot lies cyclically in (hole, next]
+        const bool stays = (hole <= next) ? (hole < home && home <= next) : (hole < home || home <= next);
+        if (!stays)
+        {
+            slots[hole] = slots[next];
+            slots[next] = 0;
+            hole = next;
+        }
+    }
+}
+
+void RouteTable::Rehash(size_t capacity)
+{
+    // fill new slots before replacing the current ones, so that a failed allocation leaves the table as it was
+    slot_vector_t addresses(capacity, 0, this->byAddresses.get_allocator());
+    slot_vector_t sessions(capacity, 0, this->bySession.get_allocator());
+
+    for (size_t i = 0; i < this->routes.size(); ++i)
+    {
+        const auto value = static_cast<uint32_t>(i + 1);
+        this->Insert(addresses, Hash(this->routes[i].addresses), value);
+        this->Insert(sessions, Hash(this->routes[i].session.get()), value);
+    }
+
+    this->byAddresses.swap(addresses);
+    this->bySession.swap(sessions);
+}
+
+} // namespace opendnp3
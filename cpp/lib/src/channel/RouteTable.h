@@ -0,0 +1,168 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_ROUTETABLE_H
+#define OPENDNP3_ROUTETABLE_H
+
+#include "MemoryAccount.h"
+#include "link/ILinkSession.h"
+
+#include "opendnp3/link/Addresses.h"
+
+#include <memory>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+ * A link layer session bound to an IOHandler, along with the addresses of the frames it receives
+ */
+class Route
+{
+public:
+    struct Statistics
+    {
+        /// Number of frames routed to the session
+        size_t numLinkFrameRx = 0;
+
+        /// Number of frames transmitted by the session
+        size_t numLinkFrameTx = 0;
+    };
+
+    Route(const std::shared_ptr<ILinkSession>& session, const Addresses& addresses)
+        : addresses(addresses), session(session)
+    {
+    }
+
+    inline bool OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata)
+    {
+        return this->session->OnFrame(header, userdata);
+    }
+
+    inline bool LowerLayerUp()
+    {
+        if (!online)
+        {
+            online = true;
+            return this->session->OnLowerLayerUp();
+        }
+
+        return false;
+    }
+
+    inline bool LowerLayerDown()
+    {
+        if (online)
+        {
+            online = false;
+            return this->session->OnLowerLayerDown();
+        }
+
+        return false;
+    }
+
+    Addresses addresses;
+    std::shared_ptr<ILinkSession> session;
+    bool enabled = false;
+    Statistics statistics;
+
+private:
+    bool online = false;
+};
+
+/**
+ * Sessions of an IOHandler, indexed both by the addresses of the frames they receive and by session.
+ *
+ * Routes are stored contiguously and found through two open addressing indices with linear probing, so frame
+ * dispatch and session lookups are O(1) regardless of the number of sessions sharing the channel.
+ */
+class RouteTable
+{
+    using route_vector_t = std::vector<Route, ResourceAllocator<Route>>;
+
+public:
+    using iterator = route_vector_t::iterator;
+    using const_iterator = route_vector_t::const_iterator;
+
+    // returns nullptr if no session is bound to these addresses
+    Route* Find(const Addresses& addresses);
+    const Route* Find(const Addresses& addresses) const;
+
+    // returns nullptr if the session isn't bound
+    Route* Find(const ILinkSession* session);
+
+    // fails if either the addresses or the session are already bound
+    // throws std::bad_alloc if the memory resource is exhausted, leaving the table unchanged
+    bool Add(const std::shared_ptr<ILinkSession>& session, const Addresses& addresses);
+
+    // invalidates pointers to the removed route and to the last route
+    bool Remove(const ILinkSession* session);
+
+    size_t Size() const
+    {
+        return this->routes.size();
+    }
+
+    iterator begin()
+    {
+        return this->routes.begin();
+    }
+
+    iterator end()
+    {
+        return this->routes.end();
+    }
+
+    const_iterator begin() const
+    {
+        return this->routes.begin();
+    }
+
+    const_iterator end() const
+    {
+        return this->routes.end();
+    }
+
+private:
+    // slots hold the position of a route plus one, zero marks an empty slot
+    using slot_vector_t = std::vector<uint32_t, ResourceAllocator<uint32_t>>;
+
+    static const size_t MIN_CAPACITY = 16;
+
+    static size_t Hash(const Addresses& addresses);
+    static size_t Hash(const ILinkSession* session);
+
+    template<class Matches> size_t Probe(const slot_vector_t& slots, size_t hash, const Matches& matches) const;
+
+    size_t FindSlot(const slot_vector_t& slots, const Addresses& addresses) const;
+    size_t FindSlot(const slot_vector_t& slots, const ILinkSession* session) const;
+
+    void Insert(slot_vector_t& slots, size_t hash, uint32_t value);
+    void Erase(slot_vector_t& slots, size_t slot, bool byAddresses);
+    void Rehash(size_t capacity);
+
+    route_vector_t routes;
+    slot_vector_t byAddresses;
+    slot_vector_t bySession;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -21,6 +21,8 @@
 #include "channel/SerialChannel.h"
 
 #include "channel/ASIOSerialHelpers.h"
+#include "link/LinkFrame.h"
+#include "link/LinkLayerConstants.h"
 
 #ifdef USE_FLOCK
 #include <sys/file.h>
@@ -53,31 +55,189 @@ bool SerialChannel::Open(const SerialSettings& settings, std::error_code& ec)
 
     Configure(settings, port, ec);
 
+    if (!ec)
+    {
+        ConfigureDriver(settings, port, ec);
+    }
+
     if (ec)
     {
         port.close();
         return false;
     }
 
+    this->frameGap = settings.frameGap;
+    this->txTurnaround = settings.txTurnaround;
+
     return true;
 }
 
 void SerialChannel::BeginReadImpl(ser4cpp::wseq_t buffer)
 {
-    auto callback = [this](const std::error_code& ec, size_t num) { this->OnReadCallback(ec, num); };
+    if (this->frameGap > TimeDuration::Zero())
+    {
+        this->readBuffer = buffer;
+        this->numRead = 0;
+        this->gapExpired = false;
+        this->ReadMore();
+    }
+    else
+    {
+        auto callback = [this](const std::error_code& ec, size_t num) {
+            this->lastRx = Timestamp(this->executor->get_time());
+            this->OnReadCallback(ec, num);
+        };
+
+        auto read = [&](const auto& handler) { port.async_read_some(asio::buffer(buffer, buffer.length()), handler); };
 
-    port.async_read_some(asio::buffer(buffer, buffer.length()), this->executor->wrap(callback));
+        this->Start(read, callback);
+    }
 }
 
 void SerialChannel::BeginWriteImpl(const ser4cpp::rseq_t& buffer)
 {
-    auto callback = [this](const std::error_code& ec, size_t num) { this->OnWriteCallback(ec, num); };
+    if (this->txTurnaround > TimeDuration::Zero())
+    {
+        const auto earliest = this->lastRx + this->txTurnaround;
+        if (Timestamp(this->executor->get_time()) < earliest)
+        {
+            auto callback = [this, buffer, self = shared_from_this()]() {
+                this->turnaroundPending = false;
+                this->StartWrite(buffer);
+            };
+            this->turnaroundPending = true;
+            this->turnaroundTimer = this->executor->start(earliest.value, callback);
+            return;
+        }
+    }
+
+    this->StartWrite(buffer);
+}
+
+void SerialChannel::StartWrite(const ser4cpp::rseq_t& buffer)
+{
+    auto callback = [this](const std::error_code& ec, size_t num) {
+        this->writeInFlight = false;
+        if (this->gapExpired)
+        {
+            // the gap expired during the write, so the pending read is now the only operation to cancel
+            this->CancelRead();
+        }
+        this->OnWriteCallback(ec, num);
+    };
+
+    auto write = [&](const auto& handler) { async_write(port, asio::buffer(buffer, buffer.length()), handler); };
+
+    this->writeInFlight = true;
+    this->Start(write, callback);
+}
+
+void SerialChannel::ReadMore()
+{
+    auto dest = this->readBuffer.skip(this->numRead);
+
+    auto callback = [this](const std::error_code& ec, size_t num) { this->OnBatchRead(ec, num); };
+
+    auto read = [&](const auto& handler) { port.async_read_some(asio::buffer(dest, dest.length()), handler); };
 
-    async_write(port, asio::buffer(buffer, buffer.length()), this->executor->wrap(callback));
+    this->Start(read, callback);
+}
+
+void SerialChannel::OnBatchRead(const std::error_code& ec, size_t num)
+{
+    this->numRead += num;
+
+    if (num > 0)
+    {
+        this->lastRx = Timestamp(this->executor->get_time());
+    }
+
+    if (this->gapExpired)
+    {
+        // the read was cancelled because the line went quiet, deliver what we have
+        this->CompleteBatch(std::error_code());
+        return;
+    }
+
+    if (ec)
+    {
+        this->CompleteBatch(ec);
+        return;
+    }
+
+    if (this->numRead == this->readBuffer.length() || this->IsCompleteFrame())
+    {
+        this->CompleteBatch(std::error_code());
+        return;
+    }
+
+    // restart the inter-character timer and keep reading into the same buffer
+    this->gapTimer.cancel();
+    auto timeout = [this, generation = this->batchGeneration, self = shared_from_this()]() {
+        this->OnFrameGap(generation);
+    };
+    this->gapTimer = this->executor->start(this->frameGap.value, timeout);
+
+    this->ReadMore();
+}
+
+void SerialChannel::OnFrameGap(uint32_t generation)
+{
+    // a timeout queued before the batch completed must not cut the next batch short
+    if (generation != this->batchGeneration || this->gapExpired)
+        return;
+
+    if (this->numRead > 0)
+    {
+        this->gapExpired = true;
+
+        // cancelling would also abort the write and reset the channel, so wait for it to finish
+        if (!this->writeInFlight)
+        {
+            this->CancelRead();
+        }
+    }
+}
+
+void SerialChannel::CancelRead()
+{
+    std::error_code ec;
+    port.cancel(ec);
+}
+
+void SerialChannel::CompleteBatch(const std::error_code& ec)
+{
+    this->gapTimer.cancel();
+    this->gapExpired = false;
+    ++this->batchGeneration;
+    this->OnReadCallback(ec, this->numRead);
+}
+
+bool SerialChannel::IsCompleteFrame() const
+{
+    // only possible to tell if the batch starts on a frame boundary
+    if (this->numRead < LPDU_HEADER_SIZE)
+        return false;
+
+    const uint8_t* data = this->readBuffer;
+    if (data[LI_START_05] != 0x05 || data[LI_START_64] != 0x64 || data[LI_LENGTH] < LPDU_MIN_LENGTH)
+        return false;
+
+    return this->numRead >= LinkFrame::CalcFrameSize(data[LI_LENGTH] - LPDU_MIN_LENGTH);
 }
 
 void SerialChannel::ShutdownImpl()
 {
+    this->gapTimer.cancel();
+
+    if (this->turnaroundPending)
+    {
+        // the write never started, so complete it here or the channel will never finish shutting down
+        this->turnaroundTimer.cancel();
+        this->turnaroundPending = false;
+        this->OnWriteCallback(asio::error::operation_aborted, 0);
+    }
+
     std::error_code ec;
 #ifdef USE_FLOCK
     /* Explicitly unlock serial device handler before exiting.*/
@@ -23,6 +23,9 @@
 #include "channel/IAsyncChannel.h"
 
 #include "opendnp3/channel/SerialSettings.h"
+#include "opendnp3/util/Timestamp.h"
+
+#include <exe4cpp/Timer.h>
 
 namespace opendnp3
 {
@@ -45,7 +48,34 @@ private:
     void BeginWriteImpl(const ser4cpp::rseq_t& buffer) final;
     void ShutdownImpl() final;
 
+    // --- frame batching ---
+
+    void ReadMore();
+    void OnBatchRead(const std::error_code& ec, size_t num);
+    void OnFrameGap(uint32_t generation);
+    void CancelRead();
+    void CompleteBatch(const std::error_code& ec);
+    bool IsCompleteFrame() const;
+
+    void StartWrite(const ser4cpp::rseq_t& buffer);
+
     asio::serial_port port;
+
+    TimeDuration frameGap;
+    TimeDuration txTurnaround;
+
+    // the destination of the read in progress and the number of bytes accumulated so far
+    ser4cpp::wseq_t readBuffer;
+    size_t numRead = 0;
+    bool gapExpired = false;
+    // incremented when a batch completes so that stale gap timeouts are ignored
+    uint32_t batchGeneration = 0;
+    bool writeInFlight = false;
+    Timestamp lastRx;
+    bool turnaroundPending = false;
+
+    exe4cpp::Timer gapTimer;
+    exe4cpp::Timer turnaroundTimer;
 };
 
 } // namespace opendnp3
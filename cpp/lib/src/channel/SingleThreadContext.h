@@ -0,0 +1,62 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_SINGLETHREADCONTEXT_H
+#define OPENDNP3_SINGLETHREADCONTEXT_H
+
+#include <exe4cpp/asio/StrandExecutor.h>
+
+#include <asio.hpp>
+
+namespace opendnp3
+{
+
+/**
+ * Marks an io_context as run by exactly one thread.
+ *
+ * Every handler of such a context is already serialized, so channels invoke the completion handlers of their
+ * socket operations directly instead of through their strand. Calls into the stacks from other threads keep
+ * going through the executor's post queue, so the public API stays thread-safe.
+ */
+class SingleThreadContext final : public asio::execution_context::service
+{
+public:
+    using key_type = SingleThreadContext;
+
+    static asio::execution_context::id id;
+
+    explicit SingleThreadContext(asio::execution_context& context) : asio::execution_context::service(context) {}
+
+    static void Mark(asio::io_context& context)
+    {
+        asio::make_service<SingleThreadContext>(context);
+    }
+
+    static bool IsMarked(const exe4cpp::StrandExecutor& executor)
+    {
+        return asio::has_service<SingleThreadContext>(*executor.get_context());
+    }
+
+private:
+    void shutdown() final {}
+};
+
+} // namespace opendnp3
+
+#endif
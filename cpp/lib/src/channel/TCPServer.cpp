@@ -24,41 +24,49 @@
 
 #include "opendnp3/logging/LogLevels.h"
 
+#include <algorithm>
 #include <sstream>
 
 namespace opendnp3
 {
 
+#ifdef SO_REUSEPORT
+using reuse_port = asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+#endif
+
 TCPServer::TCPServer(const Logger& logger,
                      const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
                      const IPEndpoint& endpoint,
+                     uint16_t numAcceptors,
                      std::error_code& ec)
     : logger(logger),
       executor(executor),
       endpoint(asio::ip::tcp::v4(), endpoint.port),
-      acceptor(*executor->get_context()),
-      socket(*executor->get_context())
+      isShutdown(false),
+      numAccepting(0),
+      session_id(0)
 {
-    this->Configure(endpoint.address, ec);
+    this->Configure(endpoint.address, numAcceptors, ec);
 }
 
 void TCPServer::Shutdown()
 {
-    if (this->isShutdown)
+    if (this->isShutdown.exchange(true))
         return;
 
-    this->isShutdown = true;
-
-    std::error_code ec;
-    this->acceptor.close(ec);
-
-    if (ec)
+    for (auto& acceptor : this->acceptors)
     {
-        SIMPLE_LOG_BLOCK(logger, flags::ERR, ec.message().c_str());
+        std::error_code ec;
+        acceptor->acceptor.close(ec);
+
+        if (ec)
+        {
+            SIMPLE_LOG_BLOCK(logger, flags::ERR, ec.message().c_str());
+        }
     }
 }
 
-void TCPServer::Configure(const std::string& adapter, std::error_code& ec)
+void TCPServer::Configure(const std::string& adapter, uint16_t numAcceptors, std::error_code& ec)
 {
     auto address = asio::ip::address::from_string(adapter, ec);
 
@@ -68,45 +76,95 @@ void TCPServer::Configure(const std::string& adapter, std::error_code& ec)
     }
 
     endpoint.address(address);
-    acceptor.open(this->endpoint.protocol(), ec);
+
+#ifdef SO_REUSEPORT
+    const bool reusePort = numAcceptors > 1;
+#else
+    if (numAcceptors > 1)
+    {
+        SIMPLE_LOG_BLOCK(this->logger, flags::WARN, "SO_REUSEPORT not supported, using a single acceptor");
+        numAcceptors = 1;
+    }
+    const bool reusePort = false;
+#endif
+
+    for (uint16_t i = 0; i < std::max<uint16_t>(numAcceptors, 1); ++i)
+    {
+        // the first acceptor runs on the server's strand, the others get their own
+        auto acceptor = std::make_unique<Acceptor>((i == 0) ? this->executor : this->executor->fork());
+
+        this->Open(*acceptor, reusePort, ec);
+
+        if (ec)
+        {
+            return;
+        }
+
+        this->acceptors.push_back(std::move(acceptor));
+    }
+
+    std::ostringstream oss;
+    oss << this->endpoint;
+    FORMAT_LOG_BLOCK(this->logger, flags::INFO, "Listening on: %s (acceptors: %u)", oss.str().c_str(),
+                     static_cast<unsigned int>(this->acceptors.size()));
+}
+
+void TCPServer::Open(Acceptor& acceptor, bool reusePort, std::error_code& ec)
+{
+    acceptor.acceptor.open(this->endpoint.protocol(), ec);
 
     if (ec)
     {
         return;
     }
 
-    acceptor.set_option(asio::ip::tcp::acceptor::reuse_address(true), ec);
+    acceptor.acceptor.set_option(asio::ip::tcp::acceptor::reuse_address(true), ec);
 
     if (ec)
     {
         return;
     }
 
-    acceptor.bind(this->endpoint, ec);
+#ifdef SO_REUSEPORT
+    if (reusePort)
+    {
+        acceptor.acceptor.set_option(reuse_port(true), ec);
+
+        if (ec)
+        {
+            return;
+        }
+    }
+#endif
+
+    acceptor.acceptor.bind(this->endpoint, ec);
 
     if (ec)
     {
         return;
     }
 
-    acceptor.listen(asio::socket_base::max_connections, ec);
+    acceptor.acceptor.listen(asio::socket_base::max_connections, ec);
+}
 
-    if (!ec)
+void TCPServer::StartAccept()
+{
+    this->numAccepting = this->acceptors.size();
+
+    for (auto& acceptor : this->acceptors)
     {
-        std::ostringstream oss;
-        oss << this->endpoint;
-        FORMAT_LOG_BLOCK(this->logger, flags::INFO, "Listening on: %s", oss.str().c_str());
+        this->StartAccept(*acceptor);
     }
 }
 
-void TCPServer::StartAccept()
+void TCPServer::StartAccept(Acceptor& acceptor)
 {
     // this ensures that the TCPListener is never deleted during an active callback
-    auto callback = [self = shared_from_this()](std::error_code ec) {
+    auto callback = [self = shared_from_this(), &acceptor](std::error_code ec) {
         if (ec)
         {
             SIMPLE_LOG_BLOCK(self->logger, flags::INFO, ec.message().c_str());
-            self->OnShutdown();
+            self->OnAcceptorStopped();
         }
         else
         {
@@ -115,30 +173,39 @@ void TCPServer::StartAccept()
             // So we need to make sure we are still alive before really accepting the connection.
             if (self->isShutdown)
             {
+                self->OnAcceptorStopped();
                 return;
             }
 
             // For an unknown reason, the socket may not be properly opened when accepted.
             // We simply ignore it.
-            if (!self->socket.is_open())
+            if (!acceptor.socket.is_open())
             {
-                self->StartAccept();
+                self->StartAccept(acceptor);
                 return;
             }
 
-            const auto ID = self->session_id;
-            ++self->session_id;
+            const auto ID = self->session_id++;
 
             FORMAT_LOG_BLOCK(self->logger, flags::INFO, "Accepted connection from: %s",
-                             self->remote_endpoint.address().to_string().c_str());
+                             acceptor.remote_endpoint.address().to_string().c_str());
 
             // method responsible for closing
-            self->AcceptConnection(ID, self->executor, std::move(self->socket));
-            self->StartAccept();
+            self->AcceptConnection(ID, acceptor.executor, std::move(acceptor.socket));
+            self->StartAccept(acceptor);
         }
     };
 
-    this->acceptor.async_accept(socket, remote_endpoint, this->executor->wrap(callback));
+    acceptor.acceptor.async_accept(acceptor.socket, acceptor.remote_endpoint, acceptor.executor->wrap(callback));
+}
+
+void TCPServer::OnAcceptorStopped()
+{
+    // the server is done once every acceptor has stopped
+    if (--this->numAccepting == 0)
+    {
+        this->OnShutdown();
+    }
 }
 
 } // namespace opendnp3
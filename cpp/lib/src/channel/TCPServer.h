@@ -27,7 +27,9 @@
 
 #include <exe4cpp/asio/StrandExecutor.h>
 
+#include <atomic>
 #include <memory>
+#include <vector>
 
 namespace opendnp3
 {
@@ -35,6 +37,8 @@ namespace opendnp3
 /**
  * Binds and listens on an IPv4 TCP port
  *
+ * Can bind multiple acceptors to the same port with SO_REUSEPORT, each one accepting on its own strand
+ *
  * Meant to be used exclusively as a shared_ptr
  */
 class TCPServer : public std::enable_shared_from_this<TCPServer>, public IListener, private Uncopyable
@@ -44,6 +48,15 @@ public:
     TCPServer(const Logger& logger,
               const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
               const IPEndpoint& endpoint,
+              std::error_code& ec)
+        : TCPServer(logger, executor, endpoint, 1, ec)
+    {
+    }
+
+    TCPServer(const Logger& logger,
+              const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
+              const IPEndpoint& endpoint,
+              uint16_t numAcceptors,
               std::error_code& ec);
 
     /// Implement IListener
@@ -59,21 +72,39 @@ protected:
                                   asio::ip::tcp::socket)
         = 0;
 
-    /// Start asynchronously accepting connections on the strand
+    /// Start asynchronously accepting connections on the strand of each acceptor
     void StartAccept();
 
     Logger logger;
     std::shared_ptr<exe4cpp::StrandExecutor> executor;
 
 private:
-    void Configure(const std::string& adapter, std::error_code& ec);
+    struct Acceptor
+    {
+        explicit Acceptor(const std::shared_ptr<exe4cpp::StrandExecutor>& executor)
+            : executor(executor), acceptor(*executor->get_context()), socket(*executor->get_context())
+        {
+        }
+
+        std::shared_ptr<exe4cpp::StrandExecutor> executor;
+        asio::ip::tcp::acceptor acceptor;
+        asio::ip::tcp::socket socket;
+        asio::ip::tcp::endpoint remote_endpoint;
+    };
+
+    void Configure(const std::string& adapter, uint16_t numAcceptors, std::error_code& ec);
+
+    void Open(Acceptor& acceptor, bool reusePort, std::error_code& ec);
+
+    void StartAccept(Acceptor& acceptor);
+
+    void OnAcceptorStopped();
 
     asio::ip::tcp::endpoint endpoint;
-    asio::ip::tcp::acceptor acceptor;
-    asio::ip::tcp::socket socket;
-    asio::ip::tcp::endpoint remote_endpoint;
-    bool isShutdown = false;
-    uint64_t session_id = 0;
+    std::vector<std::unique_ptr<Acceptor>> acceptors;
+    std::atomic<bool> isShutdown;
+    std::atomic<size_t> numAccepting;
+    std::atomic<uint64_t> session_id;
 };
 
 } // namespace opendnp3
@@ -33,14 +33,20 @@ void TCPSocketChannel::BeginReadImpl(ser4cpp::wseq_t dest)
 {
     auto callback = [this](const std::error_code& ec, size_t num) { this->OnReadCallback(ec, num); };
 
-    socket.async_read_some(asio::buffer(dest, dest.length()), this->executor->wrap(callback));
+    auto read = [&](const auto& handler) { socket.async_read_some(asio::buffer(dest, dest.length()), handler); };
+
+    this->Start(read, callback);
 }
 
 void TCPSocketChannel::BeginWriteImpl(const ser4cpp::rseq_t& buffer)
 {
     auto callback = [this](const std::error_code& ec, size_t num) { this->OnWriteCallback(ec, num); };
 
-    asio::async_write(socket, asio::buffer(buffer, buffer.length()), this->executor->wrap(callback));
+    auto write = [&](const auto& handler) {
+        asio::async_write(socket, asio::buffer(buffer, buffer.length()), handler);
+    };
+
+    this->Start(write, callback);
 }
 
 void TCPSocketChannel::ShutdownImpl()
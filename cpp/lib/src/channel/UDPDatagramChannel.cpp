@@ -0,0 +1,137 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "channel/UDPDatagramChannel.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace opendnp3
+{
+
+UDPDatagramChannel::UDPDatagramChannel(const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
+                                       std::shared_ptr<UDPServer> server,
+                                       const UDPRoute& route)
+    : IAsyncChannel(executor), route(route), server(std::move(server))
+{
+}
+
+bool UDPDatagramChannel::OnDatagram(const ser4cpp::rseq_t& data)
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        if (this->datagrams.size() >= MAX_QUEUED_DATAGRAMS)
+        {
+            return false;
+        }
+
+        const auto begin = static_cast<const uint8_t*>(data);
+        this->datagrams.emplace_back(begin, begin + data.length());
+    }
+
+    this->executor->post([self = Self()]() { self->TryDeliver(); });
+    return true;
+}
+
+void UDPDatagramChannel::OnSendComplete(const std::error_code& ec, size_t num)
+{
+    this->executor->post([self = Self(), ec, num]() { self->OnWriteCallback(ec, num); });
+}
+
+void UDPDatagramChannel::OnServerClosed()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->serverClosed = true;
+    }
+
+    this->executor->post([self = Self()]() { self->TryDeliver(); });
+}
+
+void UDPDatagramChannel::BeginReadImpl(ser4cpp::wseq_t buffer)
+{
+    this->readBuffer = buffer;
+    this->readPending = true;
+    this->TryDeliver();
+}
+
+void UDPDatagramChannel::BeginWriteImpl(const ser4cpp::rseq_t& buffer)
+{
+    this->server->Send(Self(), buffer);
+}
+
+void UDPDatagramChannel::ShutdownImpl()
+{
+    this->server->Remove(Self());
+
+    if (this->readPending)
+    {
+        // nothing will ever complete this read, so do it here to let the shutdown finish
+        this->readPending = false;
+        this->OnReadCallback(asio::error::operation_aborted, 0);
+    }
+}
+
+void UDPDatagramChannel::TryDeliver()
+{
+    if (!this->readPending)
+        return;
+
+    size_t num = 0;
+    bool closed = false;
+
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        if (!this->datagrams.empty())
+        {
+            // a datagram larger than the read buffer is delivered across multiple reads
+            const auto& front = this->datagrams.front();
+            num = std::min(front.size() - this->frontOffset, this->readBuffer.length());
+            std::memcpy(this->readBuffer, front.data() + this->frontOffset, num);
+            this->frontOffset += num;
+
+            if (this->frontOffset == front.size())
+            {
+                this->datagrams.pop_front();
+                this->frontOffset = 0;
+            }
+        }
+        else
+        {
+            closed = this->serverClosed;
+        }
+    }
+
+    if (num > 0)
+    {
+        this->readPending = false;
+        this->OnReadCallback(std::error_code(), num);
+    }
+    else if (closed)
+    {
+        this->readPending = false;
+        this->OnReadCallback(asio::error::operation_aborted, 0);
+    }
+}
+
+} // namespace opendnp3
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_UDPDATAGRAMCHANNEL_H
+#define OPENDNP3_UDPDATAGRAMCHANNEL_H
+
+#include "channel/IAsyncChannel.h"
+#include "channel/UDPServer.h"
+
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+ * Virtual channel for a single route on a shared UDPServer socket.
+ *
+ * Datagrams are pushed by the server from its strand and consumed by the
+ * channel's owner from the channel's strand.
+ */
+class UDPDatagramChannel final : public IAsyncChannel
+{
+    // datagrams received beyond this while the owner isn't reading are dropped
+    static const size_t MAX_QUEUED_DATAGRAMS = 16;
+
+public:
+    static std::shared_ptr<UDPDatagramChannel> Create(const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
+                                                      const std::shared_ptr<UDPServer>& server,
+                                                      const UDPRoute& route)
+    {
+        return std::make_shared<UDPDatagramChannel>(executor, server, route);
+    }
+
+    UDPDatagramChannel(const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
+                       std::shared_ptr<UDPServer> server,
+                       const UDPRoute& route);
+
+    /// --- called by the server from its strand ---
+
+    // returns false if the datagram was dropped
+    bool OnDatagram(const ser4cpp::rseq_t& data);
+
+    void OnSendComplete(const std::error_code& ec, size_t num);
+
+    void OnServerClosed();
+
+    const UDPRoute route;
+
+private:
+    void BeginReadImpl(ser4cpp::wseq_t buffer) final;
+    void BeginWriteImpl(const ser4cpp::rseq_t& buffer) final;
+    void ShutdownImpl() final;
+
+    void TryDeliver();
+
+    std::shared_ptr<UDPDatagramChannel> Self()
+    {
+        return std::static_pointer_cast<UDPDatagramChannel>(shared_from_this());
+    }
+
+    const std::shared_ptr<UDPServer> server;
+
+    // only accessed from the channel strand
+    bool readPending = false;
+    ser4cpp::wseq_t readBuffer;
+
+    // shared with the server strand
+    std::mutex mutex;
+    bool serverClosed = false;
+    size_t frontOffset = 0;
+    std::deque<std::vector<uint8_t>> datagrams;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -0,0 +1,392 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "channel/UDPServer.h"
+
+#include "channel/UDPDatagramChannel.h"
+#include "link/LinkLayerConstants.h"
+#include "logging/LogMacros.h"
+
+#include "opendnp3/logging/LogLevels.h"
+
+#include <ser4cpp/serialization/LittleEndian.h>
+
+#ifdef __linux__
+#include <sys/socket.h>
+
+#include <cerrno>
+#endif
+
+#include <cstring>
+#include <sstream>
+
+namespace opendnp3
+{
+
+UDPServer::UDPServer(const Logger& logger,
+                     const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
+                     const IPEndpoint& endpoint,
+                     std::error_code& ec)
+    : logger(logger), executor(executor), socket(*executor->get_context()), rxBuffers(BATCH_SIZE * MAX_DATAGRAM_SIZE)
+{
+    this->Configure(endpoint, ec);
+}
+
+void UDPServer::Shutdown()
+{
+    this->executor->post([self = shared_from_this()]() { self->Close(); });
+}
+
+void UDPServer::Send(const std::shared_ptr<UDPDatagramChannel>& channel, const ser4cpp::rseq_t& data)
+{
+    auto send = [self = shared_from_this(), channel, data]() {
+        if (self->isShutdown)
+        {
+            channel->OnSendComplete(asio::error::operation_aborted, 0);
+            return;
+        }
+
+        self->txQueue.emplace_back(channel, data);
+        self->ScheduleFlush();
+    };
+
+    this->executor->post(send);
+}
+
+void UDPServer::Remove(const std::shared_ptr<UDPDatagramChannel>& channel)
+{
+    auto remove = [self = shared_from_this(), channel]() {
+        const auto iter = self->routes.find(channel->route);
+        if (iter != self->routes.end() && iter->second == channel)
+        {
+            self->routes.erase(iter);
+        }
+    };
+
+    this->executor->post(remove);
+}
+
+void UDPServer::Configure(const IPEndpoint& endpoint, std::error_code& ec)
+{
+    const auto address = asio::ip::address::from_string(endpoint.address, ec);
+
+    if (ec)
+    {
+        return;
+    }
+
+    const asio::ip::udp::endpoint local(address, endpoint.port);
+
+    socket.open(local.protocol(), ec);
+
+    if (ec)
+    {
+        return;
+    }
+
+    socket.set_option(asio::ip::udp::socket::reuse_address(true), ec);
+
+    if (ec)
+    {
+        return;
+    }
+
+    socket.bind(local, ec);
+
+    if (ec)
+    {
+        return;
+    }
+
+    // all I/O is done with non-blocking batch calls after a readiness notification
+    socket.non_blocking(true, ec);
+
+    if (!ec)
+    {
+        std::ostringstream oss;
+        oss << local;
+        FORMAT_LOG_BLOCK(this->logger, flags::INFO, "Listening on: %s", oss.str().c_str());
+    }
+}
+
+void UDPServer::StartReceive()
+{
+    auto callback = [self = shared_from_this()](const std::error_code& ec) {
+        if (self->isShutdown)
+        {
+            return;
+        }
+
+        if (ec)
+        {
+            SIMPLE_LOG_BLOCK(self->logger, flags::INFO, ec.message().c_str());
+            self->Close();
+            return;
+        }
+
+        self->ReceiveBatch();
+        self->StartReceive();
+    };
+
+    socket.async_wait(asio::ip::udp::socket::wait_read, this->executor->wrap(callback));
+}
+
+void UDPServer::ReceiveBatch()
+{
+#ifdef __linux__
+    mmsghdr messages[BATCH_SIZE];
+    iovec vectors[BATCH_SIZE];
+    sockaddr_storage addresses[BATCH_SIZE];
+
+    while (true)
+    {
+        for (size_t i = 0; i < BATCH_SIZE; ++i)
+        {
+            vectors[i].iov_base = this->rxBuffers.data() + i * MAX_DATAGRAM_SIZE;
+            vectors[i].iov_len = MAX_DATAGRAM_SIZE;
+            messages[i].msg_hdr = msghdr{};
+            messages[i].msg_hdr.msg_name = &addresses[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+            messages[i].msg_hdr.msg_iov = &vectors[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        const auto num = recvmmsg(socket.native_handle(), messages, BATCH_SIZE, MSG_DONTWAIT, nullptr);
+
+        if (num < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            {
+                FORMAT_LOG_BLOCK(this->logger, flags::WARN, "recvmmsg error: %d", errno);
+            }
+            return;
+        }
+
+        for (int i = 0; i < num; ++i)
+        {
+            asio::ip::udp::endpoint source;
+            const auto namelen = messages[i].msg_hdr.msg_namelen;
+            if (namelen > source.capacity())
+            {
+                continue;
+            }
+            std::memcpy(source.data(), &addresses[i], namelen);
+            source.resize(namelen);
+
+            const auto data = this->rxBuffers.data() + i * MAX_DATAGRAM_SIZE;
+            this->OnDatagram(source, ser4cpp::rseq_t(data, messages[i].msg_len));
+        }
+
+        if (static_cast<size_t>(num) < BATCH_SIZE)
+        {
+            return;
+        }
+    }
+#else
+    for (size_t i = 0; i < BATCH_SIZE; ++i)
+    {
+        std::error_code ec;
+        asio::ip::udp::endpoint source;
+        const auto num = socket.receive_from(asio::buffer(this->rxBuffers.data(), MAX_DATAGRAM_SIZE), source, 0, ec);
+
+        if (ec)
+        {
+            if (ec != asio::error::would_block)
+            {
+                SIMPLE_LOG_BLOCK(this->logger, flags::WARN, ec.message().c_str());
+            }
+            return;
+        }
+
+        this->OnDatagram(source, ser4cpp::rseq_t(this->rxBuffers.data(), num));
+    }
+#endif
+}
+
+void UDPServer::OnDatagram(const asio::ip::udp::endpoint& source, const ser4cpp::rseq_t& data)
+{
+    // route on the addresses of the first frame in the datagram
+    if (data.length() < LPDU_HEADER_SIZE || data[LI_START_05] != 0x05 || data[LI_START_64] != 0x64)
+    {
+        std::ostringstream oss;
+        oss << source;
+        FORMAT_LOG_BLOCK(this->logger, flags::WARN, "Dropping datagram w/o link header from: %s", oss.str().c_str());
+        return;
+    }
+
+    auto header = data.skip(LI_DESTINATION);
+    Addresses addresses;
+    ser4cpp::LittleEndian::read(header, addresses.destination, addresses.source);
+
+    const UDPRoute route(source, addresses);
+    auto iter = this->routes.find(route);
+
+    if (iter == this->routes.end())
+    {
+        const auto id = this->session_id;
+        ++this->session_id;
+
+        auto channel = this->AcceptRoute(id, route);
+        if (!channel)
+        {
+            return;
+        }
+
+        iter = this->routes.insert(std::make_pair(route, channel)).first;
+    }
+
+    if (!iter->second->OnDatagram(data))
+    {
+        std::ostringstream oss;
+        oss << source;
+        FORMAT_LOG_BLOCK(this->logger, flags::WARN, "Receive queue full, dropping datagram from: %s",
+                         oss.str().c_str());
+    }
+}
+
+void UDPServer::ScheduleFlush()
+{
+    // coalesce all the sends posted in the meantime into as few system calls as possible
+    if (this->flushScheduled || this->waitingForWrite)
+    {
+        return;
+    }
+
+    this->flushScheduled = true;
+
+    this->executor->post([self = shared_from_this()]() {
+        self->flushScheduled = false;
+        self->Flush();
+    });
+}
+
+void UDPServer::Flush()
+{
+    while (!this->txQueue.empty() && !this->isShutdown)
+    {
+#ifdef __linux__
+        mmsghdr messages[BATCH_SIZE];
+        iovec vectors[BATCH_SIZE];
+
+        const auto count = (this->txQueue.size() < BATCH_SIZE) ? this->txQueue.size() : BATCH_SIZE;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto& tx = this->txQueue[i];
+            vectors[i].iov_base = const_cast<uint8_t*>(static_cast<const uint8_t*>(tx.data));
+            vectors[i].iov_len = tx.data.length();
+            messages[i].msg_hdr = msghdr{};
+            messages[i].msg_hdr.msg_name = const_cast<sockaddr*>(tx.channel->route.endpoint.data());
+            messages[i].msg_hdr.msg_namelen = static_cast<socklen_t>(tx.channel->route.endpoint.size());
+            messages[i].msg_hdr.msg_iov = &vectors[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        const auto num = sendmmsg(socket.native_handle(), messages, static_cast<unsigned int>(count), MSG_DONTWAIT);
+
+        if (num < 0)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+            {
+                break;
+            }
+
+            // fail the datagram at the front and try the rest
+            this->CompleteFront(std::error_code(errno, std::system_category()), 0);
+            continue;
+        }
+
+        for (int i = 0; i < num; ++i)
+        {
+            this->CompleteFront(std::error_code(), messages[i].msg_len);
+        }
+#else
+        std::error_code ec;
+        const auto& tx = this->txQueue.front();
+        const auto num = socket.send_to(asio::buffer(tx.data, tx.data.length()), tx.channel->route.endpoint, 0, ec);
+
+        if (ec == asio::error::would_block)
+        {
+            break;
+        }
+
+        this->CompleteFront(ec, num);
+#endif
+    }
+
+    if (!this->txQueue.empty() && !this->isShutdown)
+    {
+        // socket buffer is full, wait until it drains
+        this->waitingForWrite = true;
+
+        auto callback = [self = shared_from_this()](const std::error_code& ec) {
+            self->waitingForWrite = false;
+            if (ec)
+            {
+                self->Close();
+            }
+            else
+            {
+                self->Flush();
+            }
+        };
+
+        socket.async_wait(asio::ip::udp::socket::wait_write, this->executor->wrap(callback));
+    }
+}
+
+void UDPServer::CompleteFront(const std::error_code& ec, size_t num)
+{
+    const auto channel = this->txQueue.front().channel;
+    this->txQueue.pop_front();
+    channel->OnSendComplete(ec, num);
+}
+
+void UDPServer::Close()
+{
+    if (this->isShutdown)
+        return;
+
+    this->isShutdown = true;
+
+    std::error_code ec;
+    this->socket.close(ec);
+
+    if (ec)
+    {
+        SIMPLE_LOG_BLOCK(logger, flags::ERR, ec.message().c_str());
+    }
+
+    while (!this->txQueue.empty())
+    {
+        this->CompleteFront(asio::error::operation_aborted, 0);
+    }
+
+    for (auto& route : this->routes)
+    {
+        route.second->OnServerClosed();
+    }
+
+    this->routes.clear();
+
+    this->OnShutdown();
+}
+
+} // namespace opendnp3
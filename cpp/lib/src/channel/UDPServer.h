@@ -0,0 +1,145 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_UDPSERVER_H
+#define OPENDNP3_UDPSERVER_H
+
+#include "opendnp3/channel/IListener.h"
+#include "opendnp3/channel/IPEndpoint.h"
+#include "opendnp3/link/Addresses.h"
+#include "opendnp3/logging/Logger.h"
+#include "opendnp3/util/Uncopyable.h"
+
+#include <ser4cpp/container/SequenceTypes.h>
+
+#include <exe4cpp/asio/StrandExecutor.h>
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace opendnp3
+{
+
+class UDPDatagramChannel;
+
+/**
+ * A remote endpoint plus the link addresses of the frames it sends (source = remote device, destination = us)
+ */
+struct UDPRoute
+{
+    UDPRoute() = default;
+
+    UDPRoute(const asio::ip::udp::endpoint& endpoint, const Addresses& addresses)
+        : endpoint(endpoint), addresses(addresses)
+    {
+    }
+
+    bool operator<(const UDPRoute& other) const
+    {
+        if (endpoint != other.endpoint)
+            return endpoint < other.endpoint;
+        if (addresses.source != other.addresses.source)
+            return addresses.source < other.addresses.source;
+        return addresses.destination < other.addresses.destination;
+    }
+
+    asio::ip::udp::endpoint endpoint;
+    Addresses addresses;
+};
+
+/**
+ * Binds a single UDP socket and demultiplexes the received datagrams to a virtual channel
+ * per route. Reception and transmission are batched (recvmmsg/sendmmsg on Linux).
+ */
+class UDPServer : public std::enable_shared_from_this<UDPServer>, public IListener, private Uncopyable
+{
+    // maximum number of datagrams read or written per system call
+    static const size_t BATCH_SIZE = 32;
+
+    // large enough for a full application fragment worth of link frames
+    static const size_t MAX_DATAGRAM_SIZE = 4096;
+
+public:
+    UDPServer(const Logger& logger,
+              const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
+              const IPEndpoint& endpoint,
+              std::error_code& ec);
+
+    /// Implement IListener
+    void Shutdown() override final;
+
+    /// --- called by the virtual channels from their own strands ---
+
+    void Send(const std::shared_ptr<UDPDatagramChannel>& channel, const ser4cpp::rseq_t& data);
+
+    void Remove(const std::shared_ptr<UDPDatagramChannel>& channel);
+
+protected:
+    /// Inherited classes must define these functions
+
+    virtual void OnShutdown() = 0;
+
+    /// Create a channel for a previously unknown route, or return nullptr to drop the datagram
+    virtual std::shared_ptr<UDPDatagramChannel> AcceptRoute(uint64_t sessionid, const UDPRoute& route) = 0;
+
+    /// Start asynchronously receiving datagrams on the strand
+    void StartReceive();
+
+    Logger logger;
+    std::shared_ptr<exe4cpp::StrandExecutor> executor;
+
+private:
+    struct Transmission
+    {
+        Transmission(const std::shared_ptr<UDPDatagramChannel>& channel, const ser4cpp::rseq_t& data)
+            : channel(channel), data(data)
+        {
+        }
+
+        std::shared_ptr<UDPDatagramChannel> channel;
+        ser4cpp::rseq_t data;
+    };
+
+    void Configure(const IPEndpoint& endpoint, std::error_code& ec);
+
+    void ReceiveBatch();
+    void OnDatagram(const asio::ip::udp::endpoint& source, const ser4cpp::rseq_t& data);
+
+    void ScheduleFlush();
+    void Flush();
+    void CompleteFront(const std::error_code& ec, size_t num);
+
+    void Close();
+
+    asio::ip::udp::socket socket;
+    bool isShutdown = false;
+    bool flushScheduled = false;
+    bool waitingForWrite = false;
+    uint64_t session_id = 0;
+
+    std::vector<uint8_t> rxBuffers;
+    std::map<UDPRoute, std::shared_ptr<UDPDatagramChannel>> routes;
+    std::deque<Transmission> txQueue;
+};
+
+} // namespace opendnp3
+
+#endif
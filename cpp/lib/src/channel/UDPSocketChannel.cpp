@@ -33,14 +33,18 @@ void UDPSocketChannel::BeginReadImpl(ser4cpp::wseq_t dest)
 {
     auto callback = [this](const std::error_code& ec, size_t num) { this->OnReadCallback(ec, num); };
 
-    socket.async_receive(asio::buffer(dest, dest.length()), this->executor->wrap(callback));
+    auto read = [&](const auto& handler) { socket.async_receive(asio::buffer(dest, dest.length()), handler); };
+
+    this->Start(read, callback);
 }
 
 void UDPSocketChannel::BeginWriteImpl(const ser4cpp::rseq_t& buffer)
 {
     auto callback = [this](const std::error_code& ec, size_t num) { this->OnWriteCallback(ec, num); };
 
-    socket.async_send(asio::buffer(buffer, buffer.length()), this->executor->wrap(callback));
+    auto write = [&](const auto& handler) { socket.async_send(asio::buffer(buffer, buffer.length()), handler); };
+
+    this->Start(write, callback);
 }
 
 void UDPSocketChannel::ShutdownImpl()
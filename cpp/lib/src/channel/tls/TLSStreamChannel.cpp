@@ -35,14 +35,18 @@ void TLSStreamChannel::BeginReadImpl(ser4cpp::wseq_t dest)
 {
     auto callback = [this](const std::error_code& ec, size_t num) { this->OnReadCallback(ec, num); };
 
-    stream->async_read_some(asio::buffer(dest, dest.length()), this->executor->wrap(callback));
+    auto read = [&](const auto& handler) { stream->async_read_some(asio::buffer(dest, dest.length()), handler); };
+
+    this->Start(read, callback);
 }
 
 void TLSStreamChannel::BeginWriteImpl(const ser4cpp::rseq_t& data)
 {
     auto callback = [this](const std::error_code& ec, size_t num) { this->OnWriteCallback(ec, num); };
 
-    asio::async_write(*stream, asio::buffer(data, data.length()), this->executor->wrap(callback));
+    auto write = [&](const auto& handler) { asio::async_write(*stream, asio::buffer(data, data.length()), handler); };
+
+    this->Start(write, callback);
 }
 
 void TLSStreamChannel::ShutdownImpl()
@@ -30,8 +30,11 @@
 namespace opendnp3
 {
 
+// large enough for captures of links configured with fragments well above the default size
+const uint32_t MAX_DECODED_APDU_SIZE = 65536;
+
 DecoderImpl::DecoderImpl(IDecoderCallbacks& callbacks, const Logger& logger)
-    : callbacks(&callbacks), logger(logger), link(logger), transportRx(logger, 2048)
+    : callbacks(&callbacks), logger(logger), link(logger), transportRx(logger, MAX_DECODED_APDU_SIZE)
 {
 }
 
@@ -23,6 +23,9 @@
 #include "link/LinkFrame.h"
 #include "link/PriLinkLayerStates.h"
 #include "link/SecLinkLayerStates.h"
+#include "transport/TransportHeader.h"
+
+#include <algorithm>
 
 namespace opendnp3
 {
@@ -39,6 +42,12 @@ LinkContext::LinkContext(const Logger& logger,
       txMode(LinkTransmitMode::Idle),
       executor(executor),
       nextReadFCB(false),
+      isReadSeqValid(false),
+      nextReadSeq(0),
+      numPendingAck(0),
+      pendingAckDestination(0),
+      isRemoteReset(false),
+      numRetry(0),
       isOnline(false),
       keepAliveTimeout(false),
       lastMessageTimestamp(executor->get_time()),
@@ -46,7 +55,10 @@ LinkContext::LinkContext(const Logger& logger,
       pSecState(&SLLS_NotReset::Instance()),
       listener(std::move(listener)),
       upper(std::move(upper)),
-      pSession(&session)
+      txReadyAction([](IUpperLayer& upper) { upper.OnTxReady(); }),
+      pSession(&session),
+      confirmWindow(std::min(std::max(config.ConfirmWindow, uint8_t(1)), uint8_t(MAX_CONFIRM_WINDOW))),
+      confirmed(config.UseConfirms ? confirmWindow : 0)
 {
 }
 
@@ -87,6 +99,15 @@ bool LinkContext::OnLowerLayerDown()
     pendingPriTx.clear();
     pendingSecTx.clear();
 
+    isReadSeqValid = false;
+    numPendingAck = 0;
+    isRemoteReset = false;
+    numRetry = 0;
+    numConfirmed = 0;
+    numConfirmedSent = 0;
+    isConfirmedTxActive = false;
+    hasMoreSegments = false;
+
     rspTimeoutTimer.cancel();
     keepAliveTimer.cancel();
 
@@ -114,6 +135,7 @@ bool LinkContext::SetTxSegment(ITransportSegment& segments)
     }
 
     this->pSegments = &segments;
+    this->hasMoreSegments = true;
     return true;
 }
 
@@ -154,6 +176,130 @@ ser4cpp::rseq_t LinkContext::FormatPrimaryBufferWithUnconfirmed(const Addresses&
     return output;
 }
 
+void LinkContext::FillConfirmedWindow()
+{
+    while (this->hasMoreSegments && this->numConfirmed < this->confirmWindow)
+    {
+        auto& segment = this->GetConfirmed(this->numConfirmed);
+        auto dest = segment.tpdu.as_wseq();
+        segment.length = dest.copy_from(this->pSegments->GetSegment()).length();
+        segment.fcb = this->nextWriteFCB;
+
+        this->nextWriteFCB = !this->nextWriteFCB;
+        ++this->numConfirmed;
+        this->hasMoreSegments = this->pSegments->Advance();
+    }
+}
+
+void LinkContext::TransmitNextConfirmed()
+{
+    if (this->isConfirmedTxActive || this->numConfirmedSent == this->numConfirmed)
+    {
+        return;
+    }
+
+    const auto& segment = this->GetConfirmed(this->numConfirmedSent);
+    const auto& addr = this->pSegments->GetAddresses();
+    auto buffer = this->priTxBuffer.as_wseq();
+    auto output = LinkFrame::FormatConfirmedUserData(buffer, config.IsMaster, segment.fcb, addr.destination,
+                                                     addr.source, segment.tpdu.as_seq(segment.length), &logger);
+    FORMAT_HEX_BLOCK(logger, flags::LINK_TX_HEX, output, 10, 18);
+
+    ++this->numConfirmedSent;
+    this->isConfirmedTxActive = true;
+    this->QueueTransmit(output, true);
+}
+
+void LinkContext::PopConfirmed()
+{
+    this->confirmedStart = (this->confirmedStart + 1) % this->confirmWindow;
+    --this->numConfirmed;
+
+    if (this->numConfirmedSent > 0)
+    {
+        --this->numConfirmedSent;
+    }
+}
+
+bool LinkContext::RetransmitConfirmed()
+{
+    if (this->numRetry >= this->config.NumRetry)
+    {
+        return false;
+    }
+
+    // go back to the oldest unacknowledged frame, the secondary discards anything it received past a lost frame
+    ++this->numRetry;
+    this->numConfirmedSent = 0;
+    this->TransmitNextConfirmed();
+    return true;
+}
+
+void LinkContext::RenumberConfirmed()
+{
+    this->nextWriteFCB = true;
+    for (uint8_t i = 0; i < this->numConfirmed; ++i)
+    {
+        this->GetConfirmed(i).fcb = this->nextWriteFCB;
+        this->nextWriteFCB = !this->nextWriteFCB;
+    }
+    this->numConfirmedSent = 0;
+}
+
+void LinkContext::FailConfirmed()
+{
+    this->isRemoteReset = false;
+    this->numRetry = 0;
+    this->numConfirmed = 0;
+    this->numConfirmedSent = 0;
+    this->hasMoreSegments = false;
+}
+
+bool LinkContext::TryCompleteConfirmed()
+{
+    if (this->numConfirmed > 0 || this->hasMoreSegments || this->isConfirmedTxActive)
+    {
+        return false;
+    }
+
+    this->CancelTimer();
+    this->CompleteSendOperation();
+    return true;
+}
+
+bool LinkContext::OnWindowedUserData(const Message& message)
+{
+    if (message.payload.is_empty())
+    {
+        ++statistics.numUnexpectedFrame;
+        SIMPLE_LOG_BLOCK(logger, flags::WARN, "ConfirmedUserData ignored: no transport header");
+        return false;
+    }
+
+    const TransportHeader header(message.payload[0]);
+
+    if (!this->isReadSeqValid || header.seq == this->nextReadSeq)
+    {
+        this->isReadSeqValid = true;
+        this->nextReadSeq = (header.seq + 1) % 64;
+        this->PushDataUp(message);
+        return true;
+    }
+
+    // a frame within the window behind the expected one was already passed up, the primary missed its ACK
+    const auto distance = (this->nextReadSeq + 64 - header.seq) % 64;
+    if (distance <= this->confirmWindow)
+    {
+        SIMPLE_LOG_BLOCK(logger, flags::DBG, "ConfirmedUserData ignored: repeated transport sequence");
+        return true;
+    }
+
+    // a frame ahead of a lost one isn't acknowledged so that the primary goes back and retransmits the lost frame
+    FORMAT_LOG_BLOCK(logger, flags::WARN, "ConfirmedUserData ignored: expected transport sequence %u, received %u",
+                     this->nextReadSeq, header.seq);
+    return false;
+}
+
 void LinkContext::QueueTransmit(const ser4cpp::rseq_t& buffer, bool primary)
 {
     if (txMode == LinkTransmitMode::Idle)
@@ -200,6 +346,14 @@ void LinkContext::QueueRequestLinkStatus(uint16_t destination)
     this->QueueTransmit(buffer, true);
 }
 
+void LinkContext::QueueResetLinks(uint16_t destination)
+{
+    auto dest = priTxBuffer.as_wseq();
+    auto buffer = LinkFrame::FormatResetLinkStates(dest, config.IsMaster, destination, this->config.LocalAddr, &logger);
+    FORMAT_HEX_BLOCK(logger, flags::LINK_TX_HEX, buffer, 10, 18);
+    this->QueueTransmit(buffer, true);
+}
+
 void LinkContext::PushDataUp(const Message& message)
 {
     upper->OnReceive(message);
@@ -209,9 +363,12 @@ void LinkContext::CompleteSendOperation()
 {
     this->pSegments = nullptr;
 
-    auto callback = [upper = upper]() { upper->OnTxReady(); };
+    if (!this->txReadyAction.Post(*this->executor, this->upper))
+    {
+        auto callback = [upper = upper]() { upper->OnTxReady(); };
 
-    this->executor->post(callback);
+        this->executor->post(callback);
+    }
 }
 
 void LinkContext::TryStartTransmission()
@@ -223,7 +380,8 @@ void LinkContext::TryStartTransmission()
 
     if (this->pSegments)
     {
-        this->pPriState = &pPriState->TrySendUnconfirmed(*this, *pSegments);
+        this->pPriState = this->config.UseConfirms ? &pPriState->TrySendConfirmed(*this, *pSegments)
+                                                   : &pPriState->TrySendUnconfirmed(*this, *pSegments);
     }
 }
 
@@ -253,6 +411,7 @@ void LinkContext::OnResponseTimeout()
 
 void LinkContext::StartResponseTimer()
 {
+    rspTimeoutTimer.cancel();
     rspTimeoutTimer = executor->start(config.Timeout.value, [this]() { this->OnResponseTimeout(); });
 }
 
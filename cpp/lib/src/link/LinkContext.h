@@ -20,6 +20,7 @@
 #ifndef OPENDNP3_LINK_CONTEXT_H
 #define OPENDNP3_LINK_CONTEXT_H
 
+#include "PostedAction.h"
 #include "link/ILinkLayer.h"
 #include "link/ILinkSession.h"
 #include "link/ILinkTx.h"
@@ -37,6 +38,8 @@
 
 #include <exe4cpp/IExecutor.h>
 
+#include <vector>
+
 namespace opendnp3
 {
 
@@ -53,8 +56,18 @@ enum class LinkTransmitMode : uint8_t
 //	@section desc Implements the contextual state of DNP3 Data Link Layer
 class LinkContext
 {
+    // a transport segment sent with CONFIRMED_USER_DATA that hasn't been acknowledged yet
+    struct ConfirmedSegment
+    {
+        ser4cpp::StaticBuffer<LPDU_MAX_USER_DATA_SIZE> tpdu;
+        size_t length = 0;
+        bool fcb = false;
+    };
 
 public:
+    // the largest configurable number of outstanding confirmed frames, well below the 64 transport sequence numbers
+    static const uint8_t MAX_CONFIRM_WINDOW = 16;
+
     LinkContext(const Logger& logger,
                 const std::shared_ptr<exe4cpp::IExecutor>&,
                 std::shared_ptr<IUpperLayer>,
@@ -72,6 +85,39 @@ public:
     {
         nextReadFCB = !nextReadFCB;
     }
+    void ResetReadSequence()
+    {
+        isReadSeqValid = false;
+    }
+
+    // --- helpers for the window of outstanding confirmed frames ---
+
+    // format as many segments as the window allows
+    void FillConfirmedWindow();
+    // transmit the next frame in the window if the previous transmission has completed
+    void TransmitNextConfirmed();
+    // an ACK was received for the oldest outstanding frame
+    void PopConfirmed();
+    // restart the transmission from the oldest outstanding frame, false if no retries remain
+    bool RetransmitConfirmed();
+    // assign new FCBs to the outstanding frames after the remote's link has been reset
+    void RenumberConfirmed();
+    // abandon the outstanding frames and the remaining segments, the remote's link must be reset again
+    void FailConfirmed();
+    // complete the send operation if every frame has been acknowledged and written
+    bool TryCompleteConfirmed();
+
+    // process CONFIRMED_USER_DATA ordered by transport sequence number, true if the frame must be acknowledged
+    bool OnWindowedUserData(const Message& message);
+
+    bool IsWindowed() const
+    {
+        return confirmWindow > 1;
+    }
+    ConfirmedSegment& GetConfirmed(uint8_t offset)
+    {
+        return confirmed[(confirmedStart + offset) % confirmWindow];
+    }
 
     // --- helpers for dealing with layer state transitations ---
     bool OnLowerLayerUp();
@@ -86,6 +132,7 @@ public:
     void QueueAck(uint16_t destination);
     void QueueLinkStatus(uint16_t destination);
     void QueueRequestLinkStatus(uint16_t destination);
+    void QueueResetLinks(uint16_t destination);
 
     void QueueTransmit(const ser4cpp::rseq_t& buffer, bool primary);
 
@@ -121,6 +168,12 @@ public:
     exe4cpp::Timer rspTimeoutTimer;
     exe4cpp::Timer keepAliveTimer;
     bool nextReadFCB;
+    bool isReadSeqValid;
+    uint8_t nextReadSeq;
+    uint32_t numPendingAck;
+    uint16_t pendingAckDestination;
+    bool isRemoteReset;
+    uint32_t numRetry;
     bool isOnline;
     bool keepAliveTimeout;
     Timestamp lastMessageTimestamp;
@@ -133,8 +186,22 @@ public:
 
     const std::shared_ptr<ILinkListener> listener;
     const std::shared_ptr<IUpperLayer> upper;
+    PostedAction<IUpperLayer> txReadyAction;
 
     ILinkSession* pSession;
+
+    const uint8_t confirmWindow;
+
+    // ring of frames awaiting an ACK, the oldest at confirmedStart
+    std::vector<ConfirmedSegment> confirmed;
+    uint8_t confirmedStart = 0;
+    uint8_t numConfirmed = 0;
+    // how many of the outstanding frames have been queued since the last (re)transmission began
+    uint8_t numConfirmedSent = 0;
+    bool isConfirmedTxActive = false;
+    // true while the current send operation still has segments that aren't in the window
+    bool hasMoreSegments = false;
+    bool nextWriteFCB = true;
 };
 
 } // namespace opendnp3
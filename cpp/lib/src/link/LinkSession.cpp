@@ -20,6 +20,7 @@
 
 #include "link/LinkSession.h"
 
+#include "MemoryAccount.h"
 #include "logging/LogMacros.h"
 #include "master/MasterSchedulerBackend.h"
 
@@ -34,12 +35,14 @@ LinkSession::LinkSession(const Logger& logger,
                          uint64_t sessionid,
                          std::shared_ptr<IResourceManager> manager,
                          std::shared_ptr<IListenCallbacks> callbacks,
-                         const std::shared_ptr<IAsyncChannel>& channel)
+                         const std::shared_ptr<IAsyncChannel>& channel,
+                         std::shared_ptr<MasterSessionStackPool> pool)
     : logger(logger),
       session_id(sessionid),
       manager(std::move(manager)),
       callbacks(std::move(callbacks)),
       channel(channel),
+      pool(std::move(pool)),
       parser(logger)
 {
 }
@@ -155,9 +158,16 @@ std::shared_ptr<IMasterSession> LinkSession::AcceptSession(const std::string& lo
     // rename the logger id to something meaningful
     this->logger.rename(loggerid);
 
+    const auto bufferPool = config.master.poolFragmentBuffers ? this->manager->GetBufferPool() : nullptr;
+
+    // with a pool, the stack and everything it allocates up front reuse the memory of closed sessions
+    MemoryScope scope(MemoryAccount::Create(this->pool));
+
+    auto scheduler = std::allocate_shared<MasterSchedulerBackend>(ResourceAllocator<MasterSchedulerBackend>(),
+                                                                  this->channel->executor);
+
     this->stack = MasterSessionStack::Create(this->logger, this->channel->executor, SOEHandler, application,
-                                             std::make_shared<MasterSchedulerBackend>(this->channel->executor),
-                                             shared_from_this(), *this, config);
+                                             scheduler, shared_from_this(), *this, config, bufferPool);
 
     return stack;
 }
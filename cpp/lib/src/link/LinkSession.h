@@ -26,6 +26,7 @@
 #include "link/ILinkTx.h"
 #include "link/LinkLayerParser.h"
 #include "master/MasterSessionStack.h"
+#include "master/MasterSessionStackPool.h"
 
 #include "opendnp3/link/LinkStatistics.h"
 #include "opendnp3/logging/Logger.h"
@@ -49,9 +50,10 @@ public:
                                                uint64_t sessionid,
                                                const std::shared_ptr<IResourceManager>& manager,
                                                const std::shared_ptr<IListenCallbacks>& callbacks,
-                                               const std::shared_ptr<IAsyncChannel>& channel)
+                                               const std::shared_ptr<IAsyncChannel>& channel,
+                                               const std::shared_ptr<MasterSessionStackPool>& pool = nullptr)
     {
-        auto session = std::make_shared<LinkSession>(logger, sessionid, manager, callbacks, channel);
+        auto session = std::make_shared<LinkSession>(logger, sessionid, manager, callbacks, channel, pool);
 
         session->Start();
 
@@ -62,7 +64,8 @@ public:
                 uint64_t sessionid,
                 std::shared_ptr<IResourceManager> manager,
                 std::shared_ptr<IListenCallbacks> callbacks,
-                const std::shared_ptr<IAsyncChannel>& channel);
+                const std::shared_ptr<IAsyncChannel>& channel,
+                std::shared_ptr<MasterSessionStackPool> pool);
 
     // override IResource
     void Shutdown() final;
@@ -100,6 +103,7 @@ private:
     const std::shared_ptr<IResourceManager> manager;
     const std::shared_ptr<IListenCallbacks> callbacks;
     const std::shared_ptr<IAsyncChannel> channel;
+    const std::shared_ptr<MasterSessionStackPool> pool;
 
     LinkLayerParser parser;
     exe4cpp::Timer first_frame_timer;
@@ -76,6 +76,11 @@ PriStateBase& PriStateBase::TrySendUnconfirmed(LinkContext& /*ctx*/, ITransportS
     return *this;
 }
 
+PriStateBase& PriStateBase::TrySendConfirmed(LinkContext& /*ctx*/, ITransportSegment& /*unused*/)
+{
+    return *this;
+}
+
 PriStateBase& PriStateBase::TrySendRequestLinkStatus(LinkContext& /*unused*/)
 {
     return *this;
@@ -95,6 +100,20 @@ PriStateBase& PLLS_Idle::TrySendUnconfirmed(LinkContext& ctx, ITransportSegment&
     return PLLS_SendUnconfirmedTransmitWait::Instance();
 }
 
+PriStateBase& PLLS_Idle::TrySendConfirmed(LinkContext& ctx, ITransportSegment& segments)
+{
+    if (ctx.isRemoteReset)
+    {
+        ctx.FillConfirmedWindow();
+        ctx.TransmitNextConfirmed();
+        return PLLS_ConfirmedDataWait::Instance();
+    }
+
+    // the remote's link must be reset before the first confirmed frame and after any failure
+    ctx.QueueResetLinks(segments.GetAddresses().destination);
+    return PLLS_ResetLinkWait::Instance();
+}
+
 PriStateBase& PLLS_Idle::TrySendRequestLinkStatus(LinkContext& ctx)
 {
     ctx.keepAliveTimeout = false;
@@ -172,4 +191,156 @@ PriStateBase& PLLS_RequestLinkStatusWait::OnTimeout(LinkContext& ctx)
     return PLLS_Idle::Instance();
 }
 
+////////////////////////////////////////////////////////
+// Class PLLS_ResetLinkWait
+////////////////////////////////////////////////////////
+
+PLLS_ResetLinkWait PLLS_ResetLinkWait::instance;
+
+PriStateBase& PLLS_ResetLinkWait::OnAck(LinkContext& ctx, bool /*receiveBuffFull*/)
+{
+    ctx.CancelTimer();
+    ctx.isRemoteReset = true;
+    ctx.numRetry = 0;
+    ctx.RenumberConfirmed();
+    ctx.FillConfirmedWindow();
+    ctx.TransmitNextConfirmed();
+    return PLLS_ConfirmedDataWait::Instance();
+}
+
+PriStateBase& PLLS_ResetLinkWait::OnNotSupported(LinkContext& ctx, bool /*receiveBuffFull*/)
+{
+    ctx.CancelTimer();
+    SIMPLE_LOG_BLOCK(ctx.logger, flags::WARN, "Reset link states not supported by remote");
+    ctx.FailConfirmed();
+    return ctx.TryCompleteConfirmed() ? static_cast<PriStateBase&>(PLLS_Idle::Instance())
+                                      : PLLS_ConfirmedDataWait::Instance();
+}
+
+PriStateBase& PLLS_ResetLinkWait::OnTxReady(LinkContext& ctx)
+{
+    if (ctx.isConfirmedTxActive)
+    {
+        // a confirmed frame was still being written when the reset was required, send it now
+        ctx.isConfirmedTxActive = false;
+        ctx.QueueResetLinks(ctx.pSegments->GetAddresses().destination);
+    }
+    else
+    {
+        ctx.StartResponseTimer();
+    }
+
+    return *this;
+}
+
+PriStateBase& PLLS_ResetLinkWait::OnTimeout(LinkContext& ctx)
+{
+    if (ctx.numRetry < ctx.config.NumRetry)
+    {
+        ++ctx.numRetry;
+        SIMPLE_LOG_BLOCK(ctx.logger, flags::WARN, "Reset link states - response timeout, retrying");
+        ctx.QueueResetLinks(ctx.pSegments->GetAddresses().destination);
+        return *this;
+    }
+
+    SIMPLE_LOG_BLOCK(ctx.logger, flags::WARN, "Reset link states - response timeout");
+    ctx.FailConfirmed();
+    ctx.TryCompleteConfirmed();
+    return PLLS_Idle::Instance();
+}
+
+////////////////////////////////////////////////////////
+// Class PLLS_ConfirmedDataWait
+////////////////////////////////////////////////////////
+
+PLLS_ConfirmedDataWait PLLS_ConfirmedDataWait::instance;
+
+PriStateBase& PLLS_ConfirmedDataWait::OnAck(LinkContext& ctx, bool receiveBuffFull)
+{
+    if (ctx.numConfirmed == 0)
+    {
+        return PriStateBase::OnAck(ctx, receiveBuffFull);
+    }
+
+    // the secondary accepts frames in order, so every ACK is for the oldest outstanding frame
+    ctx.numRetry = 0;
+    ctx.PopConfirmed();
+
+    if (ctx.TryCompleteConfirmed())
+    {
+        return PLLS_Idle::Instance();
+    }
+
+    ctx.StartResponseTimer();
+    ctx.FillConfirmedWindow();
+    ctx.TransmitNextConfirmed();
+    return *this;
+}
+
+PriStateBase& PLLS_ConfirmedDataWait::OnNack(LinkContext& ctx, bool /*receiveBuffFull*/)
+{
+    ctx.CancelTimer();
+    ctx.isRemoteReset = false;
+
+    if (ctx.numRetry < ctx.config.NumRetry)
+    {
+        ++ctx.numRetry;
+        SIMPLE_LOG_BLOCK(ctx.logger, flags::WARN, "Confirmed user data - NACK received, resetting link");
+
+        if (!ctx.isConfirmedTxActive)
+        {
+            ctx.QueueResetLinks(ctx.pSegments->GetAddresses().destination);
+        }
+
+        return PLLS_ResetLinkWait::Instance();
+    }
+
+    SIMPLE_LOG_BLOCK(ctx.logger, flags::WARN, "Confirmed user data - NACK received");
+    ctx.FailConfirmed();
+    return ctx.TryCompleteConfirmed() ? static_cast<PriStateBase&>(PLLS_Idle::Instance()) : *this;
+}
+
+PriStateBase& PLLS_ConfirmedDataWait::OnNotSupported(LinkContext& ctx, bool /*receiveBuffFull*/)
+{
+    ctx.CancelTimer();
+    SIMPLE_LOG_BLOCK(ctx.logger, flags::WARN, "Confirmed user data not supported by remote");
+    ctx.FailConfirmed();
+    return ctx.TryCompleteConfirmed() ? static_cast<PriStateBase&>(PLLS_Idle::Instance()) : *this;
+}
+
+PriStateBase& PLLS_ConfirmedDataWait::OnTxReady(LinkContext& ctx)
+{
+    ctx.isConfirmedTxActive = false;
+
+    if (ctx.TryCompleteConfirmed())
+    {
+        return PLLS_Idle::Instance();
+    }
+
+    // the remote can't respond before the frame is written, so the response timeout starts here
+    ctx.StartResponseTimer();
+    ctx.TransmitNextConfirmed();
+    return *this;
+}
+
+PriStateBase& PLLS_ConfirmedDataWait::OnTimeout(LinkContext& ctx)
+{
+    if (ctx.isConfirmedTxActive)
+    {
+        ctx.StartResponseTimer();
+        return *this;
+    }
+
+    if (ctx.RetransmitConfirmed())
+    {
+        SIMPLE_LOG_BLOCK(ctx.logger, flags::WARN, "Confirmed user data - response timeout, retransmitting");
+        return *this;
+    }
+
+    SIMPLE_LOG_BLOCK(ctx.logger, flags::WARN, "Confirmed user data - response timeout");
+    ctx.FailConfirmed();
+    ctx.TryCompleteConfirmed();
+    return PLLS_Idle::Instance();
+}
+
 } // namespace opendnp3
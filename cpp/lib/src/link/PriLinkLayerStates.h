@@ -43,6 +43,7 @@ public:
 
     // transmission events to handle
     virtual PriStateBase& TrySendUnconfirmed(LinkContext&, ITransportSegment& segments);
+    virtual PriStateBase& TrySendConfirmed(LinkContext&, ITransportSegment& segments);
     virtual PriStateBase& TrySendRequestLinkStatus(LinkContext&);
 
     // every concrete state implements this for logging purposes
@@ -55,6 +56,7 @@ class PLLS_Idle final : public PriStateBase
     MACRO_STATE_SINGLETON_INSTANCE(PLLS_Idle);
 
     PriStateBase& TrySendUnconfirmed(LinkContext&, ITransportSegment& segments) override;
+    PriStateBase& TrySendConfirmed(LinkContext&, ITransportSegment& segments) override;
     PriStateBase& TrySendRequestLinkStatus(LinkContext&) override;
 };
 
@@ -86,6 +88,33 @@ class PLLS_RequestLinkStatusWait final : public PriStateBase
     PriStateBase& OnTimeout(LinkContext&) override;
 };
 
+/////////////////////////////////////////////////////////////////////////////
+// Wait states for send confirmed data
+/////////////////////////////////////////////////////////////////////////////
+
+//	@section desc Waiting for the ACK of a RESET_LINK_STATES sent before the first confirmed frame
+class PLLS_ResetLinkWait final : public PriStateBase
+{
+    MACRO_STATE_SINGLETON_INSTANCE(PLLS_ResetLinkWait);
+
+    PriStateBase& OnAck(LinkContext& ctx, bool) override;
+    PriStateBase& OnNotSupported(LinkContext& ctx, bool) override;
+    PriStateBase& OnTxReady(LinkContext&) override;
+    PriStateBase& OnTimeout(LinkContext&) override;
+};
+
+//	@section desc Transmitting the window of confirmed frames and waiting for their ACKs
+class PLLS_ConfirmedDataWait final : public PriStateBase
+{
+    MACRO_STATE_SINGLETON_INSTANCE(PLLS_ConfirmedDataWait);
+
+    PriStateBase& OnAck(LinkContext& ctx, bool) override;
+    PriStateBase& OnNack(LinkContext& ctx, bool) override;
+    PriStateBase& OnNotSupported(LinkContext& ctx, bool) override;
+    PriStateBase& OnTxReady(LinkContext&) override;
+    PriStateBase& OnTimeout(LinkContext&) override;
+};
+
 } // namespace opendnp3
 
 #endif
@@ -61,6 +61,7 @@ SecStateBase& SLLS_NotReset::OnResetLinkStates(LinkContext& ctx, uint16_t source
 {
     ctx.QueueAck(source);
     ctx.ResetReadFCB();
+    ctx.ResetReadSequence();
     return SLLS_TransmitWaitReset::Instance();
 }
 
@@ -94,6 +95,17 @@ SecStateBase& SLLS_Reset::OnTestLinkStatus(LinkContext& ctx, uint16_t source, bo
 SecStateBase& SLLS_Reset::OnConfirmedUserData(
     LinkContext& ctx, uint16_t source, bool fcb, bool isBroadcast, const Message& message)
 {
+    if (ctx.IsWindowed() && !isBroadcast)
+    {
+        if (ctx.OnWindowedUserData(message))
+        {
+            ctx.QueueAck(source);
+            return SLLS_TransmitWaitReset::Instance();
+        }
+
+        return *this;
+    }
+
     if (!isBroadcast)
     {
         ctx.QueueAck(source);
@@ -116,6 +128,7 @@ SecStateBase& SLLS_Reset::OnResetLinkStates(LinkContext& ctx, uint16_t source)
 {
     ctx.QueueAck(source);
     ctx.ResetReadFCB();
+    ctx.ResetReadSequence();
     return SLLS_TransmitWaitReset::Instance();
 }
 
@@ -130,6 +143,49 @@ SecStateBase& SLLS_Reset::OnRequestLinkStatus(LinkContext& ctx, uint16_t source)
 ////////////////////////////////////////////////////////
 SLLS_TransmitWaitReset SLLS_TransmitWaitReset::instance;
 
+SecStateBase& SLLS_TransmitWaitReset::OnTxReady(LinkContext& ctx)
+{
+    if (ctx.numPendingAck > 0)
+    {
+        --ctx.numPendingAck;
+        ctx.QueueAck(ctx.pendingAckDestination);
+        return *this;
+    }
+
+    return SLLS_Reset::Instance();
+}
+
+SecStateBase& SLLS_TransmitWaitReset::OnResetLinkStates(LinkContext& ctx, uint16_t source)
+{
+    if (!ctx.IsWindowed())
+    {
+        return SLLS_TransmitWaitBase::OnResetLinkStates(ctx, source);
+    }
+
+    ctx.ResetReadFCB();
+    ctx.ResetReadSequence();
+    ++ctx.numPendingAck;
+    ctx.pendingAckDestination = source;
+    return *this;
+}
+
+SecStateBase& SLLS_TransmitWaitReset::OnConfirmedUserData(
+    LinkContext& ctx, uint16_t source, bool fcb, bool isBroadcast, const Message& message)
+{
+    if (!ctx.IsWindowed() || isBroadcast)
+    {
+        return SLLS_TransmitWaitBase::OnConfirmedUserData(ctx, source, fcb, isBroadcast, message);
+    }
+
+    if (ctx.OnWindowedUserData(message))
+    {
+        ++ctx.numPendingAck;
+        ctx.pendingAckDestination = source;
+    }
+
+    return *this;
+}
+
 ////////////////////////////////////////////////////////
 //	Class SLLS_TransmitWaitNotReset
 ////////////////////////////////////////////////////////
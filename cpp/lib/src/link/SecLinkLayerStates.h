@@ -59,12 +59,12 @@ protected:
     SLLS_TransmitWaitBase() {}
 
 public:
-    virtual SecStateBase& OnTxReady(LinkContext& ctx) override final;
-    virtual SecStateBase& OnResetLinkStates(LinkContext&, uint16_t source) override final;
+    virtual SecStateBase& OnTxReady(LinkContext& ctx) override;
+    virtual SecStateBase& OnResetLinkStates(LinkContext&, uint16_t source) override;
     virtual SecStateBase& OnRequestLinkStatus(LinkContext&, uint16_t source) override final;
     virtual SecStateBase& OnTestLinkStatus(LinkContext&, uint16_t source, bool fcb) override final;
     virtual SecStateBase& OnConfirmedUserData(
-        LinkContext&, uint16_t source, bool fcb, bool isBroadcast, const Message& message) override final;
+        LinkContext&, uint16_t source, bool fcb, bool isBroadcast, const Message& message) override;
 };
 
 template<class NextState> SecStateBase& SLLS_TransmitWaitBase<NextState>::OnTxReady(LinkContext& ctx)
@@ -130,9 +130,16 @@ class SLLS_Reset final : public SecStateBase
     virtual SecStateBase& OnTestLinkStatus(LinkContext&, uint16_t source, bool fcb) override;
 };
 
+//	@section desc When pipelining confirmed frames, the frames that arrive while an ACK is written are
+//	processed immediately and their ACKs are sent once the current one has been written
 class SLLS_TransmitWaitReset : public SLLS_TransmitWaitBase<SLLS_Reset>
 {
     MACRO_STATE_SINGLETON_INSTANCE(SLLS_TransmitWaitReset);
+
+    SecStateBase& OnTxReady(LinkContext& ctx) final;
+    SecStateBase& OnResetLinkStates(LinkContext&, uint16_t source) final;
+    SecStateBase& OnConfirmedUserData(
+        LinkContext&, uint16_t source, bool fcb, bool isBroadcast, const Message& message) final;
 };
 
 class SLLS_TransmitWaitNotReset : public SLLS_TransmitWaitBase<SLLS_NotReset>
@@ -0,0 +1,120 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "AdaptiveScanTask.h"
+
+#include "app/APDUBuilders.h"
+#include "logging/LogMacros.h"
+#include "master/IMasterScheduler.h"
+
+#include "opendnp3/logging/LogLevels.h"
+
+#include <utility>
+
+namespace opendnp3
+{
+
+AdaptiveScanTask::AdaptiveScanTask(const std::shared_ptr<TaskContext>& context,
+                                   ClassField classes,
+                                   const AdaptiveScanConfig& config,
+                                   const std::shared_ptr<IMasterScheduler>& scheduler,
+                                   const TimeDuration& minRetryDelay,
+                                   const TimeDuration& maxRetryDelay,
+                                   IMasterApplication& app,
+                                   std::shared_ptr<ISOEHandler> soeHandler,
+                                   const Logger& logger,
+                                   TaskConfig taskConfig)
+    : PollTaskBase(context,
+                   app,
+                   std::move(soeHandler),
+                   TaskBehavior::ImmediatePeriodic(config.minPeriod, minRetryDelay, maxRetryDelay),
+                   logger,
+                   taskConfig),
+      classes(classes),
+      config(config),
+      scheduler(scheduler),
+      period(config.minPeriod)
+{
+}
+
+bool AdaptiveScanTask::BuildRequest(APDURequest& request, uint8_t seq)
+{
+    this->rxCount = 0;
+    build::ClassRequest(request, FunctionCode::READ, this->classes, seq);
+
+    this->pollBytes = request.Size();
+    this->pollEvents = 0;
+    this->pendingEvents = false;
+
+    return true;
+}
+
+void AdaptiveScanTask::OnMeasurements(const APDUResponseHeader& header,
+                                      const ser4cpp::rseq_t& objects,
+                                      uint32_t numEvents)
+{
+    this->pollBytes += APDUHeader::RESPONSE_SIZE + objects.length();
+    this->pollEvents += numEvents;
+    this->pendingEvents |= this->HasPendingEvents(header.IIN);
+
+    if (header.control.FIN)
+    {
+        this->UpdatePeriod();
+    }
+}
+
+bool AdaptiveScanTask::HasPendingEvents(const IINField& iin) const
+{
+    return (iin.IsSet(IINBit::CLASS1_EVENTS) && this->classes.HasClass1())
+        || (iin.IsSet(IINBit::CLASS2_EVENTS) && this->classes.HasClass2())
+        || (iin.IsSet(IINBit::CLASS3_EVENTS) && this->classes.HasClass3());
+}
+
+void AdaptiveScanTask::UpdatePeriod()
+{
+    if (this->pendingEvents || this->pollEvents >= this->config.backlogEventCount)
+    {
+        // the outstation has a backlog, drain it as fast as allowed
+        this->period = this->config.minPeriod;
+    }
+    else if (this->pollEvents == 0)
+    {
+        // nothing happening, back off exponentially
+        const auto doubled = this->period.Double();
+        this->period = (doubled > this->config.maxPeriod) ? this->config.maxPeriod : doubled;
+    }
+
+    auto effective = this->period;
+
+    const auto shared = this->scheduler.lock();
+    if (shared)
+    {
+        const auto wait = shared->ChargeBandwidth(this->pollBytes);
+        if (wait > effective)
+        {
+            FORMAT_LOG_BLOCK(this->logger, flags::DBG, "Adaptive poll delayed by channel budget: %s",
+                             wait.ToString().c_str());
+            effective = wait;
+        }
+    }
+
+    this->SetPeriod(effective);
+}
+
+} // namespace opendnp3
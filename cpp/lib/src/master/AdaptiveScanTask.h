@@ -0,0 +1,107 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_ADAPTIVESCANTASK_H
+#define OPENDNP3_ADAPTIVESCANTASK_H
+
+#include "master/PollTaskBase.h"
+#include "master/TaskPriority.h"
+
+#include "opendnp3/app/ClassField.h"
+#include "opendnp3/master/AdaptiveScanConfig.h"
+
+#include <memory>
+
+namespace opendnp3
+{
+
+class IMasterScheduler;
+
+/**
+ * A recurring class scan whose period follows the event activity reported by the outstation
+ */
+class AdaptiveScanTask final : public PollTaskBase
+{
+
+public:
+    AdaptiveScanTask(const std::shared_ptr<TaskContext>& context,
+                     ClassField classes,
+                     const AdaptiveScanConfig& config,
+                     const std::shared_ptr<IMasterScheduler>& scheduler,
+                     const TimeDuration& minRetryDelay,
+                     const TimeDuration& maxRetryDelay,
+                     IMasterApplication& app,
+                     std::shared_ptr<ISOEHandler> soeHandler,
+                     const Logger& logger,
+                     TaskConfig taskConfig);
+
+    virtual const char* Name() const override
+    {
+        return "Adaptive Poll";
+    }
+
+    virtual int Priority() const override
+    {
+        return priority::USER_POLL;
+    }
+
+    virtual bool BuildRequest(APDURequest& request, uint8_t seq) override;
+
+    virtual bool BlocksLowerPriority() const override
+    {
+        return false;
+    }
+
+    virtual bool IsRecurring() const override
+    {
+        return true;
+    }
+
+private:
+    virtual MasterTaskType GetTaskType() const override
+    {
+        return MasterTaskType::USER_TASK;
+    }
+
+    virtual void OnMeasurements(const APDUResponseHeader& header,
+                                const ser4cpp::rseq_t& objects,
+                                uint32_t numEvents) override;
+
+    bool HasPendingEvents(const IINField& iin) const;
+
+    void UpdatePeriod();
+
+    const ClassField classes;
+    const AdaptiveScanConfig config;
+
+    // the scheduler owns the task, so only hold a weak reference back to it
+    const std::weak_ptr<IMasterScheduler> scheduler;
+
+    // period chosen from the activity of the outstation, before any bandwidth limiting
+    TimeDuration period;
+
+    // accumulated over the fragments of the current poll
+    size_t pollBytes = 0;
+    uint32_t pollEvents = 0;
+    bool pendingEvents = false;
+};
+
+} // namespace opendnp3
+
+#endif
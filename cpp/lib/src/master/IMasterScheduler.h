@@ -23,6 +23,9 @@
 #include "master/IMasterTask.h"
 #include "master/IMasterTaskRunner.h"
 
+#include "opendnp3/link/LinkStatistics.h"
+#include "opendnp3/master/PollPlannerConfig.h"
+
 namespace opendnp3
 {
 
@@ -63,6 +66,23 @@ public:
      */
     virtual void Demand(const std::shared_ptr<IMasterTask>& task) = 0;
 
+    /**
+     * Change how tasks are ordered across the runners that share the scheduler
+     */
+    virtual void SetPollPlanner(const PollPlannerConfig& config) = 0;
+
+    /**
+     * Charge the bytes exchanged by an adaptive scan against the channel's adaptive scan budget
+     *
+     * @return how long adaptive scans should wait for the budget to recover
+     */
+    virtual TimeDuration ChargeBandwidth(size_t numBytes) = 0;
+
+    /**
+     * Line utilization of the tasks run so far
+     */
+    virtual LinkStatistics::Polling GetStatistics() = 0;
+
     /**
      * Add multiple tasks in one call
      */
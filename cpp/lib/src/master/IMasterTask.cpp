@@ -43,7 +43,8 @@ IMasterTask::~IMasterTask()
 
     if (config.pCallback)
     {
-        config.pCallback->OnDestroyed();
+        // must not overtake a completion that is still waiting for the task's measurements to be delivered
+        context->AfterMeasurementsDelivered([callback = config.pCallback]() { callback->OnDestroyed(); });
     }
 }
 
@@ -115,13 +116,16 @@ void IMasterTask::CompleteTask(TaskCompletion result, Timestamp now)
     }
     }
 
-    if (config.pCallback)
-    {
-        config.pCallback->OnComplete(result);
-    }
+    // notify the callback and the application, after the task's measurements if they're decoded on the thread pool
+    const TaskInfo info(this->GetTaskType(), result, config.taskId, this->behavior.GetPeriod());
+    this->context->AfterMeasurementsDelivered([callback = config.pCallback, application = this->application, info]() {
+        if (callback)
+        {
+            callback->OnComplete(info.result);
+        }
 
-    // notify the application
-    this->application->OnTaskComplete(TaskInfo(this->GetTaskType(), result, config.taskId));
+        application->OnTaskComplete(info);
+    });
 
     // notify any super class implementations
     this->OnTaskComplete(result, now);
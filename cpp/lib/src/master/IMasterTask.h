@@ -159,6 +159,12 @@ protected:
 
     void CompleteTask(TaskCompletion result, Timestamp now);
 
+    // change the period of a recurring task before it completes
+    void SetPeriod(const TimeDuration& period)
+    {
+        this->behavior.SetPeriod(period);
+    }
+
     virtual void OnTaskComplete(TaskCompletion result, Timestamp now) {}
 
     virtual bool IsEnabled() const
@@ -25,10 +25,12 @@
 #include "gen/objects/Group12.h"
 #include "gen/objects/Group41.h"
 #include "logging/LogMacros.h"
+#include "master/AdaptiveScanTask.h"
 #include "master/CommandTask.h"
 #include "master/EmptyResponseTask.h"
 #include "master/MeasurementHandler.h"
 #include "master/RestartOperationTask.h"
+#include "master/ShadowSOEHandler.h"
 #include "master/UserPollTask.h"
 
 #include "opendnp3/logging/LogLevels.h"
@@ -44,19 +46,44 @@ MContext::MContext(const Addresses& addresses,
                    const std::shared_ptr<ISOEHandler>& SOEHandler,
                    const std::shared_ptr<IMasterApplication>& application,
                    std::shared_ptr<IMasterScheduler> scheduler,
-                   const MasterParams& params)
+                   const MasterParams& params,
+                   const std::shared_ptr<FragmentBufferPool>& pool,
+                   const std::shared_ptr<exe4cpp::IExecutor>& decodeExecutor)
     : logger(logger),
       executor(executor),
       lower(std::move(lower)),
       addresses(addresses),
       params(params),
-      SOEHandler(SOEHandler),
+      shadow(params.suppressUnchangedStaticValues ? std::make_shared<StaticShadowTable>() : nullptr),
+      decoder((params.decodeOnThreadPool && decodeExecutor)
+                  ? std::make_shared<MeasurementDecoder>(logger, executor, decodeExecutor,
+                                                         params.maxQueuedDecodeFragments)
+                  : nullptr),
+      SOEHandler(Shadow(SOEHandler)),
       application(application),
       scheduler(std::move(scheduler)),
-      tasks(params, logger, *application, SOEHandler),
-      txBuffer(params.maxTxFragSize),
+      tasks(params, logger, *application, this->SOEHandler),
+      txBuffer(params.maxTxFragSize, pool),
       tstate(TaskState::IDLE)
 {
+    if (this->decoder)
+    {
+        this->tasks.context->SetDecoder(this->decoder);
+        this->decoder->SetOnDelivered([this]() { this->OnMeasurementsDelivered(); });
+    }
+}
+
+MContext::~MContext()
+{
+    if (this->decoder)
+    {
+        this->decoder->Detach();
+    }
+}
+
+void MContext::RecordMemory(StackStatistics::Memory& memory) const
+{
+    memory.Add(this->txBuffer.NumHeldBytes(), this->txBuffer.IsPooled());
 }
 
 bool MContext::OnLowerLayerUp()
@@ -87,6 +114,22 @@ bool MContext::OnLowerLayerDown()
     solSeq = unsolSeq = 0;
     isOnline = isSending = false;
     activeTask.reset();
+    txBuffer.Release();
+    deferredConfirms.clear();
+
+    // values may change unseen while offline, so report everything again after reconnecting
+    if (this->shadow)
+    {
+        if (this->decoder)
+        {
+            // the shadow is in use on the decode executor
+            this->decoder->Post([shadow = this->shadow]() { shadow->Clear(); });
+        }
+        else
+        {
+            this->shadow->Clear();
+        }
+    }
 
     this->scheduler->SetRunnerOffline(*this);
     this->application->OnClose();
@@ -136,6 +179,9 @@ bool MContext::OnTxReady()
 
     this->isSending = false;
 
+    // the request has been fully handed to the lower layer
+    this->txBuffer.Release();
+
     this->tstate = this->OnTransmitComplete();
     this->CheckConfirmTransmit();
 
@@ -241,11 +287,14 @@ void MContext::ProcessUnsolicitedResponse(const APDUResponseHeader& header, cons
         return;
     }
 
-    auto result = MeasurementHandler::ProcessMeasurements(header.as_response_info(), objects, logger, SOEHandler.get());
+    const auto result
+        = this->decoder
+              ? this->decoder->Decode(header.as_response_info(), objects, SOEHandler)
+              : MeasurementHandler::ProcessMeasurements(header.as_response_info(), objects, logger, SOEHandler.get());
 
     if ((result == ParseResult::OK) && header.control.CON)
     {
-        this->QueueConfirm(APDUHeader::UnsolicitedConfirm(header.control.SEQ));
+        this->QueueMeasurementConfirm(APDUHeader::UnsolicitedConfirm(header.control.SEQ));
     }
 
     this->ProcessIIN(header.IIN);
@@ -263,6 +312,32 @@ void MContext::QueueConfirm(const APDUHeader& header)
     this->CheckConfirmTransmit();
 }
 
+void MContext::QueueMeasurementConfirm(const APDUHeader& header)
+{
+    // holding back the confirm stops the outstation from sending more fragments until the decoder catches up
+    if (this->decoder && !this->decoder->HasCapacity())
+    {
+        this->deferredConfirms.push_back(header);
+        return;
+    }
+
+    this->QueueConfirm(header);
+}
+
+void MContext::OnMeasurementsDelivered()
+{
+    if (!this->decoder->HasCapacity())
+    {
+        return;
+    }
+
+    while (!this->deferredConfirms.empty())
+    {
+        this->QueueConfirm(this->deferredConfirms.front());
+        this->deferredConfirms.pop_front();
+    }
+}
+
 bool MContext::CheckConfirmTransmit()
 {
     if (this->isSending || this->confirmQueue.empty())
@@ -301,7 +376,7 @@ std::shared_ptr<IMasterTask> MContext::AddScan(TimeDuration period,
     auto task = std::make_shared<UserPollTask>(
         this->tasks.context, builder,
         TaskBehavior::ImmediatePeriodic(period, params.taskRetryPeriod, params.maxTaskRetryPeriod), true, *application,
-        soe_handler, logger, config);
+        this->Shadow(soe_handler), logger, config);
     this->ScheduleRecurringPollTask(task);
     return task;
 }
@@ -337,13 +412,25 @@ std::shared_ptr<IMasterTask> MContext::AddRangeScan(GroupVariationID gvId,
     return this->AddScan(period, build, soe_handler, config);
 }
 
+std::shared_ptr<IMasterTask> MContext::AddAdaptiveClassScan(const ClassField& field,
+                                                            const AdaptiveScanConfig& scanConfig,
+                                                            std::shared_ptr<ISOEHandler> soe_handler,
+                                                            TaskConfig config)
+{
+    auto task = std::make_shared<AdaptiveScanTask>(this->tasks.context, field, scanConfig, this->scheduler,
+                                                   params.taskRetryPeriod, params.maxTaskRetryPeriod, *application,
+                                                   this->Shadow(soe_handler), logger, config);
+    this->ScheduleRecurringPollTask(task);
+    return task;
+}
+
 void MContext::Scan(const HeaderBuilderT& builder, std::shared_ptr<ISOEHandler> soe_handler, TaskConfig config)
 {
     const auto timeout = Timestamp(this->executor->get_time()) + params.taskStartTimeout;
 
     auto task
         = std::make_shared<UserPollTask>(this->tasks.context, builder, TaskBehavior::SingleExecutionNoRetry(timeout),
-                                         false, *application, soe_handler, logger, config);
+                                         false, *application, this->Shadow(soe_handler), logger, config);
 
     this->ScheduleAdhocTask(task);
 }
@@ -422,6 +509,16 @@ bool MContext::Run(const std::shared_ptr<IMasterTask>& task)
 
 /// ------ private helpers ----------
 
+std::shared_ptr<ISOEHandler> MContext::Shadow(const std::shared_ptr<ISOEHandler>& handler) const
+{
+    if (!this->shadow || !handler)
+    {
+        return handler;
+    }
+
+    return std::make_shared<ShadowSOEHandler>(this->shadow, handler);
+}
+
 void MContext::ScheduleRecurringPollTask(const std::shared_ptr<IMasterTask>& task)
 {
     this->tasks.BindTask(task);
@@ -533,7 +630,7 @@ MContext::TaskState MContext::OnResponse_WaitForResponse(const APDUResponseHeade
 
     if (header.control.CON)
     {
-        this->QueueConfirm(APDUHeader::SolicitedConfirm(header.control.SEQ));
+        this->QueueMeasurementConfirm(APDUHeader::SolicitedConfirm(header.control.SEQ));
     }
 
     switch (result)
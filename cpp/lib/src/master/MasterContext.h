@@ -20,22 +20,25 @@
 #ifndef OPENDNP3_MASTERCONTEXT_H
 #define OPENDNP3_MASTERCONTEXT_H
 
+#include "FragmentBufferPool.h"
 #include "LayerInterfaces.h"
 #include "app/AppSeqNum.h"
 #include "master/HeaderBuilder.h"
 #include "master/IMasterScheduler.h"
 #include "master/MasterTasks.h"
+#include "master/MeasurementDecoder.h"
+#include "master/StaticShadowTable.h"
 
+#include "opendnp3/StackStatistics.h"
 #include "opendnp3/app/MeasurementTypes.h"
 #include "opendnp3/gen/RestartType.h"
 #include "opendnp3/logging/Logger.h"
+#include "opendnp3/master/AdaptiveScanConfig.h"
 #include "opendnp3/master/CommandResultCallbackT.h"
 #include "opendnp3/master/CommandSet.h"
 #include "opendnp3/master/IMasterApplication.h"
 #include "opendnp3/master/RestartOperationResult.h"
 
-#include <ser4cpp/container/Buffer.h>
-
 #include <exe4cpp/Timer.h>
 #include <exe4cpp/asio/StrandExecutor.h>
 
@@ -64,7 +67,14 @@ public:
              const std::shared_ptr<ISOEHandler>& SOEHandler,
              const std::shared_ptr<IMasterApplication>& application,
              std::shared_ptr<IMasterScheduler> scheduler,
-             const MasterParams& params);
+             const MasterParams& params,
+             const std::shared_ptr<FragmentBufferPool>& pool = nullptr,
+             const std::shared_ptr<exe4cpp::IExecutor>& decodeExecutor = nullptr);
+
+    ~MContext();
+
+    /// bytes held by the application layer buffers
+    void RecordMemory(StackStatistics::Memory& memory) const;
 
     Logger logger;
     const std::shared_ptr<exe4cpp::IExecutor> executor;
@@ -73,6 +83,10 @@ public:
     // ------- configuration --------
     const Addresses addresses;
     const MasterParams params;
+    // last reported static values, only present if suppressUnchangedStaticValues is set
+    const std::shared_ptr<StaticShadowTable> shadow;
+    // delivers measurements on the decode executor, only present if decodeOnThreadPool is set
+    const std::shared_ptr<MeasurementDecoder> decoder;
     const std::shared_ptr<ISOEHandler> SOEHandler;
     const std::shared_ptr<IMasterApplication> application;
     const std::shared_ptr<IMasterScheduler> scheduler;
@@ -87,7 +101,9 @@ public:
 
     MasterTasks tasks;
     std::deque<APDUHeader> confirmQueue;
-    ser4cpp::Buffer txBuffer;
+    // confirms held back while the decoder is full
+    std::deque<APDUHeader> deferredConfirms;
+    FragmentBuffer txBuffer;
     TaskState tstate;
 
     // --- implement  IUpperLayer ------
@@ -138,6 +154,11 @@ public:
                                               std::shared_ptr<ISOEHandler> soe_handler,
                                               TaskConfig config = TaskConfig::Default());
 
+    std::shared_ptr<IMasterTask> AddAdaptiveClassScan(const ClassField& field,
+                                                      const AdaptiveScanConfig& scanConfig,
+                                                      std::shared_ptr<ISOEHandler> soe_handler,
+                                                      TaskConfig config = TaskConfig::Default());
+
     // ---- Single shot immediate scans ----
 
     void Scan(const HeaderBuilderT& builder,
@@ -177,6 +198,11 @@ public:
 
     void QueueConfirm(const APDUHeader& header);
 
+    // confirm a measurement response, unless the decoder is too far behind
+    void QueueMeasurementConfirm(const APDUHeader& header);
+
+    void OnMeasurementsDelivered();
+
     void StartResponseTimer();
 
     void ProcessAPDU(const APDUResponseHeader& header, const ser4cpp::rseq_t& objects);
@@ -196,6 +222,9 @@ private:
 
     void ScheduleRecurringPollTask(const std::shared_ptr<IMasterTask>& task);
 
+    // wrap a handler so that it only sees changed static values, if configured
+    std::shared_ptr<ISOEHandler> Shadow(const std::shared_ptr<ISOEHandler>& handler) const;
+
     void ProcessIIN(const IINField& iin);
 
     void OnResponseTimeout();
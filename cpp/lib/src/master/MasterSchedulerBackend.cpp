@@ -20,11 +20,13 @@
 #include "MasterSchedulerBackend.h"
 
 #include <algorithm>
+#include <chrono>
 
 namespace opendnp3
 {
 
-MasterSchedulerBackend::MasterSchedulerBackend(const std::shared_ptr<exe4cpp::IExecutor>& executor) : executor(executor)
+MasterSchedulerBackend::MasterSchedulerBackend(const std::shared_ptr<exe4cpp::IExecutor>& executor)
+    : executor(executor), checkAction([](MasterSchedulerBackend& backend) { backend.CheckForTaskRun(); })
 {
 }
 
@@ -69,7 +71,9 @@ void MasterSchedulerBackend::SetRunnerOffline(const IMasterTaskRunner& runner)
     };
 
     if (this->current && checkForOwnership(this->current))
-        this->current.Clear();
+        this->ClearCurrent();
+
+    this->lastServed.erase(&runner);
 
     // move erase idiom
     this->tasks.erase(std::remove_if(this->tasks.begin(), this->tasks.end(), checkForOwnership), this->tasks.end());
@@ -92,7 +96,7 @@ bool MasterSchedulerBackend::CompleteCurrentFor(const IMasterTaskRunner& runner)
         this->Add(this->current.task, *this->current.runner);
     }
 
-    this->current.Clear();
+    this->ClearCurrent();
 
     this->PostCheckForTaskRun();
 
@@ -114,13 +118,55 @@ void MasterSchedulerBackend::Evaluate()
     this->PostCheckForTaskRun();
 }
 
-void MasterSchedulerBackend::PostCheckForTaskRun()
+void MasterSchedulerBackend::SetPollPlanner(const PollPlannerConfig& config)
+{
+    this->planner = config;
+    this->PostCheckForTaskRun();
+}
+
+TimeDuration MasterSchedulerBackend::ChargeBandwidth(size_t numBytes)
 {
-    if (!this->taskCheckPending)
+    if (this->planner.adaptiveScanBytesPerSecond == 0)
     {
-        this->taskCheckPending = true;
-        this->executor->post([this, self = shared_from_this()]() { this->CheckForTaskRun(); });
+        return TimeDuration::Zero();
     }
+
+    const auto now = Timestamp(this->executor->get_time());
+
+    if (this->budgetRecovered < now)
+    {
+        this->budgetRecovered = now;
+    }
+
+    TimeDuration cost;
+    cost.value = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::microseconds((numBytes * 1000000) / this->planner.adaptiveScanBytesPerSecond));
+    this->budgetRecovered += cost;
+
+    return this->budgetRecovered - now;
+}
+
+LinkStatistics::Polling MasterSchedulerBackend::GetStatistics()
+{
+    auto ret = this->statistics;
+
+    if (!this->isShutdown && !this->firstStart.IsMin())
+    {
+        const auto now = Timestamp(this->executor->get_time());
+        ret.elapsedMicroseconds = ToMicroseconds(now - this->firstStart);
+        if (this->current)
+        {
+            ret.busyMicroseconds += ToMicroseconds(now - this->currentStart);
+        }
+    }
+
+    return ret;
+}
+
+void MasterSchedulerBackend::PostCheckForTaskRun()
+{
+    // a check that is already pending covers this request too
+    this->checkAction.Post(*this->executor, shared_from_this());
 }
 
 bool MasterSchedulerBackend::CheckForTaskRun()
@@ -128,8 +174,6 @@ bool MasterSchedulerBackend::CheckForTaskRun()
     if (this->isShutdown)
         return false;
 
-    this->taskCheckPending = false;
-
     this->RestartTimeoutTimer();
 
     if (this->current)
@@ -146,7 +190,13 @@ bool MasterSchedulerBackend::CheckForTaskRun()
 
     while (current != this->tasks.end())
     {
-        if (GetBestTaskToRun(now, *best_task, *current) == Comparison::RIGHT)
+        auto comparison = GetBestTaskToRun(now, *best_task, *current);
+        if (comparison == Comparison::SAME && this->planner.interleaveOutstations)
+        {
+            comparison = this->CompareLastServed(*best_task, *current);
+        }
+
+        if (comparison == Comparison::RIGHT)
         {
             best_task = current;
         }
@@ -156,23 +206,66 @@ bool MasterSchedulerBackend::CheckForTaskRun()
 
     // is the task runnable now?
     const auto is_expired = now >= best_task->task->ExpirationTime();
-    if (is_expired)
+    if (is_expired || this->CanStartEarly(now, *best_task))
     {
-        this->current = *best_task;
-        this->tasks.erase(best_task);
-        this->current.runner->Run(this->current.task);
+        if (!is_expired)
+        {
+            ++this->statistics.numTasksStartedEarly;
+        }
+
+        this->Start(best_task, now);
 
         return true;
     }
 
     auto callback = [this, self = shared_from_this()]() { this->CheckForTaskRun(); };
 
+    // with a lookahead, the channel is next checked when the task becomes eligible to start early
+    const auto start = this->CanStartEarly(best_task->task->ExpirationTime(), *best_task)
+        ? best_task->task->ExpirationTime() - this->planner.lookahead
+        : best_task->task->ExpirationTime();
+
     this->taskTimer.cancel();
-    this->taskTimer = this->executor->start(best_task->task->ExpirationTime().value, callback);
+    this->taskTimer = this->executor->start(start.value, callback);
 
     return false;
 }
 
+void MasterSchedulerBackend::Start(task_list_t::iterator record, const Timestamp& now)
+{
+    if (this->firstStart.IsMin())
+    {
+        this->firstStart = now;
+    }
+
+    ++this->statistics.numTasksStarted;
+    this->currentStart = now;
+    this->lastServed[record->runner] = ++this->numServed;
+
+    this->current = *record;
+    this->tasks.erase(record);
+    this->current.runner->Run(this->current.task);
+}
+
+void MasterSchedulerBackend::ClearCurrent()
+{
+    this->statistics.busyMicroseconds += ToMicroseconds(Timestamp(this->executor->get_time()) - this->currentStart);
+    this->current.Clear();
+}
+
+bool MasterSchedulerBackend::CanStartEarly(const Timestamp& now, const Record& record) const
+{
+    // only periodic tasks are pulled forward, one-off tasks and retries keep their schedule
+    if (this->planner.lookahead <= TimeDuration::Zero() || !record.task->IsRecurring() || record.task->IsBlocked())
+    {
+        return false;
+    }
+
+    const auto expiration = record.task->ExpirationTime();
+
+    return (expiration != Timestamp::Max()) && (now + this->planner.lookahead >= expiration);
+}
+
 void MasterSchedulerBackend::RestartTimeoutTimer()
 {
     if (this->isShutdown)
@@ -220,6 +313,36 @@ void MasterSchedulerBackend::TimeoutTasks()
     this->RestartTimeoutTimer();
 }
 
+uint64_t MasterSchedulerBackend::ToMicroseconds(const TimeDuration& duration)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration.value).count());
+}
+
+MasterSchedulerBackend::Comparison MasterSchedulerBackend::CompareLastServed(const Record& left,
+                                                                             const Record& right) const
+{
+    const auto find = [this](const Record& record) -> uint64_t {
+        const auto iter = this->lastServed.find(record.runner);
+        return (iter == this->lastServed.end()) ? 0 : iter->second;
+    };
+
+    const auto leftServed = find(left);
+    const auto rightServed = find(right);
+
+    if (leftServed < rightServed)
+    {
+        return Comparison::LEFT;
+    }
+    if (rightServed < leftServed)
+    {
+        return Comparison::RIGHT;
+    }
+    else
+    {
+        return Comparison::SAME;
+    }
+}
+
 MasterSchedulerBackend::Comparison MasterSchedulerBackend::GetBestTaskToRun(const Timestamp& now,
                                                                             const Record& left,
                                                                             const Record& right)
@@ -20,12 +20,14 @@
 #ifndef OPENDNP3_MASTERSCHEDULERBACKEND_H
 #define OPENDNP3_MASTERSCHEDULERBACKEND_H
 
+#include "PostedAction.h"
 #include "master/IMasterScheduler.h"
 #include "master/IMasterTaskRunner.h"
 
 #include <exe4cpp/Timer.h>
 
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace opendnp3
@@ -62,6 +64,9 @@ class MasterSchedulerBackend final : public IMasterScheduler,
         IMasterTaskRunner* runner = nullptr;
     };
 
+    // tasks are added on the strand, so the list stays on the global heap instead of a resource that can run out
+    using task_list_t = std::vector<Record>;
+
 public:
     explicit MasterSchedulerBackend(const std::shared_ptr<exe4cpp::IExecutor>& executor);
 
@@ -79,12 +84,39 @@ public:
 
     virtual void Evaluate() override;
 
+    virtual void SetPollPlanner(const PollPlannerConfig& config) override;
+
+    virtual TimeDuration ChargeBandwidth(size_t numBytes) override;
+
+    virtual LinkStatistics::Polling GetStatistics() override;
+
 private:
     bool isShutdown = false;
-    bool taskCheckPending = false;
 
     Record current;
-    std::vector<Record> tasks;
+    task_list_t tasks;
+
+    PollPlannerConfig planner;
+
+    // time at which the bytes charged to the adaptive scan budget will have been paid off
+    Timestamp budgetRecovered;
+
+    // line utilization bookkeeping
+    LinkStatistics::Polling statistics;
+    Timestamp firstStart;
+    Timestamp currentStart;
+
+    // sequence number of the last task started by each runner, used to interleave runners
+    uint64_t numServed = 0;
+    std::unordered_map<const IMasterTaskRunner*, uint64_t> lastServed;
+
+    void Start(task_list_t::iterator record, const Timestamp& now);
+
+    void ClearCurrent();
+
+    bool CanStartEarly(const Timestamp& now, const Record& record) const;
+
+    static uint64_t ToMicroseconds(const TimeDuration& duration);
 
     void PostCheckForTaskRun();
 
@@ -95,6 +127,7 @@ private:
     void TimeoutTasks();
 
     std::shared_ptr<exe4cpp::IExecutor> executor;
+    PostedAction<MasterSchedulerBackend> checkAction;
     exe4cpp::Timer taskTimer;
     exe4cpp::Timer taskStartTimeout;
 
@@ -105,6 +138,8 @@ private:
         SAME
     };
 
+    Comparison CompareLastServed(const Record& left, const Record& right) const;
+
     static Comparison GetBestTaskToRun(const Timestamp& now, const Record& left, const Record& right);
 
     static Comparison CompareEnabledStatus(const Record& left, const Record& right);
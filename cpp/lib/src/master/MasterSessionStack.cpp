@@ -20,6 +20,7 @@
 
 #include "master/MasterSessionStack.h"
 
+#include "MemoryAccount.h"
 #include "link/LinkSession.h"
 #include "master/HeaderConversions.h"
 
@@ -34,10 +35,12 @@ std::shared_ptr<MasterSessionStack> MasterSessionStack::Create(const Logger& log
                                                                const std::shared_ptr<IMasterScheduler>& scheduler,
                                                                const std::shared_ptr<LinkSession>& session,
                                                                ILinkTx& linktx,
-                                                               const MasterStackConfig& config)
+                                                               const MasterStackConfig& config,
+                                                               const std::shared_ptr<FragmentBufferPool>& bufferPool)
 {
-    return std::make_shared<MasterSessionStack>(logger, executor, SOEHandler, application, scheduler, session, linktx,
-                                                config);
+    return std::allocate_shared<MasterSessionStack>(ResourceAllocator<MasterSessionStack>(), logger, executor,
+                                                    SOEHandler, application, scheduler, session, linktx, config,
+                                                    bufferPool);
 }
 
 MasterSessionStack::MasterSessionStack(const Logger& logger,
@@ -47,11 +50,17 @@ MasterSessionStack::MasterSessionStack(const Logger& logger,
                                        const std::shared_ptr<IMasterScheduler>& scheduler,
                                        std::shared_ptr<LinkSession> session,
                                        ILinkTx& linktx,
-                                       const MasterStackConfig& config)
+                                       const MasterStackConfig& config,
+                                       const std::shared_ptr<FragmentBufferPool>& bufferPool)
     : executor(executor),
       scheduler(scheduler),
       session(std::move(session)),
-      stack(logger, executor, application, config.master.maxRxFragSize, LinkLayerConfig(config.link, false)),
+      stack(logger,
+            executor,
+            application,
+            config.master.maxRxFragSize,
+            LinkLayerConfig(config.link, false),
+            bufferPool),
       context(Addresses(config.link.LocalAddr, config.link.RemoteAddr),
               logger,
               executor,
@@ -59,7 +68,9 @@ MasterSessionStack::MasterSessionStack(const Logger& logger,
               SOEHandler,
               application,
               scheduler,
-              config.master)
+              config.master,
+              bufferPool,
+              config.master.decodeOnThreadPool ? executor->fork() : nullptr)
 {
     stack.link->SetRouter(linktx);
     stack.transport->SetAppLayer(context);
@@ -165,6 +176,17 @@ std::shared_ptr<IMasterScan> MasterSessionStack::AddRangeScan(GroupVariationID g
     return MasterScan::Create(executor->return_from<std::shared_ptr<IMasterTask>>(get), this->scheduler);
 }
 
+std::shared_ptr<IMasterScan> MasterSessionStack::AddAdaptiveClassScan(const ClassField& field,
+                                                                      const AdaptiveScanConfig& scanConfig,
+                                                                      std::shared_ptr<ISOEHandler> soe_handler,
+                                                                      const TaskConfig& config)
+{
+    auto get = [self = shared_from_this(), soe_handler, field, scanConfig, config] {
+        return self->context.AddAdaptiveClassScan(field, scanConfig, std::move(soe_handler), config);
+    };
+    return MasterScan::Create(executor->return_from<std::shared_ptr<IMasterTask>>(get), this->scheduler);
+}
+
 void MasterSessionStack::Scan(const std::vector<Header>& headers,
                               std::shared_ptr<ISOEHandler> soe_handler,
                               const TaskConfig& config)
@@ -264,7 +286,10 @@ void MasterSessionStack::DirectOperate(CommandSet&& commands,
 
 StackStatistics MasterSessionStack::CreateStatistics() const
 {
-    return StackStatistics(this->stack.link->GetStatistics(), this->stack.transport->GetStatistics());
+    StackStatistics::Memory memory;
+    this->stack.RecordMemory(memory);
+    this->context.RecordMemory(memory);
+    return StackStatistics(this->stack.link->GetStatistics(), this->stack.transport->GetStatistics(), memory);
 }
 
 } // namespace opendnp3
@@ -47,7 +47,8 @@ public:
                                                       const std::shared_ptr<IMasterScheduler>& scheduler,
                                                       const std::shared_ptr<LinkSession>& session,
                                                       ILinkTx& linktx,
-                                                      const MasterStackConfig& config);
+                                                      const MasterStackConfig& config,
+                                                      const std::shared_ptr<FragmentBufferPool>& bufferPool);
 
     void OnLowerLayerUp();
 
@@ -84,6 +85,10 @@ public:
                                               TimeDuration period,
                                               std::shared_ptr<ISOEHandler> soe_handler,
                                               const TaskConfig& config) final;
+    std::shared_ptr<IMasterScan> AddAdaptiveClassScan(const ClassField& field,
+                                                      const AdaptiveScanConfig& scanConfig,
+                                                      std::shared_ptr<ISOEHandler> soe_handler,
+                                                      const TaskConfig& config) final;
     void Scan(const std::vector<Header>& headers,
               std::shared_ptr<ISOEHandler> soe_handler,
               const TaskConfig& config) final;
@@ -117,7 +122,8 @@ public:
                        const std::shared_ptr<IMasterScheduler>& scheduler,
                        std::shared_ptr<LinkSession> session,
                        ILinkTx& linktx,
-                       const MasterStackConfig& config);
+                       const MasterStackConfig& config,
+                       const std::shared_ptr<FragmentBufferPool>& bufferPool);
 
 private:
     StackStatistics CreateStatistics() const;
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_MASTERSESSIONSTACKPOOL_H
+#define OPENDNP3_MASTERSESSIONSTACKPOOL_H
+
+#include "opendnp3/util/IMemoryResource.h"
+#include "opendnp3/util/Uncopyable.h"
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+ * Memory resource that retains the blocks freed by closed master session stacks so that the
+ * next session accepted by a listener doesn't go back to the heap.
+ *
+ * A session stack is created in a MemoryScope on this resource, so the stack object, its link and
+ * transport layers, its fragment buffers and its scheduler are all drawn from it. Every session
+ * allocates the same sizes, so blocks are kept in a free list per size.
+ *
+ * Sessions are created and destroyed on different strands, so it is thread-safe.
+ */
+class MasterSessionStackPool final : public IMemoryResource, private Uncopyable
+{
+public:
+    /// @param capacity the number of blocks of each size that are retained
+    explicit MasterSessionStackPool(size_t capacity) : capacity(capacity) {}
+
+    ~MasterSessionStackPool() override
+    {
+        for (auto& list : this->freeLists)
+        {
+            for (auto block : list.second)
+            {
+                ::operator delete(block);
+            }
+        }
+    }
+
+    void* Allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            auto iter = this->freeLists.find(bytes);
+            if (iter != this->freeLists.end() && !iter->second.empty())
+            {
+                auto block = iter->second.back();
+                iter->second.pop_back();
+                --this->numRetained;
+                return block;
+            }
+        }
+
+        return ::operator new(bytes);
+    }
+
+    void Deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+    {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            auto& list = this->freeLists[bytes];
+            if (list.size() < this->capacity)
+            {
+                list.push_back(p);
+                ++this->numRetained;
+                return;
+            }
+        }
+
+        ::operator delete(p);
+    }
+
+    /// the number of blocks of all sizes currently retained
+    size_t NumRetained()
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->numRetained;
+    }
+
+private:
+    const size_t capacity;
+
+    std::mutex mutex;
+    size_t numRetained = 0;
+    std::map<size_t, std::vector<void*>> freeLists;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -40,7 +40,8 @@ MasterStack::MasterStack(const Logger& logger,
                 iohandler,
                 manager,
                 config.master.maxRxFragSize,
-                LinkLayerConfig(config.link, false)),
+                LinkLayerConfig(config.link, false),
+                config.master.poolFragmentBuffers ? manager->GetBufferPool() : nullptr),
       mcontext(Addresses(config.link.LocalAddr, config.link.RemoteAddr),
                logger,
                executor,
@@ -48,7 +49,9 @@ MasterStack::MasterStack(const Logger& logger,
                SOEHandler,
                application,
                scheduler,
-               config.master)
+               config.master,
+               config.master.poolFragmentBuffers ? manager->GetBufferPool() : nullptr,
+               config.master.decodeOnThreadPool ? executor->fork() : nullptr)
 {
     tstack.transport->SetAppLayer(mcontext);
 }
@@ -72,7 +75,11 @@ void MasterStack::Shutdown()
 
 StackStatistics MasterStack::GetStackStatistics()
 {
-    auto get = [self = shared_from_this()]() -> StackStatistics { return self->CreateStatistics(); };
+    auto get = [self = shared_from_this()]() -> StackStatistics {
+        auto statistics = self->CreateStatistics();
+        self->mcontext.RecordMemory(statistics.memory);
+        return statistics;
+    };
     return this->executor->return_from<StackStatistics>(get);
 }
 
@@ -133,6 +140,17 @@ std::shared_ptr<IMasterScan> MasterStack::AddRangeScan(GroupVariationID gvId,
     return MasterScan::Create(executor->return_from<std::shared_ptr<IMasterTask>>(add), mcontext.scheduler);
 }
 
+std::shared_ptr<IMasterScan> MasterStack::AddAdaptiveClassScan(const ClassField& field,
+                                                               const AdaptiveScanConfig& scanConfig,
+                                                               std::shared_ptr<ISOEHandler> soe_handler,
+                                                               const TaskConfig& config)
+{
+    auto add = [self = this->shared_from_this(), soe_handler, field, scanConfig, config]() {
+        return self->mcontext.AddAdaptiveClassScan(field, scanConfig, std::move(soe_handler), config);
+    };
+    return MasterScan::Create(executor->return_from<std::shared_ptr<IMasterTask>>(add), mcontext.scheduler);
+}
+
 void MasterStack::Scan(const std::vector<Header>& headers,
                        std::shared_ptr<ISOEHandler> soe_handler,
                        const TaskConfig& config)
@@ -55,8 +55,8 @@ public:
                                                const std::shared_ptr<IResourceManager>& manager,
                                                const MasterStackConfig& config)
     {
-        auto ret = std::make_shared<MasterStack>(logger, executor, SOEHandler, application, scheduler, iohandler,
-                                                 manager, config);
+        auto ret = std::allocate_shared<MasterStack>(ResourceAllocator<MasterStack>(), logger, executor, SOEHandler,
+                                                     application, scheduler, iohandler, manager, config);
 
         ret->tstack.link->SetRouter(*ret);
 
@@ -126,6 +126,11 @@ public:
                                               std::shared_ptr<ISOEHandler> soe_handler,
                                               const TaskConfig& config) override;
 
+    std::shared_ptr<IMasterScan> AddAdaptiveClassScan(const ClassField& field,
+                                                      const AdaptiveScanConfig& scanConfig,
+                                                      std::shared_ptr<ISOEHandler> soe_handler,
+                                                      const TaskConfig& config) override;
+
     void Scan(const std::vector<Header>& headers,
               std::shared_ptr<ISOEHandler> soe_handler,
               const TaskConfig& config) override;
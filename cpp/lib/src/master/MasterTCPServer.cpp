@@ -35,10 +35,14 @@ namespace opendnp3
 MasterTCPServer::MasterTCPServer(const Logger& logger,
                                  const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
                                  const IPEndpoint& endpoint,
+                                 const ListenerConfig& config,
                                  std::shared_ptr<IListenCallbacks> callbacks,
                                  std::shared_ptr<ResourceManager> manager,
                                  std::error_code& ec)
-    : TCPServer(logger, executor, endpoint, ec), callbacks(std::move(callbacks)), manager(std::move(manager))
+    : TCPServer(logger, executor, endpoint, config.numAcceptors, ec),
+      callbacks(std::move(callbacks)),
+      manager(std::move(manager)),
+      pool(config.sessionPoolSize > 0 ? std::make_shared<MasterSessionStackPool>(config.sessionPoolSize) : nullptr)
 {
 }
 
@@ -63,7 +67,7 @@ void MasterTCPServer::AcceptConnection(uint64_t sessionid,
 
         auto create = [&]() -> std::shared_ptr<LinkSession> {
             return LinkSession::Create(this->logger.detach(SessionIdToString(sessionid)), sessionid, this->manager,
-                                       this->callbacks, channel);
+                                       this->callbacks, channel, this->pool);
         };
 
         if (!this->manager->Bind<LinkSession>(create))
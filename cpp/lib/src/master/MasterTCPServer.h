@@ -22,8 +22,10 @@
 
 #include "ResourceManager.h"
 #include "channel/TCPServer.h"
+#include "master/MasterSessionStackPool.h"
 
 #include "opendnp3/channel/IPEndpoint.h"
+#include "opendnp3/channel/ListenerConfig.h"
 #include "opendnp3/logging/Logger.h"
 #include "opendnp3/master/IListenCallbacks.h"
 
@@ -41,6 +43,7 @@ public:
     MasterTCPServer(const Logger& logger,
                     const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
                     const IPEndpoint& endpoint,
+                    const ListenerConfig& config,
                     std::shared_ptr<IListenCallbacks> callbacks,
                     std::shared_ptr<ResourceManager> manager,
                     std::error_code& ec);
@@ -48,11 +51,12 @@ public:
     static std::shared_ptr<MasterTCPServer> Create(const Logger& logger,
                                                    const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
                                                    const IPEndpoint& endpoint,
+                                                   const ListenerConfig& config,
                                                    const std::shared_ptr<IListenCallbacks>& callbacks,
                                                    const std::shared_ptr<ResourceManager>& manager,
                                                    std::error_code& ec)
     {
-        auto server = std::make_shared<MasterTCPServer>(logger, executor, endpoint, callbacks, manager, ec);
+        auto server = std::make_shared<MasterTCPServer>(logger, executor, endpoint, config, callbacks, manager, ec);
 
         if (!ec)
         {
@@ -65,6 +69,7 @@ public:
 private:
     std::shared_ptr<IListenCallbacks> callbacks;
     std::shared_ptr<ResourceManager> manager;
+    std::shared_ptr<MasterSessionStackPool> pool; // null if session stacks aren't pooled
 
     static std::string SessionIdToString(uint64_t sessionid);
 
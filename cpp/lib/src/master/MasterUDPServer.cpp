@@ -0,0 +1,88 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "master/MasterUDPServer.h"
+
+#include "channel/UDPDatagramChannel.h"
+#include "link/LinkSession.h"
+#include "logging/LogMacros.h"
+
+#include "opendnp3/logging/LogLevels.h"
+
+#include <sstream>
+#include <utility>
+
+namespace opendnp3
+{
+
+MasterUDPServer::MasterUDPServer(const Logger& logger,
+                                 const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
+                                 const IPEndpoint& endpoint,
+                                 std::shared_ptr<IListenCallbacks> callbacks,
+                                 std::shared_ptr<ResourceManager> manager,
+                                 std::error_code& ec)
+    : UDPServer(logger, executor, endpoint, ec), callbacks(std::move(callbacks)), manager(std::move(manager))
+{
+}
+
+void MasterUDPServer::OnShutdown()
+{
+    this->manager->Detach(this->shared_from_this());
+}
+
+std::shared_ptr<UDPDatagramChannel> MasterUDPServer::AcceptRoute(uint64_t sessionid, const UDPRoute& route)
+{
+    std::ostringstream oss;
+    oss << route.endpoint << " (" << route.addresses.source << " -> " << route.addresses.destination << ")";
+
+    if (!this->callbacks->AcceptConnection(sessionid, route.endpoint.address().to_string()))
+    {
+        FORMAT_LOG_BLOCK(this->logger, flags::INFO, "Rejected route from: %s", oss.str().c_str());
+        return nullptr;
+    }
+
+    FORMAT_LOG_BLOCK(this->logger, flags::INFO, "Accepted route from: %s", oss.str().c_str());
+
+    // run the link session in its own strand
+    auto channel = UDPDatagramChannel::Create(this->executor->fork(),
+                                              std::static_pointer_cast<UDPServer>(this->shared_from_this()), route);
+
+    auto create = [&]() -> std::shared_ptr<LinkSession> {
+        return LinkSession::Create(this->logger.detach(SessionIdToString(sessionid)), sessionid, this->manager,
+                                   this->callbacks, channel);
+    };
+
+    if (!this->manager->Bind<LinkSession>(create))
+    {
+        channel->Shutdown();
+        return nullptr;
+    }
+
+    return channel;
+}
+
+std::string MasterUDPServer::SessionIdToString(uint64_t sessionid)
+{
+    std::ostringstream oss;
+    oss << "session-" << sessionid;
+    return oss.str();
+}
+
+} // namespace opendnp3
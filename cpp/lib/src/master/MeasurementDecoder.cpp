@@ -0,0 +1,104 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "master/MeasurementDecoder.h"
+
+#include "master/MeasurementHandler.h"
+
+#include <vector>
+
+namespace opendnp3
+{
+
+MeasurementDecoder::MeasurementDecoder(const Logger& logger,
+                                       std::shared_ptr<exe4cpp::IExecutor> executor,
+                                       std::shared_ptr<exe4cpp::IExecutor> decodeExecutor,
+                                       uint32_t maxQueuedFragments)
+    : logger(logger),
+      decodeLogger(logger),
+      executor(std::move(executor)),
+      decodeExecutor(std::move(decodeExecutor)),
+      maxQueuedFragments(maxQueuedFragments)
+{
+}
+
+ParseResult MeasurementDecoder::Decode(ResponseInfo info,
+                                       const ser4cpp::rseq_t& objects,
+                                       const std::shared_ptr<ISOEHandler>& handler,
+                                       uint32_t* pNumEvents)
+{
+    // only walks the headers, the values themselves are decoded when the handler iterates them
+    const auto result = MeasurementHandler::ProcessMeasurements(info, objects, logger, nullptr, pNumEvents);
+
+    if (result != ParseResult::OK || !handler)
+    {
+        return result;
+    }
+
+    ++this->numQueued;
+
+    const auto begin = static_cast<const uint8_t*>(objects);
+    auto fragment = std::make_shared<std::vector<uint8_t>>(begin, begin + objects.length());
+
+    this->decodeExecutor->post([self = shared_from_this(), info, fragment, handler]() {
+        MeasurementHandler::ProcessMeasurements(info, ser4cpp::rseq_t(fragment->data(), fragment->size()),
+                                                self->decodeLogger, handler.get());
+        self->executor->post([self]() { self->OnDelivered(); });
+    });
+
+    return result;
+}
+
+void MeasurementDecoder::Post(const std::function<void()>& action)
+{
+    this->decodeExecutor->post(action);
+}
+
+void MeasurementDecoder::AfterDelivered(std::function<void()> action)
+{
+    if (this->detached || (this->numQueued == 0 && this->numPendingActions == 0))
+    {
+        action();
+        return;
+    }
+
+    // the decode executor runs in order, so this comes after the fragments queued so far
+    ++this->numPendingActions;
+    this->decodeExecutor->post([self = shared_from_this(), action = std::move(action)]() {
+        self->executor->post([self, action]() {
+            --self->numPendingActions;
+            if (!self->detached)
+            {
+                action();
+            }
+        });
+    });
+}
+
+void MeasurementDecoder::OnDelivered()
+{
+    --this->numQueued;
+
+    if (this->onDelivered)
+    {
+        this->onDelivered();
+    }
+}
+
+} // namespace opendnp3
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_MEASUREMENTDECODER_H
+#define OPENDNP3_MEASUREMENTDECODER_H
+
+#include "app/parsing/ParseResult.h"
+
+#include "opendnp3/logging/Logger.h"
+#include "opendnp3/master/ISOEHandler.h"
+#include "opendnp3/util/Uncopyable.h"
+
+#include <exe4cpp/IExecutor.h>
+#include <ser4cpp/container/SequenceTypes.h>
+
+#include <functional>
+#include <memory>
+
+namespace opendnp3
+{
+
+/**
+ * Delivers received measurement fragments to ISOEHandlers on a separate executor (a strand of the thread pool),
+ * so that the channel strand only validates them.
+ *
+ * Fragments are delivered one at a time in the order they were queued.
+ */
+class MeasurementDecoder final : public std::enable_shared_from_this<MeasurementDecoder>, private Uncopyable
+{
+public:
+    MeasurementDecoder(const Logger& logger,
+                       std::shared_ptr<exe4cpp::IExecutor> executor,
+                       std::shared_ptr<exe4cpp::IExecutor> decodeExecutor,
+                       uint32_t maxQueuedFragments);
+
+    /**
+     * Validate the fragment and count its events on the calling (channel) strand, then queue a copy of it for delivery
+     */
+    ParseResult Decode(ResponseInfo info,
+                       const ser4cpp::rseq_t& objects,
+                       const std::shared_ptr<ISOEHandler>& handler,
+                       uint32_t* pNumEvents = nullptr);
+
+    /// run an action on the decode executor after all the fragments queued so far
+    void Post(const std::function<void()>& action);
+
+    /**
+     * Run an action on the channel strand once all the fragments queued so far have been delivered, or right away if
+     * nothing is outstanding. Actions run in the order they were requested. Once detached they are dropped.
+     */
+    void AfterDelivered(std::function<void()> action);
+
+    /// true if fewer than the maximum number of fragments are waiting to be delivered
+    bool HasCapacity() const
+    {
+        return numQueued < maxQueuedFragments;
+    }
+
+    /// invoked on the channel strand each time a queued fragment has been delivered
+    void SetOnDelivered(std::function<void()> callback)
+    {
+        this->onDelivered = std::move(callback);
+    }
+
+    /// stop calling back into the owner, e.g. when the master is destroyed
+    void Detach()
+    {
+        this->onDelivered = nullptr;
+        this->detached = true;
+    }
+
+private:
+    void OnDelivered();
+
+    Logger logger;
+    Logger decodeLogger;
+
+    const std::shared_ptr<exe4cpp::IExecutor> executor;
+    const std::shared_ptr<exe4cpp::IExecutor> decodeExecutor;
+    const uint32_t maxQueuedFragments;
+
+    // only accessed from the channel strand
+    uint32_t numQueued = 0;
+    uint32_t numPendingActions = 0;
+    bool detached = false;
+    std::function<void()> onDelivered;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -28,10 +28,16 @@ namespace opendnp3
 ParseResult MeasurementHandler::ProcessMeasurements(ResponseInfo info,
                                                     const ser4cpp::rseq_t& objects,
                                                     Logger& logger,
-                                                    ISOEHandler* pHandler)
+                                                    ISOEHandler* pHandler,
+                                                    uint32_t* pNumEvents)
 {
     MeasurementHandler handler(info, logger, pHandler);
-    return APDUParser::Parse(objects, handler, &logger);
+    const auto result = APDUParser::Parse(objects, handler, &logger);
+    if (pNumEvents)
+    {
+        *pNumEvents = handler.numEvents;
+    }
+    return result;
 }
 
 MeasurementHandler::MeasurementHandler(ResponseInfo info, const Logger& logger, ISOEHandler* pSOEHandler)
@@ -74,7 +80,10 @@ IINField MeasurementHandler::ProcessHeader(const CountHeader& header, const ICol
     auto collection = Map<Group50Var1, DNPTime>(values, transform);
 
     HeaderInfo info(header.enumeration, header.GetQualifierCode(), TimestampQuality::INVALID, header.headerIndex);
-    this->pSOEHandler->Process(info, collection);
+    if (this->pSOEHandler)
+    {
+        this->pSOEHandler->Process(info, collection);
+    }
 
     return IINField();
 }
@@ -43,11 +43,14 @@ class MeasurementHandler final : public IAPDUHandler
 public:
     /**
      * Static helper function for interpreting a response as a measurement response
+     *
+     * With a null handler the response is only validated and its events counted
      */
     static ParseResult ProcessMeasurements(ResponseInfo info,
                                            const ser4cpp::rseq_t& objects,
                                            Logger& logger,
-                                           ISOEHandler* pHandler);
+                                           ISOEHandler* pHandler,
+                                           uint32_t* pNumEvents = nullptr);
 
     // TODO
     virtual bool IsAllowed(uint32_t headerCount, GroupVariation gv, QualifierCode qc) override
@@ -112,7 +115,14 @@ private:
     {
         this->CheckForTxStart();
         HeaderInfo info(record.enumeration, record.GetQualifierCode(), tsquality, record.headerIndex);
-        this->pSOEHandler->Process(info, values);
+        if (info.isEventVariation)
+        {
+            this->numEvents += values.Count();
+        }
+        if (this->pSOEHandler)
+        {
+            this->pSOEHandler->Process(info, values);
+        }
         return IINField();
     }
 
@@ -120,6 +130,7 @@ private:
 
     bool txInitiated;
     ISOEHandler* pSOEHandler;
+    uint32_t numEvents = 0;
 
     DNPTime commonTimeOccurence;
 
@@ -20,6 +20,7 @@
 #include "PollTaskBase.h"
 
 #include "logging/LogMacros.h"
+#include "master/MeasurementDecoder.h"
 #include "master/MeasurementHandler.h"
 
 #include "opendnp3/logging/LogLevels.h"
@@ -72,9 +73,15 @@ IMasterTask::ResponseResult PollTaskBase::ProcessMeasurements(const APDUResponse
 {
     ++rxCount;
 
-    if (MeasurementHandler::ProcessMeasurements(header.as_response_info(), objects, logger, handler.get())
-        == ParseResult::OK)
+    uint32_t numEvents = 0;
+    auto decoder = this->context->GetDecoder();
+    const auto result
+        = decoder ? decoder->Decode(header.as_response_info(), objects, handler, &numEvents)
+                  : MeasurementHandler::ProcessMeasurements(header.as_response_info(), objects, logger, handler.get(),
+                                                            &numEvents);
+    if (result == ParseResult::OK)
     {
+        this->OnMeasurements(header, objects, numEvents);
         return header.control.FIN ? ResponseResult::OK_FINAL : ResponseResult::OK_CONTINUE;
     }
 
@@ -57,6 +57,11 @@ protected:
 
     virtual void Initialize() override final;
 
+    // called for every fragment of the response that was successfully processed
+    virtual void OnMeasurements(const APDUResponseHeader& header, const ser4cpp::rseq_t& objects, uint32_t numEvents)
+    {
+    }
+
     uint32_t rxCount = 0;
     std::shared_ptr<ISOEHandler> handler;
 };
@@ -0,0 +1,102 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ShadowSOEHandler.h"
+
+#include <utility>
+
+namespace opendnp3
+{
+
+ShadowSOEHandler::ShadowSOEHandler(std::shared_ptr<StaticShadowTable> table, std::shared_ptr<ISOEHandler> handler)
+    : table(std::move(table)), handler(std::move(handler))
+{
+}
+
+void ShadowSOEHandler::BeginFragment(const ResponseInfo& info)
+{
+    this->handler->BeginFragment(info);
+}
+
+void ShadowSOEHandler::EndFragment(const ResponseInfo& info)
+{
+    this->handler->EndFragment(info);
+}
+
+void ShadowSOEHandler::Process(const HeaderInfo& info, const ICollection<Indexed<Binary>>& values)
+{
+    this->ProcessStatic(info, values, this->table->binary);
+}
+
+void ShadowSOEHandler::Process(const HeaderInfo& info, const ICollection<Indexed<DoubleBitBinary>>& values)
+{
+    this->ProcessStatic(info, values, this->table->doubleBinary);
+}
+
+void ShadowSOEHandler::Process(const HeaderInfo& info, const ICollection<Indexed<Analog>>& values)
+{
+    this->ProcessStatic(info, values, this->table->analog);
+}
+
+void ShadowSOEHandler::Process(const HeaderInfo& info, const ICollection<Indexed<Counter>>& values)
+{
+    this->ProcessStatic(info, values, this->table->counter);
+}
+
+void ShadowSOEHandler::Process(const HeaderInfo& info, const ICollection<Indexed<FrozenCounter>>& values)
+{
+    this->ProcessStatic(info, values, this->table->frozenCounter);
+}
+
+void ShadowSOEHandler::Process(const HeaderInfo& info, const ICollection<Indexed<BinaryOutputStatus>>& values)
+{
+    this->ProcessStatic(info, values, this->table->binaryOutputStatus);
+}
+
+void ShadowSOEHandler::Process(const HeaderInfo& info, const ICollection<Indexed<AnalogOutputStatus>>& values)
+{
+    this->ProcessStatic(info, values, this->table->analogOutputStatus);
+}
+
+void ShadowSOEHandler::Process(const HeaderInfo& info, const ICollection<Indexed<OctetString>>& values)
+{
+    this->ProcessStatic(info, values, this->table->octetString);
+}
+
+void ShadowSOEHandler::Process(const HeaderInfo& info, const ICollection<Indexed<TimeAndInterval>>& values)
+{
+    this->handler->Process(info, values);
+}
+
+void ShadowSOEHandler::Process(const HeaderInfo& info, const ICollection<Indexed<BinaryCommandEvent>>& values)
+{
+    this->handler->Process(info, values);
+}
+
+void ShadowSOEHandler::Process(const HeaderInfo& info, const ICollection<Indexed<AnalogCommandEvent>>& values)
+{
+    this->handler->Process(info, values);
+}
+
+void ShadowSOEHandler::Process(const HeaderInfo& info, const ICollection<DNPTime>& values)
+{
+    this->handler->Process(info, values);
+}
+
+} // namespace opendnp3
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_SHADOWSOEHANDLER_H
+#define OPENDNP3_SHADOWSOEHANDLER_H
+
+#include "app/parsing/Collections.h"
+#include "master/StaticShadowTable.h"
+
+#include "opendnp3/master/ISOEHandler.h"
+
+#include <memory>
+
+namespace opendnp3
+{
+
+/**
+ * Decorates an ISOEHandler, only passing on the static values that changed since the last time a value of the point
+ * (static or event) was reported
+ */
+class ShadowSOEHandler final : public ISOEHandler
+{
+public:
+    ShadowSOEHandler(std::shared_ptr<StaticShadowTable> table, std::shared_ptr<ISOEHandler> handler);
+
+    void BeginFragment(const ResponseInfo& info) override;
+    void EndFragment(const ResponseInfo& info) override;
+
+    void Process(const HeaderInfo& info, const ICollection<Indexed<Binary>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<DoubleBitBinary>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<Analog>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<Counter>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<FrozenCounter>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryOutputStatus>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogOutputStatus>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<OctetString>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<TimeAndInterval>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryCommandEvent>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogCommandEvent>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<DNPTime>& values) override;
+
+private:
+    template<class T>
+    void ProcessStatic(const HeaderInfo& info,
+                       const ICollection<Indexed<T>>& values,
+                       StaticShadowTable::Shadow<T>& shadow);
+
+    const std::shared_ptr<StaticShadowTable> table;
+    const std::shared_ptr<ISOEHandler> handler;
+};
+
+template<class T>
+void ShadowSOEHandler::ProcessStatic(const HeaderInfo& info,
+                                     const ICollection<Indexed<T>>& values,
+                                     StaticShadowTable::Shadow<T>& shadow)
+{
+    if (info.isEventVariation)
+    {
+        // events are always passed on, but the next static value has to be compared against them
+        shadow.Record(values);
+        this->handler->Process(info, values);
+        return;
+    }
+
+    HeaderInfo filtered(info);
+    filtered.numUnchanged = shadow.Filter(values);
+
+    const auto& changed = shadow.Changed();
+    this->handler->Process(filtered, ArrayCollection<Indexed<T>>(changed.data(), changed.size()));
+}
+
+} // namespace opendnp3
+
+#endif
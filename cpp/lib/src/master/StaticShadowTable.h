@@ -0,0 +1,144 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_STATICSHADOWTABLE_H
+#define OPENDNP3_STATICSHADOWTABLE_H
+
+#include "opendnp3/app/Indexed.h"
+#include "opendnp3/app/MeasurementTypes.h"
+#include "opendnp3/app/OctetString.h"
+#include "opendnp3/app/parsing/ICollection.h"
+#include "opendnp3/util/Uncopyable.h"
+
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+ * The last value a master reported for every static point, stored densely by index for each type.
+ *
+ * Used to suppress static values (e.g. from integrity polls) that did not change since they were
+ * last passed to the application.
+ */
+class StaticShadowTable : private Uncopyable
+{
+public:
+    template<class T> class Shadow
+    {
+        friend class StaticShadowTable;
+
+    public:
+        /**
+         * Compare a collection against the shadow values, updating the shadow with any changes
+         *
+         * @return the number of unchanged values, the changed values are available from Changed()
+         */
+        uint32_t Filter(const ICollection<Indexed<T>>& values);
+
+        /**
+         * Update the shadow with values that were passed on unfiltered, e.g. events, so that a later static value
+         * is compared against the last value the application actually saw
+         */
+        void Record(const ICollection<Indexed<T>>& values);
+
+        const std::vector<Indexed<T>>& Changed() const
+        {
+            return changed;
+        }
+
+    private:
+        void Store(const Indexed<T>& item)
+        {
+            if (item.index >= this->values.size())
+            {
+                this->values.resize(item.index + 1);
+                this->known.resize(item.index + 1, false);
+            }
+
+            this->values[item.index] = item.value;
+            this->known[item.index] = true;
+        }
+
+        void Clear()
+        {
+            this->values.clear();
+            this->known.clear();
+            this->changed.clear();
+        }
+
+        std::vector<T> values;
+        std::vector<bool> known;
+
+        // changed values of the last filtered collection, kept to reuse the capacity
+        std::vector<Indexed<T>> changed;
+    };
+
+    // forget all values, e.g. when communications are lost
+    void Clear();
+
+    Shadow<Binary> binary;
+    Shadow<DoubleBitBinary> doubleBinary;
+    Shadow<Analog> analog;
+    Shadow<Counter> counter;
+    Shadow<FrozenCounter> frozenCounter;
+    Shadow<BinaryOutputStatus> binaryOutputStatus;
+    Shadow<AnalogOutputStatus> analogOutputStatus;
+    Shadow<OctetString> octetString;
+
+private:
+    template<class T> static bool IsSame(const TypedMeasurement<T>& left, const TypedMeasurement<T>& right)
+    {
+        // the timestamp of a static value is when it was read, only its quality is significant
+        return (left.value == right.value) && (left.flags.value == right.flags.value)
+            && (left.time.quality == right.time.quality);
+    }
+
+    static bool IsSame(const OctetString& left, const OctetString& right);
+};
+
+template<class T> uint32_t StaticShadowTable::Shadow<T>::Filter(const ICollection<Indexed<T>>& values)
+{
+    uint32_t numUnchanged = 0;
+    this->changed.clear();
+
+    values.ForeachItem([this, &numUnchanged](const Indexed<T>& item) {
+        if (item.index < this->values.size() && this->known[item.index]
+            && StaticShadowTable::IsSame(this->values[item.index], item.value))
+        {
+            ++numUnchanged;
+        }
+        else
+        {
+            this->Store(item);
+            this->changed.push_back(item);
+        }
+    });
+
+    return numUnchanged;
+}
+
+template<class T> void StaticShadowTable::Shadow<T>::Record(const ICollection<Indexed<T>>& values)
+{
+    values.ForeachItem([this](const Indexed<T>& item) { this->Store(item); });
+}
+
+} // namespace opendnp3
+
+#endif
@@ -73,6 +73,22 @@ public:
         return startExpiration;
     }
 
+    /**
+     * return the period of a recurring task, negative if the task isn't periodic
+     */
+    TimeDuration GetPeriod() const
+    {
+        return period;
+    }
+
+    /**
+     * Change the period of a recurring task. Takes effect the next time the task succeeds
+     */
+    void SetPeriod(const TimeDuration& period)
+    {
+        this->period = period;
+    }
+
     /**
      * reset to the initial state
      */
@@ -94,7 +110,7 @@ private:
                  const TimeDuration& maxRetryDelay,
                  const Timestamp& startExpiration);
 
-    const TimeDuration period;
+    TimeDuration period;
     const TimeDuration minRetryDelay;
     const TimeDuration maxRetryDelay;
     const Timestamp startExpiration;
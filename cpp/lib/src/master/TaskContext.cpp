@@ -21,6 +21,7 @@
 #include "TaskContext.h"
 
 #include "master/IMasterTask.h"
+#include "master/MeasurementDecoder.h"
 
 namespace opendnp3
 {
@@ -47,4 +48,26 @@ bool TaskContext::IsBlocked(const IMasterTask& task) const
     return false;
 }
 
+void TaskContext::SetDecoder(std::shared_ptr<MeasurementDecoder> decoder)
+{
+    this->decoder = std::move(decoder);
+}
+
+MeasurementDecoder* TaskContext::GetDecoder() const
+{
+    return this->decoder.get();
+}
+
+void TaskContext::AfterMeasurementsDelivered(std::function<void()> action)
+{
+    if (this->decoder)
+    {
+        this->decoder->AfterDelivered(std::move(action));
+    }
+    else
+    {
+        action();
+    }
+}
+
 } // namespace opendnp3
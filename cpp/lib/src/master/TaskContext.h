@@ -22,12 +22,15 @@
 
 #include "opendnp3/util/Uncopyable.h"
 
+#include <functional>
+#include <memory>
 #include <set>
 
 namespace opendnp3
 {
 
 class IMasterTask; // break circular dependency
+class MeasurementDecoder;
 
 /**
  *
@@ -39,6 +42,7 @@ class IMasterTask; // break circular dependency
 class TaskContext : private Uncopyable
 {
     std::set<const IMasterTask*> blocking_tasks;
+    std::shared_ptr<MeasurementDecoder> decoder;
 
 public:
     void AddBlock(const IMasterTask& task);
@@ -46,6 +50,14 @@ public:
     void RemoveBlock(const IMasterTask& task);
 
     bool IsBlocked(const IMasterTask& task) const;
+
+    // decoder that measurement tasks hand their responses to, null if they are processed on the channel strand
+    void SetDecoder(std::shared_ptr<MeasurementDecoder> decoder);
+
+    MeasurementDecoder* GetDecoder() const;
+
+    // run an action once the measurements handed to the decoder so far have been delivered, right away without one
+    void AfterMeasurementsDelivered(std::function<void()> action);
 };
 
 } // namespace opendnp3
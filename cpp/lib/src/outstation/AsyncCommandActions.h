@@ -0,0 +1,124 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_ASYNCCOMMANDACTIONS_H
+#define OPENDNP3_ASYNCCOMMANDACTIONS_H
+
+#include "ICommandAction.h"
+#include "outstation/AsyncCommandState.h"
+
+#include "opendnp3/outstation/IAsyncCommandHandler.h"
+
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+ * Dispatches the operates of a request to an IAsyncCommandHandler, recording a slot for each command in the state.
+ *
+ * The returned statuses are meaningless since no response is written while dispatching.
+ */
+class AsyncCommandDispatcher final : public ICommandAction
+{
+
+public:
+    AsyncCommandDispatcher(IAsyncCommandHandler& handler,
+                           IUpdateHandler& updates,
+                           OperateType op_type,
+                           AsyncCommandState& state);
+
+    ~AsyncCommandDispatcher();
+
+    CommandStatus Action(const ControlRelayOutputBlock& command, uint16_t index) override;
+
+    CommandStatus Action(const AnalogOutputInt16& command, uint16_t index) override;
+
+    CommandStatus Action(const AnalogOutputInt32& command, uint16_t index) override;
+
+    CommandStatus Action(const AnalogOutputFloat32& command, uint16_t index) override;
+
+    CommandStatus Action(const AnalogOutputDouble64& command, uint16_t index) override;
+
+private:
+    template<class T> CommandStatus ActionT(const T& command, uint16_t index)
+    {
+        this->CheckStart();
+        this->handler.Operate(command, index, this->updates, this->op_type, this->state.Dispatch());
+        return CommandStatus::SUCCESS;
+    }
+
+    void CheckStart();
+
+    bool is_started = false;
+
+    IAsyncCommandHandler& handler;
+    IUpdateHandler& updates;
+    OperateType op_type;
+    AsyncCommandState& state;
+};
+
+/**
+ * Replays the statuses recorded while dispatching a request, in order, to build its response
+ */
+class RecordedCommandAction final : public ICommandAction
+{
+
+public:
+    explicit RecordedCommandAction(const std::vector<CommandStatus>& statuses) : statuses(statuses) {}
+
+    CommandStatus Action(const ControlRelayOutputBlock& command, uint16_t index) override
+    {
+        return this->Next();
+    }
+
+    CommandStatus Action(const AnalogOutputInt16& command, uint16_t index) override
+    {
+        return this->Next();
+    }
+
+    CommandStatus Action(const AnalogOutputInt32& command, uint16_t index) override
+    {
+        return this->Next();
+    }
+
+    CommandStatus Action(const AnalogOutputFloat32& command, uint16_t index) override
+    {
+        return this->Next();
+    }
+
+    CommandStatus Action(const AnalogOutputDouble64& command, uint16_t index) override
+    {
+        return this->Next();
+    }
+
+private:
+    CommandStatus Next()
+    {
+        return (this->position < this->statuses.size()) ? this->statuses[this->position++]
+                                                        : CommandStatus::NOT_SUPPORTED;
+    }
+
+    const std::vector<CommandStatus>& statuses;
+    size_t position = 0;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "AsyncCommandHandlerAdapter.h"
+
+#include <utility>
+
+namespace opendnp3
+{
+
+AsyncCommandHandlerAdapter::AsyncCommandHandlerAdapter(std::shared_ptr<IAsyncCommandHandler> handler)
+    : handler(std::move(handler))
+{
+}
+
+void AsyncCommandHandlerAdapter::Begin()
+{
+    this->handler->Begin();
+}
+
+void AsyncCommandHandlerAdapter::End()
+{
+    this->handler->End();
+}
+
+CommandStatus AsyncCommandHandlerAdapter::Select(const ControlRelayOutputBlock& command, uint16_t index)
+{
+    return this->handler->Select(command, index);
+}
+
+CommandStatus AsyncCommandHandlerAdapter::Operate(const ControlRelayOutputBlock& command,
+                                                  uint16_t index,
+                                                  IUpdateHandler& handler,
+                                                  OperateType opType)
+{
+    return this->OperateT(command, index, handler, opType);
+}
+
+CommandStatus AsyncCommandHandlerAdapter::Select(const AnalogOutputInt16& command, uint16_t index)
+{
+    return this->handler->Select(command, index);
+}
+
+CommandStatus AsyncCommandHandlerAdapter::Operate(const AnalogOutputInt16& command,
+                                                  uint16_t index,
+                                                  IUpdateHandler& handler,
+                                                  OperateType opType)
+{
+    return this->OperateT(command, index, handler, opType);
+}
+
+CommandStatus AsyncCommandHandlerAdapter::Select(const AnalogOutputInt32& command, uint16_t index)
+{
+    return this->handler->Select(command, index);
+}
+
+CommandStatus AsyncCommandHandlerAdapter::Operate(const AnalogOutputInt32& command,
+                                                  uint16_t index,
+                                                  IUpdateHandler& handler,
+                                                  OperateType opType)
+{
+    return this->OperateT(command, index, handler, opType);
+}
+
+CommandStatus AsyncCommandHandlerAdapter::Select(const AnalogOutputFloat32& command, uint16_t index)
+{
+    return this->handler->Select(command, index);
+}
+
+CommandStatus AsyncCommandHandlerAdapter::Operate(const AnalogOutputFloat32& command,
+                                                  uint16_t index,
+                                                  IUpdateHandler& handler,
+                                                  OperateType opType)
+{
+    return this->OperateT(command, index, handler, opType);
+}
+
+CommandStatus AsyncCommandHandlerAdapter::Select(const AnalogOutputDouble64& command, uint16_t index)
+{
+    return this->handler->Select(command, index);
+}
+
+CommandStatus AsyncCommandHandlerAdapter::Operate(const AnalogOutputDouble64& command,
+                                                  uint16_t index,
+                                                  IUpdateHandler& handler,
+                                                  OperateType opType)
+{
+    return this->OperateT(command, index, handler, opType);
+}
+
+} // namespace opendnp3
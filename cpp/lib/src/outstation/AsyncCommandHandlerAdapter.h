@@ -0,0 +1,93 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_ASYNCCOMMANDHANDLERADAPTER_H
+#define OPENDNP3_ASYNCCOMMANDHANDLERADAPTER_H
+
+#include "opendnp3/outstation/IAsyncCommandHandler.h"
+#include "opendnp3/outstation/ICommandHandler.h"
+
+#include <memory>
+
+namespace opendnp3
+{
+
+/**
+ * Presents an IAsyncCommandHandler as an ICommandHandler for the requests answered synchronously: selects, and
+ * operates that don't need a response. Operates are dispatched with an empty completion and reported as successful.
+ */
+class AsyncCommandHandlerAdapter final : public ICommandHandler
+{
+
+public:
+    explicit AsyncCommandHandlerAdapter(std::shared_ptr<IAsyncCommandHandler> handler);
+
+    void Begin() override;
+
+    void End() override;
+
+    CommandStatus Select(const ControlRelayOutputBlock& command, uint16_t index) override;
+
+    CommandStatus Operate(const ControlRelayOutputBlock& command,
+                          uint16_t index,
+                          IUpdateHandler& handler,
+                          OperateType opType) override;
+
+    CommandStatus Select(const AnalogOutputInt16& command, uint16_t index) override;
+
+    CommandStatus Operate(const AnalogOutputInt16& command,
+                          uint16_t index,
+                          IUpdateHandler& handler,
+                          OperateType opType) override;
+
+    CommandStatus Select(const AnalogOutputInt32& command, uint16_t index) override;
+
+    CommandStatus Operate(const AnalogOutputInt32& command,
+                          uint16_t index,
+                          IUpdateHandler& handler,
+                          OperateType opType) override;
+
+    CommandStatus Select(const AnalogOutputFloat32& command, uint16_t index) override;
+
+    CommandStatus Operate(const AnalogOutputFloat32& command,
+                          uint16_t index,
+                          IUpdateHandler& handler,
+                          OperateType opType) override;
+
+    CommandStatus Select(const AnalogOutputDouble64& command, uint16_t index) override;
+
+    CommandStatus Operate(const AnalogOutputDouble64& command,
+                          uint16_t index,
+                          IUpdateHandler& handler,
+                          OperateType opType) override;
+
+private:
+    template<class T>
+    CommandStatus OperateT(const T& command, uint16_t index, IUpdateHandler& updates, OperateType opType)
+    {
+        this->handler->Operate(command, index, updates, opType, CommandCompletion());
+        return CommandStatus::SUCCESS;
+    }
+
+    const std::shared_ptr<IAsyncCommandHandler> handler;
+};
+
+} // namespace opendnp3
+
+#endif
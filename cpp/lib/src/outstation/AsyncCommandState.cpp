@@ -0,0 +1,99 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "outstation/AsyncCommandState.h"
+
+#include <utility>
+
+namespace opendnp3
+{
+
+AsyncCommandState::AsyncCommandState(std::shared_ptr<exe4cpp::IExecutor> executor, std::function<void()> onReady)
+    : executor(std::move(executor)), onReady(std::move(onReady))
+{
+}
+
+void AsyncCommandState::Start(const ParsedRequest& request)
+{
+    this->Reset();
+
+    this->pending = true;
+    this->source = request.addresses.source;
+    this->header = request.header;
+    const auto begin = static_cast<const uint8_t*>(request.objects);
+    this->objects.assign(begin, begin + request.objects.length());
+}
+
+void AsyncCommandState::Reset()
+{
+    ++this->generation;
+    this->pending = false;
+    this->numOutstanding = 0;
+    this->statuses.clear();
+}
+
+void AsyncCommandState::Record(CommandStatus status)
+{
+    this->statuses.push_back(status);
+}
+
+CommandCompletion AsyncCommandState::Dispatch()
+{
+    const auto slot = this->statuses.size();
+    this->statuses.push_back(CommandStatus::TIMEOUT);
+    ++this->numOutstanding;
+
+    auto complete = [self = std::weak_ptr<AsyncCommandState>(shared_from_this()), executor = this->executor,
+                     generation = this->generation, slot](CommandStatus status) {
+        executor->post([self, generation, slot, status]() {
+            auto state = self.lock();
+            if (state)
+            {
+                state->OnComplete(generation, slot, status);
+            }
+        });
+    };
+
+    return CommandCompletion(complete);
+}
+
+void AsyncCommandState::Expire()
+{
+    // outstanding slots already hold TIMEOUT, just make their late completions stale
+    ++this->generation;
+    this->numOutstanding = 0;
+}
+
+void AsyncCommandState::OnComplete(uint32_t generation, size_t slot, CommandStatus status)
+{
+    if (generation != this->generation || slot >= this->statuses.size())
+    {
+        return;
+    }
+
+    this->statuses[slot] = status;
+
+    if (--this->numOutstanding == 0)
+    {
+        this->onReady();
+    }
+}
+
+} // namespace opendnp3
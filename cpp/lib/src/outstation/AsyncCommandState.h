@@ -0,0 +1,114 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_ASYNCCOMMANDSTATE_H
+#define OPENDNP3_ASYNCCOMMANDSTATE_H
+
+#include "outstation/ParsedRequest.h"
+
+#include "opendnp3/outstation/CommandCompletion.h"
+#include "opendnp3/util/Uncopyable.h"
+
+#include <exe4cpp/IExecutor.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+ * Tracks the operate request whose commands are being completed by an IAsyncCommandHandler.
+ *
+ * Completions are posted back onto the outstation's executor and only update the state if they belong to the
+ * request currently being tracked, so completions arriving after a timeout, a reset or the destruction of the
+ * outstation are harmless.
+ */
+class AsyncCommandState final : public std::enable_shared_from_this<AsyncCommandState>, private Uncopyable
+{
+
+public:
+    AsyncCommandState(std::shared_ptr<exe4cpp::IExecutor> executor, std::function<void()> onReady);
+
+    /// begin tracking a new request, copying its objects
+    void Start(const ParsedRequest& request);
+
+    /// stop tracking the current request, ignoring any outstanding completions
+    void Reset();
+
+    /// record the status of a command that was answered without being dispatched
+    void Record(CommandStatus status);
+
+    /// add an outstanding command, returning the token that completes it
+    CommandCompletion Dispatch();
+
+    /// answer the outstanding commands with TIMEOUT
+    void Expire();
+
+    bool IsPending() const
+    {
+        return this->pending;
+    }
+
+    bool IsReady() const
+    {
+        return this->pending && (this->numOutstanding == 0);
+    }
+
+    uint16_t Source() const
+    {
+        return this->source;
+    }
+
+    const APDUHeader& Header() const
+    {
+        return this->header;
+    }
+
+    ser4cpp::rseq_t Objects() const
+    {
+        return ser4cpp::rseq_t(this->objects.data(), this->objects.size());
+    }
+
+    const std::vector<CommandStatus>& Statuses() const
+    {
+        return this->statuses;
+    }
+
+private:
+    void OnComplete(uint32_t generation, size_t slot, CommandStatus status);
+
+    const std::shared_ptr<exe4cpp::IExecutor> executor;
+    const std::function<void()> onReady;
+
+    bool pending = false;
+    uint32_t generation = 0;
+    size_t numOutstanding = 0;
+
+    uint16_t source = 0;
+    APDUHeader header;
+    std::vector<uint8_t> objects;
+    std::vector<CommandStatus> statuses;
+};
+
+} // namespace opendnp3
+
+#endif
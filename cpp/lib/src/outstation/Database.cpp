@@ -58,6 +58,11 @@ template<class Spec> IINField select_indices(StaticDataMap<Spec>& map, const ICo
 
 template<class Spec> bool load_type(StaticDataMap<Spec>& map, HeaderWriter& writer)
 {
+    if (map.has_image_selection())
+    {
+        return map.load_image(writer);
+    }
+
     while (true)
     {
         auto iter = map.begin();
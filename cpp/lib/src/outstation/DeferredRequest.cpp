@@ -22,11 +22,15 @@
 namespace opendnp3
 {
 
-DeferredRequest::DeferredRequest(uint32_t maxAPDUSize) : isSet(false), buffer(maxAPDUSize) {}
+DeferredRequest::DeferredRequest(uint32_t maxAPDUSize, const std::shared_ptr<FragmentBufferPool>& pool)
+    : isSet(false), buffer(maxAPDUSize, pool)
+{
+}
 
 void DeferredRequest::Reset()
 {
     isSet = false;
+    buffer.Release();
 }
 
 bool DeferredRequest::IsSet() const
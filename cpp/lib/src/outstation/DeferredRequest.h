@@ -20,12 +20,12 @@
 #ifndef OPENDNP3_DEFERREDREQUEST_H
 #define OPENDNP3_DEFERREDREQUEST_H
 
+#include "FragmentBufferPool.h"
 #include "ParsedRequest.h"
 
+#include "opendnp3/StackStatistics.h"
 #include "opendnp3/util/Uncopyable.h"
 
-#include <ser4cpp/container/Buffer.h>
-
 namespace opendnp3
 {
 
@@ -36,7 +36,7 @@ class DeferredRequest : private Uncopyable
 {
 
 public:
-    explicit DeferredRequest(uint32_t maxAPDUSize);
+    DeferredRequest(uint32_t maxAPDUSize, const std::shared_ptr<FragmentBufferPool>& pool);
 
     void Reset();
 
@@ -48,6 +48,11 @@ public:
 
     template<class Handler> bool Process(const Handler& handler);
 
+    void RecordMemory(StackStatistics::Memory& memory) const
+    {
+        memory.Add(buffer.NumHeldBytes(), buffer.IsPooled());
+    }
+
 private:
     DeferredRequest() = delete;
 
@@ -55,7 +60,7 @@ private:
     Addresses addresses;
     APDUHeader header;
     ser4cpp::rseq_t objects;
-    ser4cpp::Buffer buffer;
+    FragmentBuffer buffer;
 };
 
 template<class Handler> bool DeferredRequest::Process(const Handler& handler)
@@ -64,6 +69,10 @@ template<class Handler> bool DeferredRequest::Process(const Handler& handler)
     {
         bool processed = handler(ParsedRequest(this->addresses, this->header, this->objects));
         isSet = !processed;
+        if (processed)
+        {
+            buffer.Release();
+        }
         return processed;
     }
     else
@@ -26,6 +26,8 @@
 #include "app/parsing/APDUParser.h"
 #include "logging/LogMacros.h"
 #include "outstation/AssignClassHandler.h"
+#include "outstation/AsyncCommandActions.h"
+#include "outstation/AsyncCommandHandlerAdapter.h"
 #include "outstation/ClassBasedRequestHandler.h"
 #include "outstation/CommandActionAdapter.h"
 #include "outstation/CommandResponseHandler.h"
@@ -49,30 +51,45 @@ OContext::OContext(const Addresses& addresses,
                    const std::shared_ptr<exe4cpp::IExecutor>& executor,
                    std::shared_ptr<ILowerLayer> lower,
                    std::shared_ptr<ICommandHandler> commandHandler,
-                   std::shared_ptr<IOutstationApplication> application)
+                   std::shared_ptr<IOutstationApplication> application,
+                   const std::shared_ptr<FragmentBufferPool>& pool,
+                   std::shared_ptr<IAsyncCommandHandler> asyncCommandHandler)
     :
 
       addresses(addresses),
       logger(logger),
       executor(executor),
       lower(std::move(lower)),
-      commandHandler(std::move(commandHandler)),
+      commandHandler(asyncCommandHandler ? std::make_shared<AsyncCommandHandlerAdapter>(asyncCommandHandler)
+                                         : std::move(commandHandler)),
       application(std::move(application)),
-      eventBuffer(config.eventBufferConfig),
+      asyncCommandHandler(std::move(asyncCommandHandler)),
+      eventBuffer(config.eventBufferConfig, config.params.useRelativeTimeEvents),
       database(db_config, eventBuffer, *this->application, config.params.typesAllowedInClass0),
       rspContext(database, eventBuffer),
       params(config.params),
       isOnline(false),
       isTransmitting(false),
       staticIIN(IINBit::DEVICE_RESTART),
-      deferred(config.params.maxRxFragSize),
+      deferred(config.params.maxRxFragSize, pool),
+      asyncCommands(this->asyncCommandHandler
+                        ? std::make_shared<AsyncCommandState>(executor, [this]() { this->CheckForTaskStart(); })
+                        : nullptr),
       sol(config.params.maxTxFragSize),
       unsol(config.params.maxTxFragSize),
       unsolRetries(config.params.numUnsolRetries),
+      unsolBatch(config.params.unsolBatchPolicy),
       shouldCheckForUnsolicited(false)
 {
 }
 
+void OContext::RecordMemory(StackStatistics::Memory& memory) const
+{
+    this->deferred.RecordMemory(memory);
+    memory.Add(this->sol.tx.Capacity(), false);
+    memory.Add(this->unsol.tx.Capacity(), false);
+}
+
 bool OContext::OnLowerLayerUp()
 {
     if (isOnline)
@@ -107,6 +124,13 @@ bool OContext::OnLowerLayerDown()
     eventBuffer.Unselect();
     rspContext.Reset();
     confirmTimer.cancel();
+    asyncCommandTimer.cancel();
+    if (asyncCommands)
+    {
+        asyncCommands->Reset();
+    }
+    unsolHoldTimer.cancel();
+    unsolBatch.Reset();
 
     return true;
 }
@@ -208,6 +232,13 @@ bool OContext::ProcessObjects(const ParsedRequest& request)
         return this->ProcessConfirm(request);
     }
 
+    // confirms keep flowing while commands complete, but the next request waits for their response
+    if (this->IsAwaitingCommands())
+    {
+        this->deferred.Set(request);
+        return true;
+    }
+
     return this->ProcessRequest(request);
 }
 
@@ -279,6 +310,7 @@ void OContext::BeginTx(uint16_t destination, const ser4cpp::rseq_t& message)
 void OContext::CheckForTaskStart()
 {
     // do these checks in order of priority
+    this->CheckForAsyncCommandResponse();
     this->CheckForDeferredRequest();
     this->CheckForUnsolicitedNull();
     if (this->shouldCheckForUnsolicited)
@@ -287,6 +319,39 @@ void OContext::CheckForTaskStart()
     }
 }
 
+void OContext::CheckForAsyncCommandResponse()
+{
+    if (!this->IsAwaitingCommands() || !this->asyncCommands->IsReady() || !this->isOnline || this->isTransmitting)
+    {
+        return;
+    }
+
+    this->asyncCommandTimer.cancel();
+
+    auto response = this->sol.tx.Start();
+    auto writer = response.GetWriter();
+    response.SetFunction(FunctionCode::RESPONSE);
+    response.SetControl(AppControlField(true, true, false, false, this->asyncCommands->Header().control.SEQ));
+
+    // parse the request again, echoing each command with the status it completed with
+    RecordedCommandAction action(this->asyncCommands->Statuses());
+    CommandResponseHandler handler(this->params.maxControlsPerRequest, &action, &writer);
+    auto result = APDUParser::Parse(this->asyncCommands->Objects(), handler, &this->logger);
+    auto iin = (result == ParseResult::OK) ? handler.Errors() : IINFromParseResult(result);
+    response.SetIIN(iin | this->GetResponseIIN());
+
+    const auto destination = this->asyncCommands->Source();
+    this->asyncCommands->Reset();
+
+    auto& next = this->BeginResponseTx(destination, response);
+
+    // like a synchronous response, one sent while waiting for an unsolicited confirm doesn't change the state
+    if (this->state->IsIdle())
+    {
+        this->state = &next;
+    }
+}
+
 void OContext::CheckForDeferredRequest()
 {
     if (this->CanTransmit() && this->deferred.IsSet())
@@ -326,14 +391,41 @@ void OContext::CheckForUnsolicited()
             // are there events to be reported?
             if (this->params.unsolClassMask.Intersects(this->eventBuffer.UnwrittenClassField()))
             {
+                Timestamp holdExpiration;
+                const auto ready = this->unsolBatch.IsReady(this->params.unsolClassMask, this->eventBuffer,
+                                                            Timestamp(this->executor->get_time()), holdExpiration);
+
+                if (!ready && (this->params.unsolBatchPolicy.maxBytes == 0 || !this->unsolBatch.ShouldEncode()))
+                {
+                    this->StartUnsolHoldTimer(holdExpiration);
+                    return;
+                }
 
                 auto response = this->unsol.tx.Start();
                 auto writer = response.GetWriter();
 
-                this->unsolRetries.Reset();
                 this->eventBuffer.Unselect();
                 this->eventBuffer.SelectAllByClass(this->params.unsolClassMask);
-                this->eventBuffer.Load(writer);
+                const auto complete = this->eventBuffer.Load(writer);
+
+                // with a byte threshold, wait until the pending events fill the batch or overflow the fragment
+                const auto numBytes = response.ToRSeq().length();
+                if (!ready && complete && numBytes < this->params.unsolBatchPolicy.maxBytes)
+                {
+                    this->unsolBatch.OnEncoded(numBytes);
+                    this->eventBuffer.Unselect();
+                    this->StartUnsolHoldTimer(holdExpiration);
+                    return;
+                }
+
+                // anything left over after a full fragment is sent without waiting again
+                if (complete)
+                {
+                    this->unsolBatch.Reset();
+                }
+
+                this->unsolHoldTimer.cancel();
+                this->unsolRetries.Reset();
 
                 build::NullUnsolicited(response, this->unsol.seq.num, this->GetResponseIIN());
                 this->RestartUnsolConfirmTimer();
@@ -391,10 +483,34 @@ void OContext::RestartUnsolConfirmTimer()
     this->confirmTimer = this->executor->start(this->params.unsolConfirmTimeout.value, timeout);
 }
 
+void OContext::StartUnsolHoldTimer(const Timestamp& expiration)
+{
+    this->unsolHoldTimer.cancel();
+
+    if (expiration.IsMax())
+    {
+        // only a count or byte threshold can release the events
+        return;
+    }
+
+    auto timeout = [&]() {
+        this->shouldCheckForUnsolicited = true;
+        this->CheckForTaskStart();
+    };
+
+    this->unsolHoldTimer = this->executor->start(expiration.value, timeout);
+}
+
 OutstationState& OContext::RespondToNonReadRequest(const ParsedRequest& request)
 {
     this->history.RecordLastProcessedRequest(request.header, request.objects);
 
+    if (this->BeginAsyncOperate(request))
+    {
+        // the response is sent by CheckForAsyncCommandResponse
+        return StateIdle::Inst();
+    }
+
     auto response = this->sol.tx.Start();
     auto writer = response.GetWriter();
     response.SetFunction(FunctionCode::RESPONSE);
@@ -434,7 +550,12 @@ OutstationState& OContext::ContinueMultiFragResponse(const Addresses& addresses,
 
 bool OContext::CanTransmit() const
 {
-    return isOnline && !isTransmitting;
+    return isOnline && !isTransmitting && !this->IsAwaitingCommands();
+}
+
+bool OContext::IsAwaitingCommands() const
+{
+    return this->asyncCommands && this->asyncCommands->IsPending();
 }
 
 IINField OContext::GetResponseIIN()
@@ -729,6 +850,75 @@ IINField OContext::HandleDirectOperate(const ser4cpp::rseq_t& objects, OperateTy
     return (result == ParseResult::OK) ? handler.Errors() : IINFromParseResult(result);
 }
 
+bool OContext::BeginAsyncOperate(const ParsedRequest& request)
+{
+    if (!this->asyncCommandHandler)
+    {
+        return false;
+    }
+
+    OperateType opType;
+    switch (request.header.function)
+    {
+    case (FunctionCode::DIRECT_OPERATE):
+        opType = OperateType::DirectOperate;
+        break;
+    case (FunctionCode::OPERATE):
+        opType = OperateType::SelectBeforeOperate;
+        break;
+    default:
+        return false;
+    }
+
+    // oversized payloads and invalid selections are answered right away by the synchronous handlers
+    if (request.objects.length() > this->sol.tx.Start().GetWriter().Remaining())
+    {
+        return false;
+    }
+
+    if (opType == OperateType::SelectBeforeOperate)
+    {
+        auto now = Timestamp(this->executor->get_time());
+        if (this->control.ValidateSelection(this->sol.seq.num, now, this->params.selectTimeout, request.objects)
+            != CommandStatus::SUCCESS)
+        {
+            return false;
+        }
+    }
+
+    this->asyncCommands->Start(request);
+
+    {
+        AsyncCommandDispatcher action(*this->asyncCommandHandler, this->database, opType, *this->asyncCommands);
+        CommandResponseHandler handler(this->params.maxControlsPerRequest, &action, nullptr);
+        APDUParser::Parse(this->asyncCommands->Objects(), handler, &this->logger);
+    }
+
+    if (this->asyncCommands->IsReady())
+    {
+        // nothing was dispatched, so the synchronous handlers produce the same response
+        this->asyncCommands->Reset();
+        return false;
+    }
+
+    this->shouldCheckForUnsolicited = true;
+
+    auto timeout = [this]() { this->OnAsyncCommandTimeout(); };
+    this->asyncCommandTimer = this->executor->start(this->params.commandResponseTimeout.value, timeout);
+
+    return true;
+}
+
+void OContext::OnAsyncCommandTimeout()
+{
+    if (this->IsAwaitingCommands() && !this->asyncCommands->IsReady())
+    {
+        SIMPLE_LOG_BLOCK(this->logger, flags::WARN, "Timeout waiting for asynchronous commands to complete");
+        this->asyncCommands->Expire();
+        this->CheckForTaskStart();
+    }
+}
+
 IINField OContext::HandleSelect(const ser4cpp::rseq_t& objects, HeaderWriter& writer)
 {
     // since we're echoing, make sure there's enough size before beginning
@@ -22,6 +22,7 @@
 
 #include "LayerInterfaces.h"
 #include "link/LinkLayerConstants.h"
+#include "outstation/AsyncCommandState.h"
 #include "outstation/ControlState.h"
 #include "outstation/Database.h"
 #include "outstation/DeferredRequest.h"
@@ -32,10 +33,12 @@
 #include "outstation/RequestHistory.h"
 #include "outstation/ResponseContext.h"
 #include "outstation/TimeSyncState.h"
+#include "outstation/UnsolicitedBatch.h"
 #include "outstation/event/EventBuffer.h"
 
 #include "opendnp3/link/Addresses.h"
 #include "opendnp3/logging/Logger.h"
+#include "opendnp3/outstation/IAsyncCommandHandler.h"
 #include "opendnp3/outstation/ICommandHandler.h"
 #include "opendnp3/outstation/IOutstationApplication.h"
 #include "opendnp3/outstation/OutstationConfig.h"
@@ -66,7 +69,12 @@ public:
              const std::shared_ptr<exe4cpp::IExecutor>& executor,
              std::shared_ptr<ILowerLayer> lower,
              std::shared_ptr<ICommandHandler> commandHandler,
-             std::shared_ptr<IOutstationApplication> application);
+             std::shared_ptr<IOutstationApplication> application,
+             const std::shared_ptr<FragmentBufferPool>& pool = nullptr,
+             std::shared_ptr<IAsyncCommandHandler> asyncCommandHandler = nullptr);
+
+    /// bytes held by the application layer buffers
+    void RecordMemory(StackStatistics::Memory& memory) const;
 
     /// ----- Implement IUpperLayer ------
 
@@ -99,6 +107,10 @@ private:
 
     OutstationState& RespondToNonReadRequest(const ParsedRequest& request);
 
+    /// Dispatches an OPERATE or DIRECT_OPERATE to the async command handler, if there is one
+    /// @return true if the response will be sent once the commands complete
+    bool BeginAsyncOperate(const ParsedRequest& request);
+
     // ---- Processing functions --------
 
     bool ProcessMessage(const Message& message);
@@ -127,6 +139,8 @@ private:
 
     void CheckForTaskStart();
 
+    void CheckForAsyncCommandResponse();
+
     void CheckForDeferredRequest();
 
     void CheckForUnsolicitedNull();
@@ -135,12 +149,18 @@ private:
 
     bool ProcessDeferredRequest(const ParsedRequest& request);
 
+    void OnAsyncCommandTimeout();
+
     void RestartSolConfirmTimer();
 
     void RestartUnsolConfirmTimer();
 
+    void StartUnsolHoldTimer(const Timestamp& expiration);
+
     bool CanTransmit() const;
 
+    bool IsAwaitingCommands() const;
+
     IINField GetResponseIIN();
 
     IINField GetDynamicIIN();
@@ -182,6 +202,7 @@ private:
     const std::shared_ptr<ILowerLayer> lower;
     const std::shared_ptr<ICommandHandler> commandHandler;
     const std::shared_ptr<IOutstationApplication> application;
+    const std::shared_ptr<IAsyncCommandHandler> asyncCommandHandler;
 
     // ------ Database, event buffer, and response tracking
     EventBuffer eventBuffer;
@@ -201,6 +222,8 @@ private:
 
     // ------ Dynamic state related to controls ------
     ControlState control;
+    const std::shared_ptr<AsyncCommandState> asyncCommands;
+    exe4cpp::Timer asyncCommandTimer;
 
     // ------ Dynamic state related to time synchronization ------
     TimeSyncState time;
@@ -209,6 +232,8 @@ private:
     OutstationSolState sol;
     OutstationUnsolState unsol;
     NumRetries unsolRetries;
+    UnsolicitedBatch unsolBatch;
+    exe4cpp::Timer unsolHoldTimer;
     bool shouldCheckForUnsolicited;
     OutstationState* state = &StateIdle::Inst();
 
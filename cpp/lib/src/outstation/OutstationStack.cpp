@@ -28,7 +28,8 @@ OutstationStack::OutstationStack(const Logger& logger,
                                  const std::shared_ptr<IOutstationApplication>& application,
                                  const std::shared_ptr<IOHandler>& iohandler,
                                  const std::shared_ptr<IResourceManager>& manager,
-                                 const OutstationStackConfig& config)
+                                 const OutstationStackConfig& config,
+                                 const std::shared_ptr<IAsyncCommandHandler>& asyncCommandHandler)
     :
 
       StackBase(logger,
@@ -37,7 +38,8 @@ OutstationStack::OutstationStack(const Logger& logger,
                 iohandler,
                 manager,
                 config.outstation.params.maxRxFragSize,
-                LinkLayerConfig(config.link, config.outstation.params.respondToAnyMaster)),
+                LinkLayerConfig(config.link, config.outstation.params.respondToAnyMaster),
+                config.outstation.params.poolFragmentBuffers ? manager->GetBufferPool() : nullptr),
       ocontext(Addresses(config.link.LocalAddr, config.link.RemoteAddr),
                config.outstation,
                config.database,
@@ -45,7 +47,10 @@ OutstationStack::OutstationStack(const Logger& logger,
                executor,
                tstack.transport,
                commandHandler,
-               application)
+               application,
+               config.outstation.params.poolFragmentBuffers ? manager->GetBufferPool() : nullptr,
+               asyncCommandHandler),
+      applyAction([](OutstationStack& stack) { stack.ApplyPendingUpdates(); })
 {
     this->tstack.transport->SetAppLayer(ocontext);
 }
@@ -69,7 +74,11 @@ void OutstationStack::Shutdown()
 
 StackStatistics OutstationStack::GetStackStatistics()
 {
-    auto get = [self = shared_from_this()] { return self->CreateStatistics(); };
+    auto get = [self = shared_from_this()] {
+        auto statistics = self->CreateStatistics();
+        self->ocontext.RecordMemory(statistics.memory);
+        return statistics;
+    };
     return this->executor->return_from<StackStatistics>(get);
 }
 
@@ -91,12 +100,32 @@ void OutstationStack::Apply(const Updates& updates)
     if (updates.IsEmpty())
         return;
 
-    auto task = [self = this->shared_from_this(), updates]() {
-        updates.Apply(self->ocontext.GetUpdateHandler());
-        self->ocontext.HandleNewEvents(); // force the outstation to check for updates
-    };
+    std::lock_guard<std::mutex> lock(this->updatesMutex);
+    this->pendingUpdates.push_back(updates);
+
+    // a pending post will pick these up too
+    if (this->pendingUpdates.size() == 1)
+    {
+        this->applyAction.Post(*this->executor, this->shared_from_this());
+    }
+}
+
+void OutstationStack::ApplyPendingUpdates()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->updatesMutex);
+        std::swap(this->pendingUpdates, this->appliedUpdates);
+    }
+
+    for (const auto& updates : this->appliedUpdates)
+    {
+        updates.Apply(this->ocontext.GetUpdateHandler());
+    }
+
+    // release the storage back to the builders before the events are handled
+    this->appliedUpdates.clear();
 
-    this->executor->post(task);
+    this->ocontext.HandleNewEvents(); // force the outstation to check for updates
 }
 
 } // namespace opendnp3
@@ -20,6 +20,7 @@
 #ifndef OPENDNP3_OUTSTATIONSTACK_H
 #define OPENDNP3_OUTSTATIONSTACK_H
 
+#include "PostedAction.h"
 #include "StackBase.h"
 #include "channel/IOHandler.h"
 #include "outstation/OutstationContext.h"
@@ -30,6 +31,9 @@
 
 #include <exe4cpp/IExecutor.h>
 
+#include <mutex>
+#include <vector>
+
 namespace opendnp3
 {
 
@@ -49,7 +53,8 @@ public:
                     const std::shared_ptr<IOutstationApplication>& application,
                     const std::shared_ptr<IOHandler>& iohandler,
                     const std::shared_ptr<IResourceManager>& manager,
-                    const OutstationStackConfig& config);
+                    const OutstationStackConfig& config,
+                    const std::shared_ptr<IAsyncCommandHandler>& asyncCommandHandler = nullptr);
 
     static std::shared_ptr<OutstationStack> Create(const Logger& logger,
                                                    const std::shared_ptr<exe4cpp::StrandExecutor>& executor,
@@ -57,10 +62,13 @@ public:
                                                    const std::shared_ptr<IOutstationApplication>& application,
                                                    const std::shared_ptr<IOHandler>& iohandler,
                                                    const std::shared_ptr<IResourceManager>& manager,
-                                                   const OutstationStackConfig& config)
+                                                   const OutstationStackConfig& config,
+                                                   const std::shared_ptr<IAsyncCommandHandler>& asyncCommandHandler
+                                                   = nullptr)
     {
-        auto ret = std::make_shared<OutstationStack>(logger, executor, commandHandler, application, iohandler, manager,
-                                                     config);
+        auto ret = std::allocate_shared<OutstationStack>(ResourceAllocator<OutstationStack>(), logger, executor,
+                                                         commandHandler, application, iohandler, manager, config,
+                                                         asyncCommandHandler);
 
         ret->tstack.link->SetRouter(*ret);
 
@@ -113,7 +121,15 @@ public:
     void Apply(const Updates& updates) final;
 
 private:
+    void ApplyPendingUpdates();
+
     OContext ocontext;
+
+    // updates applied from user threads are queued here and handed to the strand with a single post
+    std::mutex updatesMutex;
+    std::vector<Updates> pendingUpdates;
+    std::vector<Updates> appliedUpdates;
+    PostedAction<OutstationStack> applyAction;
 };
 
 } // namespace opendnp3
@@ -20,9 +20,23 @@
 #ifndef OPENDNP3_STATICDATACELL_H
 #define OPENDNP3_STATICDATACELL_H
 
+#include "app/MeasurementTypeSpecs.h"
+
+#include <cstdint>
+
 namespace opendnp3
 {
 
+// the variation a value is reported in, some values can't be represented by the requested one
+template<class Spec>
+typename Spec::static_variation_t check_for_promotion(const typename Spec::meas_t& value,
+                                                      typename Spec::static_variation_t variation)
+{
+    return variation;
+}
+
+template<> StaticBinaryVariation check_for_promotion<BinarySpec>(const Binary& value, StaticBinaryVariation variation);
+
 /**
  * Type used to record whether a value is requested in a response
  */
@@ -40,6 +54,15 @@ template<class Spec> struct SelectedValue
     typename Spec::static_variation_t variation = Spec::DefaultStaticVariation;
 };
 
+/**
+ * Location of a point's encoded value in the pre-encoded class 0 image
+ */
+struct StaticImageLocation
+{
+    uint32_t run = 0;
+    uint32_t offset = 0;
+};
+
 /**
  * Holds particular measurement type in the database.
  */
@@ -49,6 +72,7 @@ template<class Spec> struct StaticDataCell
     typename Spec::config_t config;    // configuration
     typename Spec::event_cell_t event; // event cell
     SelectedValue<Spec> selection;     // selected value
+    StaticImageLocation image;         // location in the class 0 image
 
     StaticDataCell() = default;
     StaticDataCell(const typename Spec::meas_t& value, const typename Spec::config_t& config)
@@ -54,6 +54,7 @@ bool StaticDataMap<TimeAndIntervalSpec>::update(const TimeAndInterval& value,
     }
 
     iter->second.value = value;
+    this->image.encode(iter->second);
 
     return true;
 }
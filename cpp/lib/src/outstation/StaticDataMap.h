@@ -21,9 +21,11 @@
 #define OPENDNP3_STATICDATAMAP_H
 
 #include "app/MeasurementTypeSpecs.h"
+#include "MemoryAccount.h"
 #include "app/Range.h"
 #include "outstation/IEventReceiver.h"
 #include "outstation/StaticDataCell.h"
+#include "outstation/StaticImage.h"
 
 #include "opendnp3/gen/EventMode.h"
 #include "opendnp3/util/Uncopyable.h"
@@ -36,18 +38,12 @@ namespace opendnp3
 
 bool convert_to_event_class(PointClass pc, EventClass& ec);
 
-template<class Spec>
-typename Spec::static_variation_t check_for_promotion(const typename Spec::meas_t& value,
-                                                      typename Spec::static_variation_t variation)
-{
-    return variation;
-}
-
-template<> StaticBinaryVariation check_for_promotion<BinarySpec>(const Binary& value, StaticBinaryVariation variation);
-
 template<class Spec> class StaticDataMap : private Uncopyable
 {
-    using map_t = std::map<uint16_t, StaticDataCell<Spec>>;
+    using map_t = std::map<uint16_t,
+                           StaticDataCell<Spec>,
+                           std::less<uint16_t>,
+                           ResourceAllocator<std::pair<const uint16_t, StaticDataCell<Spec>>>>;
     using map_iter_t = typename map_t::iterator;
 
 public:
@@ -117,6 +113,19 @@ public:
 
     void clear_selection();
 
+    // true if the selection is the whole map in its default variations, written from the class 0 image
+    bool has_image_selection() const
+    {
+        return this->image_selected;
+    }
+
+    bool load_image(HeaderWriter& writer)
+    {
+        const auto complete = this->image.load(writer, this->selected);
+        this->image_selected = !complete;
+        return complete;
+    }
+
     bool has_any_selection() const
     {
         return this->selected.IsValid();
@@ -127,18 +136,17 @@ public:
         return this->selected;
     }
 
-    size_t select_all()
-    {
-        return this->select_all([](auto var) { return var; }); // use the default
-    }
+    size_t select_all();
 
     size_t select_all(typename Spec::static_variation_t variation)
     {
+        this->expand_image_selection();
         return this->select_all([variation](auto var) { return variation; }); // override default
     }
 
     size_t select(Range range)
     {
+        this->expand_image_selection();
         return this->select(range, [](auto var) { return var; }); // use the default
     }
 
@@ -154,6 +162,7 @@ public:
 
     size_t select(Range range, typename Spec::static_variation_t variation)
     {
+        this->expand_image_selection();
         return this->select(range, [variation](auto var) { return variation; }); // override default
     }
 
@@ -169,8 +178,14 @@ private:
     map_t map;
     Range selected;
 
+    StaticImage<Spec> image;
+    bool image_selected = false;
+
     Range get_full_range() const;
 
+    // select the cells of an image selection so that it can be refined or iterated
+    void expand_image_selection();
+
     bool update(const map_iter_t& iter,
                 const typename Spec::meas_t& new_value,
                 EventMode mode,
@@ -191,6 +206,8 @@ template<class Spec> StaticDataMap<Spec>::StaticDataMap(const std::map<uint16_t,
     {
         this->map[item.first] = StaticDataCell<Spec>{item.second};
     }
+
+    this->image.build(this->map);
 }
 
 template<class Spec>
@@ -202,6 +219,7 @@ bool StaticDataMap<Spec>::add(const typename Spec::meas_t& value, uint16_t index
     }
 
     this->map[index] = StaticDataCell<Spec>{value, config};
+    this->image.build(this->map);
 
     return true;
 }
@@ -221,8 +239,46 @@ bool StaticDataMap<Spec>::update(const typename Spec::meas_t& value,
     return update(this->map.find(index), value, mode, receiver);
 }
 
+template<class Spec> size_t StaticDataMap<Spec>::select_all()
+{
+    if (!this->image.is_enabled())
+    {
+        return this->select_all([](auto var) { return var; }); // use the default
+    }
+
+    // every cell would be overwritten with its default variation anyway
+    this->clear_selection();
+
+    if (!this->image.select())
+    {
+        return this->select_all([](auto var) { return var; }); // some values are promoted
+    }
+
+    this->image_selected = true;
+    this->selected = this->get_full_range();
+
+    return this->map.size();
+}
+
+template<class Spec> void StaticDataMap<Spec>::expand_image_selection()
+{
+    if (this->image_selected)
+    {
+        this->image_selected = false;
+        this->select(this->selected, [](auto var) { return var; });
+    }
+}
+
 template<class Spec> void StaticDataMap<Spec>::clear_selection()
 {
+    if (this->image_selected)
+    {
+        // the cells were never selected
+        this->image_selected = false;
+        this->selected = Range::Invalid();
+        return;
+    }
+
     // the act of iterating clears the selection
     for (auto iter = this->begin(); iter != this->end(); ++iter)
     {
@@ -248,6 +304,7 @@ bool StaticDataMap<Spec>::update(const map_iter_t& iter,
     if (mode != EventMode::EventOnly)
     {
         iter->second.value = new_value;
+        this->image.encode(iter->second);
     }
 
     if (mode == EventMode::Force || mode == EventMode::EventOnly || Spec::IsEvent(iter->second.event.lastEvent, new_value, iter->second.config))
@@ -373,6 +430,8 @@ template<class Spec> Range StaticDataMap<Spec>::assign_class(PointClass clazz, c
 
 template<class Spec> typename StaticDataMap<Spec>::iterator StaticDataMap<Spec>::begin()
 {
+    this->expand_image_selection();
+
     if (!this->selected.IsValid())
     {
         return iterator(this->map.end(), this->map.end(), this->selected);
@@ -0,0 +1,196 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "StaticImage.h"
+
+#include "gen/objects/Group1.h"
+#include "gen/objects/Group10.h"
+#include "gen/objects/Group20.h"
+#include "gen/objects/Group21.h"
+#include "gen/objects/Group3.h"
+#include "gen/objects/Group30.h"
+#include "gen/objects/Group40.h"
+#include "gen/objects/Group50.h"
+
+namespace opendnp3
+{
+
+bool get_static_serializer(StaticBinaryVariation variation, DNP3Serializer<Binary>& serializer)
+{
+    switch (variation)
+    {
+    case (StaticBinaryVariation::Group1Var2):
+        serializer = Group1Var2::Inst();
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool get_static_serializer(StaticDoubleBinaryVariation variation, DNP3Serializer<DoubleBitBinary>& serializer)
+{
+    switch (variation)
+    {
+    case (StaticDoubleBinaryVariation::Group3Var2):
+        serializer = Group3Var2::Inst();
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool get_static_serializer(StaticAnalogVariation variation, DNP3Serializer<Analog>& serializer)
+{
+    switch (variation)
+    {
+    case (StaticAnalogVariation::Group30Var1):
+        serializer = Group30Var1::Inst();
+        return true;
+    case (StaticAnalogVariation::Group30Var2):
+        serializer = Group30Var2::Inst();
+        return true;
+    case (StaticAnalogVariation::Group30Var3):
+        serializer = Group30Var3::Inst();
+        return true;
+    case (StaticAnalogVariation::Group30Var4):
+        serializer = Group30Var4::Inst();
+        return true;
+    case (StaticAnalogVariation::Group30Var5):
+        serializer = Group30Var5::Inst();
+        return true;
+    case (StaticAnalogVariation::Group30Var6):
+        serializer = Group30Var6::Inst();
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool get_static_serializer(StaticCounterVariation variation, DNP3Serializer<Counter>& serializer)
+{
+    switch (variation)
+    {
+    case (StaticCounterVariation::Group20Var1):
+        serializer = Group20Var1::Inst();
+        return true;
+    case (StaticCounterVariation::Group20Var2):
+        serializer = Group20Var2::Inst();
+        return true;
+    case (StaticCounterVariation::Group20Var5):
+        serializer = Group20Var5::Inst();
+        return true;
+    case (StaticCounterVariation::Group20Var6):
+        serializer = Group20Var6::Inst();
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool get_static_serializer(StaticFrozenCounterVariation variation, DNP3Serializer<FrozenCounter>& serializer)
+{
+    switch (variation)
+    {
+    case (StaticFrozenCounterVariation::Group21Var1):
+        serializer = Group21Var1::Inst();
+        return true;
+    case (StaticFrozenCounterVariation::Group21Var2):
+        serializer = Group21Var2::Inst();
+        return true;
+    case (StaticFrozenCounterVariation::Group21Var5):
+        serializer = Group21Var5::Inst();
+        return true;
+    case (StaticFrozenCounterVariation::Group21Var6):
+        serializer = Group21Var6::Inst();
+        return true;
+    case (StaticFrozenCounterVariation::Group21Var9):
+        serializer = Group21Var9::Inst();
+        return true;
+    case (StaticFrozenCounterVariation::Group21Var10):
+        serializer = Group21Var10::Inst();
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool get_static_serializer(StaticBinaryOutputStatusVariation variation, DNP3Serializer<BinaryOutputStatus>& serializer)
+{
+    switch (variation)
+    {
+    case (StaticBinaryOutputStatusVariation::Group10Var2):
+        serializer = Group10Var2::Inst();
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool get_static_serializer(StaticAnalogOutputStatusVariation variation, DNP3Serializer<AnalogOutputStatus>& serializer)
+{
+    switch (variation)
+    {
+    case (StaticAnalogOutputStatusVariation::Group40Var1):
+        serializer = Group40Var1::Inst();
+        return true;
+    case (StaticAnalogOutputStatusVariation::Group40Var2):
+        serializer = Group40Var2::Inst();
+        return true;
+    case (StaticAnalogOutputStatusVariation::Group40Var3):
+        serializer = Group40Var3::Inst();
+        return true;
+    case (StaticAnalogOutputStatusVariation::Group40Var4):
+        serializer = Group40Var4::Inst();
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool get_static_serializer(StaticTimeAndIntervalVariation variation, DNP3Serializer<TimeAndInterval>& serializer)
+{
+    switch (variation)
+    {
+    case (StaticTimeAndIntervalVariation::Group50Var4):
+        serializer = Group50Var4::Inst();
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool get_static_serializer(StaticOctetStringVariation /*variation*/, DNP3Serializer<OctetString>& /*serializer*/)
+{
+    // the size of octet strings varies from point to point
+    return false;
+}
+
+bool get_packed_static_id(StaticBinaryVariation variation, GroupVariationID& id)
+{
+    switch (variation)
+    {
+    case (StaticBinaryVariation::Group1Var1):
+        id = Group1Var1::ID();
+        return true;
+    default:
+        return false;
+    }
+}
+
+} // namespace opendnp3
@@ -0,0 +1,278 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_STATICIMAGE_H
+#define OPENDNP3_STATICIMAGE_H
+
+#include "MemoryAccount.h"
+#include "app/DNP3Serializer.h"
+#include "app/HeaderWriter.h"
+#include "app/MeasurementTypeSpecs.h"
+#include "app/PackedBits.h"
+#include "app/Range.h"
+#include "outstation/StaticDataCell.h"
+
+#include "opendnp3/util/Uncopyable.h"
+
+#include <vector>
+
+namespace opendnp3
+{
+
+// retrieve the fixed size serializer of a static variation, returns false if the variation has none
+bool get_static_serializer(StaticBinaryVariation variation, DNP3Serializer<Binary>& serializer);
+bool get_static_serializer(StaticDoubleBinaryVariation variation, DNP3Serializer<DoubleBitBinary>& serializer);
+bool get_static_serializer(StaticAnalogVariation variation, DNP3Serializer<Analog>& serializer);
+bool get_static_serializer(StaticCounterVariation variation, DNP3Serializer<Counter>& serializer);
+bool get_static_serializer(StaticFrozenCounterVariation variation, DNP3Serializer<FrozenCounter>& serializer);
+bool get_static_serializer(StaticBinaryOutputStatusVariation variation,
+                           DNP3Serializer<BinaryOutputStatus>& serializer);
+bool get_static_serializer(StaticAnalogOutputStatusVariation variation,
+                           DNP3Serializer<AnalogOutputStatus>& serializer);
+bool get_static_serializer(StaticTimeAndIntervalVariation variation, DNP3Serializer<TimeAndInterval>& serializer);
+bool get_static_serializer(StaticOctetStringVariation variation, DNP3Serializer<OctetString>& serializer);
+
+// retrieve the object of a static variation that packs values into single bits, returns false if it isn't one
+bool get_packed_static_id(StaticBinaryVariation variation, GroupVariationID& id);
+
+template<class T> bool get_packed_static_id(T /*variation*/, GroupVariationID& /*id*/)
+{
+    return false;
+}
+
+/**
+ * Pre-encoded class 0 image of the points of a StaticDataMap.
+ *
+ * The headers of a class 0 response only depend on the point configuration, so the contiguous runs of default
+ * variations are planned once and every point keeps its encoded value at a fixed offset. Updates re-encode a
+ * single point and loading a response copies whole runs into the APDU.
+ *
+ * Packed variations keep their values in a bit array that is copied a word at a time.
+ */
+template<class Spec> class StaticImage : private Uncopyable
+{
+    using meas_t = typename Spec::meas_t;
+    using variation_t = typename Spec::static_variation_t;
+
+    struct Run
+    {
+        uint16_t start;
+        uint16_t stop;
+        variation_t variation;
+        bool packed;
+        size_t offset; // in bits for packed runs
+        GroupVariationID id;
+        DNP3Serializer<meas_t> serializer;
+    };
+
+public:
+    // plan the image of a map's cells, it stays disabled if any point has no fixed size encoding
+    template<class Cells> void build(Cells& cells);
+
+    bool is_enabled() const
+    {
+        return !this->runs.empty();
+    }
+
+    void encode(const StaticDataCell<Spec>& cell);
+
+    // snapshot the encoded values so that every fragment of a response reports the same values,
+    // returns false if some values can't be reported in their default variation
+    bool select();
+
+    // write the snapshot from the start of the selected range, returns true if it was all written
+    bool load(HeaderWriter& writer, Range& selected);
+
+private:
+    void encode_packed(const Run& run, const StaticDataCell<Spec>& cell);
+
+    template<class IndexType>
+    size_t write_run(HeaderWriter& writer, QualifierCode qc, const Run& run, uint16_t start);
+
+    static bool get_bit(const Binary& value)
+    {
+        return value.value;
+    }
+
+    template<class T> static bool get_bit(const T& /*value*/)
+    {
+        return false;
+    }
+
+    std::vector<Run, ResourceAllocator<Run>> runs;
+    size_t next_run = 0;
+
+    std::vector<uint8_t, ResourceAllocator<uint8_t>> values;
+    std::vector<uint8_t, ResourceAllocator<uint8_t>> selected_values;
+
+    PackedBits bits;
+    PackedBits selected_bits;
+    PackedBits promoted; // packed values that would be reported in another variation
+};
+
+template<class Spec> template<class Cells> void StaticImage<Spec>::build(Cells& cells)
+{
+    this->runs.clear();
+    size_t size = 0;
+    size_t num_bits = 0;
+
+    for (auto& elem : cells)
+    {
+        const auto variation = elem.second.config.svariation;
+        DNP3Serializer<meas_t> serializer;
+        GroupVariationID id;
+        const auto packed = get_packed_static_id(variation, id);
+
+        if (!packed && !get_static_serializer(variation, serializer))
+        {
+            // class 0 responses for this map are left to the regular writers
+            this->runs.clear();
+            return;
+        }
+
+        const auto offset = packed ? num_bits : size;
+
+        if (this->runs.empty() || this->runs.back().variation != variation
+            || this->runs.back().stop + 1 != elem.first)
+        {
+            this->runs.push_back(Run{elem.first, elem.first, variation, packed, offset,
+                                     packed ? id : serializer.ID(), serializer});
+        }
+        else
+        {
+            this->runs.back().stop = elem.first;
+        }
+
+        elem.second.image.run = static_cast<uint32_t>(this->runs.size() - 1);
+        elem.second.image.offset = static_cast<uint32_t>(offset);
+
+        if (packed)
+        {
+            ++num_bits;
+        }
+        else
+        {
+            size += serializer.get_size();
+        }
+    }
+
+    this->values.resize(size);
+    this->selected_values.resize(size);
+    this->bits.resize(num_bits);
+    this->selected_bits.resize(num_bits);
+    this->promoted.resize(num_bits);
+
+    for (const auto& elem : cells)
+    {
+        this->encode(elem.second);
+    }
+}
+
+template<class Spec> void StaticImage<Spec>::encode(const StaticDataCell<Spec>& cell)
+{
+    if (!this->is_enabled())
+    {
+        return;
+    }
+
+    const auto& run = this->runs[cell.image.run];
+
+    if (run.packed)
+    {
+        this->encode_packed(run, cell);
+        return;
+    }
+
+    ser4cpp::wseq_t dest(this->values.data() + cell.image.offset, run.serializer.get_size());
+    run.serializer.write(cell.value, dest);
+}
+
+template<class Spec> void StaticImage<Spec>::encode_packed(const Run& run, const StaticDataCell<Spec>& cell)
+{
+    this->bits.set(cell.image.offset, get_bit(cell.value));
+    this->promoted.set(cell.image.offset, check_for_promotion<Spec>(cell.value, run.variation) != run.variation);
+}
+
+template<class Spec> bool StaticImage<Spec>::select()
+{
+    if (this->promoted.any())
+    {
+        return false;
+    }
+
+    // same sizes, so these are plain copies
+    this->selected_values = this->values;
+    this->selected_bits = this->bits;
+    this->next_run = 0;
+    return true;
+}
+
+template<class Spec> bool StaticImage<Spec>::load(HeaderWriter& writer, Range& selected)
+{
+    while (this->next_run < this->runs.size())
+    {
+        const auto& run = this->runs[this->next_run];
+        const auto start = selected.start;
+
+        // the qualifier matches what the regular writers choose for the rest of the selection
+        const auto count = selected.IsOneByte()
+            ? this->write_run<ser4cpp::UInt8>(writer, QualifierCode::UINT8_START_STOP, run, start)
+            : this->write_run<ser4cpp::UInt16>(writer, QualifierCode::UINT16_START_STOP, run, start);
+
+        if (start + count <= run.stop)
+        {
+            // the APDU is full
+            selected.start = static_cast<uint16_t>(start + count);
+            return false;
+        }
+
+        if (++this->next_run < this->runs.size())
+        {
+            selected.start = this->runs[this->next_run].start;
+        }
+    }
+
+    selected = Range::Invalid();
+    return true;
+}
+
+template<class Spec>
+template<class IndexType>
+size_t StaticImage<Spec>::write_run(HeaderWriter& writer, QualifierCode qc, const Run& run, uint16_t start)
+{
+    const auto num = run.stop - start + 1;
+
+    if (run.packed)
+    {
+        auto iter = writer.IterateOverSingleBitfield<IndexType>(run.id, qc,
+                                                                static_cast<typename IndexType::type_t>(start));
+        return iter.Write(this->selected_bits, run.offset + (start - run.start), num);
+    }
+
+    const auto size = run.serializer.get_size();
+    const auto offset = run.offset + (start - run.start) * size;
+
+    return writer.WriteEncodedRange<IndexType>(qc, run.id,
+                                               static_cast<typename IndexType::type_t>(start), size,
+                                               ser4cpp::rseq_t(this->selected_values.data() + offset, num * size));
+}
+
+} // namespace opendnp3
+
+#endif
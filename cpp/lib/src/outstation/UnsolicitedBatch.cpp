@@ -0,0 +1,95 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "outstation/UnsolicitedBatch.h"
+
+namespace opendnp3
+{
+
+bool UnsolicitedBatch::IsReady(const ClassField& enabled, const EventBuffer& buffer, Timestamp now, Timestamp& next)
+{
+    // never hold back events that are about to be overwritten
+    bool ready = buffer.IsAnyTypeFull();
+    next = Timestamp::Max();
+    this->numPending = 0;
+
+    for (auto clazz : {EventClass::EC1, EventClass::EC2, EventClass::EC3})
+    {
+        auto& since = this->pendingSince[static_cast<uint8_t>(clazz)];
+        const auto count = enabled.HasEventType(clazz) ? buffer.NumUnwritten(clazz) : 0;
+
+        if (count == 0)
+        {
+            since = Timestamp::Min();
+            continue;
+        }
+
+        if (since.IsMin())
+        {
+            since = now;
+        }
+
+        this->numPending += count;
+
+        const auto& limits = this->policy.Get(clazz);
+        const auto expiration = since + limits.holdTime;
+
+        if ((expiration <= now) || (limits.eventCount > 0 && count >= limits.eventCount))
+        {
+            ready = true;
+        }
+        else if (expiration < next)
+        {
+            next = expiration;
+        }
+    }
+
+    return ready;
+}
+
+bool UnsolicitedBatch::ShouldEncode() const
+{
+    if (this->numEncodedEvents == 0 || this->numPending < this->numEncodedEvents)
+    {
+        return true;
+    }
+
+    const auto projected = (static_cast<uint64_t>(this->numEncodedBytes) * this->numPending) / this->numEncodedEvents;
+    return projected >= this->policy.maxBytes;
+}
+
+void UnsolicitedBatch::OnEncoded(size_t numBytes)
+{
+    this->numEncodedEvents = this->numPending;
+    this->numEncodedBytes = numBytes;
+}
+
+void UnsolicitedBatch::Reset()
+{
+    this->numPending = 0;
+    this->numEncodedEvents = 0;
+    this->numEncodedBytes = 0;
+
+    for (auto& since : this->pendingSince)
+    {
+        since = Timestamp::Min();
+    }
+}
+
+} // namespace opendnp3
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_UNSOLICITEDBATCH_H
+#define OPENDNP3_UNSOLICITEDBATCH_H
+
+#include "outstation/event/EventBuffer.h"
+
+#include "opendnp3/app/ClassField.h"
+#include "opendnp3/outstation/UnsolicitedBatchPolicy.h"
+#include "opendnp3/util/Timestamp.h"
+#include "opendnp3/util/Uncopyable.h"
+
+namespace opendnp3
+{
+
+/**
+ * Tracks how long unreported events of each class have been pending and decides
+ * when an unsolicited response should be sent according to the batch policy.
+ *
+ * The hold time of a class starts when the outstation first finds events of that
+ * class pending while it is able to report them.
+ */
+class UnsolicitedBatch : private Uncopyable
+{
+public:
+    explicit UnsolicitedBatch(const UnsolicitedBatchPolicy& policy) : policy(policy) {}
+
+    /**
+     * @param enabled classes enabled for unsolicited reporting
+     * @param buffer event buffer to inspect
+     * @param now current time
+     * @param next set to the earliest time a hold expires, or Timestamp::Max() if none is running
+     * @return true if the pending events should be reported now
+     */
+    bool IsReady(const ClassField& enabled, const EventBuffer& buffer, Timestamp now, Timestamp& next);
+
+    /**
+     * Encoding the pending events is the only exact way to evaluate the byte threshold, so
+     * the size of the last encoding is extrapolated to skip encodings that can't reach it.
+     *
+     * @return true if the pending events counted by the last call to IsReady should be encoded
+     */
+    bool ShouldEncode() const;
+
+    // record the size of the fragment the pending events encoded to
+    void OnEncoded(size_t numBytes);
+
+    // call when all pending events have been reported or the session goes offline
+    void Reset();
+
+private:
+    const UnsolicitedBatchPolicy policy;
+
+    // Timestamp::Min() when no events of the class are pending
+    Timestamp pendingSince[3];
+
+    uint32_t numPending = 0;
+    uint32_t numEncodedEvents = 0;
+    size_t numEncodedBytes = 0;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -0,0 +1,68 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "outstation/UpdateBuffer.h"
+
+namespace opendnp3
+{
+
+void UpdateBuffer::Apply(IUpdateHandler& handler) const
+{
+    for (const auto& entry : this->order)
+    {
+        switch (entry.type)
+        {
+        case (Type::Binary):
+            this->ApplyOne<Binary>(handler, entry.position);
+            break;
+        case (Type::DoubleBitBinary):
+            this->ApplyOne<DoubleBitBinary>(handler, entry.position);
+            break;
+        case (Type::Analog):
+            this->ApplyOne<Analog>(handler, entry.position);
+            break;
+        case (Type::Counter):
+            this->ApplyOne<Counter>(handler, entry.position);
+            break;
+        case (Type::BinaryOutputStatus):
+            this->ApplyOne<BinaryOutputStatus>(handler, entry.position);
+            break;
+        case (Type::AnalogOutputStatus):
+            this->ApplyOne<AnalogOutputStatus>(handler, entry.position);
+            break;
+        default:
+            this->others[entry.position](handler);
+            break;
+        }
+    }
+}
+
+void UpdateBuffer::Clear()
+{
+    this->order.clear();
+    std::get<std::vector<Value<Binary>>>(this->values).clear();
+    std::get<std::vector<Value<DoubleBitBinary>>>(this->values).clear();
+    std::get<std::vector<Value<Analog>>>(this->values).clear();
+    std::get<std::vector<Value<Counter>>>(this->values).clear();
+    std::get<std::vector<Value<BinaryOutputStatus>>>(this->values).clear();
+    std::get<std::vector<Value<AnalogOutputStatus>>>(this->values).clear();
+    this->others.clear();
+}
+
+} // namespace opendnp3
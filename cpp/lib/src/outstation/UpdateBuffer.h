@@ -0,0 +1,137 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_UPDATEBUFFER_H
+#define OPENDNP3_UPDATEBUFFER_H
+
+#include "opendnp3/outstation/IUpdateHandler.h"
+#include "opendnp3/util/Uncopyable.h"
+
+#include <cstdint>
+#include <functional>
+#include <tuple>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+ * The storage behind Updates. Measurements are kept by value in a vector per type and applied in the order
+ * they were added, so a buffer that is cleared and refilled doesn't allocate once its vectors have grown.
+ */
+class UpdateBuffer final : private Uncopyable
+{
+public:
+    using update_func_t = std::function<void(IUpdateHandler&)>;
+
+    template<class T> void Add(const T& meas, uint16_t index, EventMode mode)
+    {
+        auto& values = std::get<std::vector<Value<T>>>(this->values);
+        this->order.push_back(Entry{TypeOf<T>::value, static_cast<uint32_t>(values.size())});
+        values.push_back(Value<T>{meas, index, mode});
+    }
+
+    // updates without a measurement value
+    void Add(const update_func_t& fun)
+    {
+        this->order.push_back(Entry{Type::Other, static_cast<uint32_t>(this->others.size())});
+        this->others.push_back(fun);
+    }
+
+    void Apply(IUpdateHandler& handler) const;
+
+    bool IsEmpty() const
+    {
+        return this->order.empty();
+    }
+
+    void Clear();
+
+private:
+    enum class Type : uint8_t
+    {
+        Binary,
+        DoubleBitBinary,
+        Analog,
+        Counter,
+        BinaryOutputStatus,
+        AnalogOutputStatus,
+        Other
+    };
+
+    template<class T> struct TypeOf;
+
+    template<class T> struct Value
+    {
+        T meas;
+        uint16_t index;
+        EventMode mode;
+    };
+
+    struct Entry
+    {
+        Type type;
+        uint32_t position;
+    };
+
+    template<class T> void ApplyOne(IUpdateHandler& handler, uint32_t position) const
+    {
+        const auto& value = std::get<std::vector<Value<T>>>(this->values)[position];
+        handler.Update(value.meas, value.index, value.mode);
+    }
+
+    std::vector<Entry> order;
+    std::tuple<std::vector<Value<Binary>>,
+               std::vector<Value<DoubleBitBinary>>,
+               std::vector<Value<Analog>>,
+               std::vector<Value<Counter>>,
+               std::vector<Value<BinaryOutputStatus>>,
+               std::vector<Value<AnalogOutputStatus>>>
+        values;
+    std::vector<update_func_t> others;
+};
+
+template<> struct UpdateBuffer::TypeOf<Binary>
+{
+    static const Type value = Type::Binary;
+};
+template<> struct UpdateBuffer::TypeOf<DoubleBitBinary>
+{
+    static const Type value = Type::DoubleBitBinary;
+};
+template<> struct UpdateBuffer::TypeOf<Analog>
+{
+    static const Type value = Type::Analog;
+};
+template<> struct UpdateBuffer::TypeOf<Counter>
+{
+    static const Type value = Type::Counter;
+};
+template<> struct UpdateBuffer::TypeOf<BinaryOutputStatus>
+{
+    static const Type value = Type::BinaryOutputStatus;
+};
+template<> struct UpdateBuffer::TypeOf<AnalogOutputStatus>
+{
+    static const Type value = Type::AnalogOutputStatus;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -20,6 +20,10 @@
 
 #include "opendnp3/outstation/UpdateBuilder.h"
 
+#include "outstation/UpdateBuffer.h"
+
+#include <atomic>
+
 namespace opendnp3
 {
 
@@ -28,71 +32,90 @@ Updates UpdateBuilder::Build()
     return Updates(std::move(this->updates));
 }
 
+UpdateBuffer& UpdateBuilder::GetBuffer()
+{
+    if (this->updates)
+    {
+        return *this->updates;
+    }
+
+    for (auto& buffer : this->recycled)
+    {
+        // only this builder references the buffer, so every Updates that shared it is gone
+        if (buffer.use_count() == 1)
+        {
+            std::atomic_thread_fence(std::memory_order_acquire);
+            buffer->Clear();
+            this->updates = buffer;
+            return *this->updates;
+        }
+    }
+
+    this->updates = std::make_shared<UpdateBuffer>();
+    if (this->recycled.size() < MAX_RECYCLED_BUFFERS)
+    {
+        this->recycled.push_back(this->updates);
+    }
+    return *this->updates;
+}
+
 bool UpdateBuilder::Update(const Binary& meas, uint16_t index, EventMode mode)
 {
-    return this->AddMeas(meas, index, mode);
+    this->GetBuffer().Add(meas, index, mode);
+    return true;
 }
 
 bool UpdateBuilder::Update(const DoubleBitBinary& meas, uint16_t index, EventMode mode)
 {
-    return this->AddMeas(meas, index, mode);
+    this->GetBuffer().Add(meas, index, mode);
+    return true;
 }
 
 bool UpdateBuilder::Update(const Analog& meas, uint16_t index, EventMode mode)
 {
-    return this->AddMeas(meas, index, mode);
+    this->GetBuffer().Add(meas, index, mode);
+    return true;
 }
 
 bool UpdateBuilder::Update(const Counter& meas, uint16_t index, EventMode mode)
 {
-    return this->AddMeas(meas, index, mode);
+    this->GetBuffer().Add(meas, index, mode);
+    return true;
 }
 
 bool UpdateBuilder::FreezeCounter(uint16_t index, bool clear, EventMode mode)
 {
-    this->Add([=](IUpdateHandler& handler) { handler.FreezeCounter(index, clear, mode); });
+    this->GetBuffer().Add([=](IUpdateHandler& handler) { handler.FreezeCounter(index, clear, mode); });
     return true;
 }
 
 bool UpdateBuilder::Update(const BinaryOutputStatus& meas, uint16_t index, EventMode mode)
 {
-    return this->AddMeas(meas, index, mode);
+    this->GetBuffer().Add(meas, index, mode);
+    return true;
 }
 
 bool UpdateBuilder::Update(const AnalogOutputStatus& meas, uint16_t index, EventMode mode)
 {
-    return this->AddMeas(meas, index, mode);
+    this->GetBuffer().Add(meas, index, mode);
+    return true;
 }
 
 bool UpdateBuilder::Update(const OctetString& meas, uint16_t index, EventMode mode)
 {
-    return this->AddMeas(meas, index, mode);
+    this->GetBuffer().Add([=](IUpdateHandler& handler) { handler.Update(meas, index, mode); });
+    return true;
 }
 
 bool UpdateBuilder::Update(const TimeAndInterval& meas, uint16_t index)
 {
-    return this->Add([=](IUpdateHandler& handler) { handler.Update(meas, index); });
+    this->GetBuffer().Add([=](IUpdateHandler& handler) { handler.Update(meas, index); });
+    return true;
 }
 
 bool UpdateBuilder::Modify(FlagsType type, uint16_t start, uint16_t stop, uint8_t flags)
 {
-    return this->Add([=](IUpdateHandler& handler) { handler.Modify(type, start, stop, flags); });
-}
-
-template<class T> bool UpdateBuilder::AddMeas(const T& meas, uint16_t index, EventMode mode)
-{
-    return this->Add([=](IUpdateHandler& handler) { handler.Update(meas, index, mode); });
-}
-
-bool UpdateBuilder::Add(const update_func_t& fun)
-{
-    if (!this->updates)
-    {
-        this->updates = std::make_shared<shared_updates_t>();
-    }
-
-    updates->push_back(fun);
-
+    this->GetBuffer().Add([=](IUpdateHandler& handler) { handler.Modify(type, start, stop, flags); });
     return true;
 }
 
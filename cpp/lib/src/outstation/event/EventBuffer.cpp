@@ -24,15 +24,31 @@
 namespace opendnp3
 {
 
-EventBuffer::EventBuffer(const EventBufferConfig& config) : storage(config) {}
+EventBuffer::EventBuffer(const EventBufferConfig& config, bool useRelativeTime)
+    : useRelativeTime(useRelativeTime), storage(config)
+{
+}
 
 void EventBuffer::Update(const Event<BinarySpec>& evt)
 {
+    if (this->useRelativeTime && evt.variation == EventBinaryVariation::Group2Var2)
+    {
+        this->UpdateAny(Event<BinarySpec>(evt.value, evt.index, evt.clazz, EventBinaryVariation::Group2Var3));
+        return;
+    }
+
     this->UpdateAny(evt);
 }
 
 void EventBuffer::Update(const Event<DoubleBitBinarySpec>& evt)
 {
+    if (this->useRelativeTime && evt.variation == EventDoubleBinaryVariation::Group4Var2)
+    {
+        this->UpdateAny(
+            Event<DoubleBitBinarySpec>(evt.value, evt.index, evt.clazz, EventDoubleBinaryVariation::Group4Var3));
+        return;
+    }
+
     this->UpdateAny(evt);
 }
 
@@ -205,6 +221,16 @@ ClassField EventBuffer::UnwrittenClassField() const
                       storage.NumUnwritten(EventClass::EC3) > 0);
 }
 
+uint32_t EventBuffer::NumUnwritten(EventClass clazz) const
+{
+    return storage.NumUnwritten(clazz);
+}
+
+bool EventBuffer::IsAnyTypeFull() const
+{
+    return storage.IsAnyTypeFull();
+}
+
 bool EventBuffer::IsOverflown()
 {
     if (overflow && !this->storage.IsAnyTypeFull())
@@ -45,7 +45,7 @@ class EventBuffer final : public IEventReceiver, public IEventSelector, public I
 {
 
 public:
-    explicit EventBuffer(const EventBufferConfig& config);
+    explicit EventBuffer(const EventBufferConfig& config, bool useRelativeTime = false);
 
     // ------- IEventReceiver ------
 
@@ -78,12 +78,17 @@ public:
 
     ClassField UnwrittenClassField() const;
 
+    uint32_t NumUnwritten(EventClass clazz) const;
+
+    bool IsAnyTypeFull() const;
+
     bool IsOverflown();
 
     void SelectAllByClass(const ClassField& clazz);
 
 private:
     bool overflow = false;
+    const bool useRelativeTime;
     EventStorage storage;
 
     IINField SelectMaxCount(GroupVariation gv, uint32_t maximum);
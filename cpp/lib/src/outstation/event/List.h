@@ -20,9 +20,12 @@
 #ifndef OPENDNP3_LIST_H
 #define OPENDNP3_LIST_H
 
-#include <ser4cpp/container/Array.h>
+#include "MemoryAccount.h"
+
+#include <ser4cpp/container/HasLength.h>
 
 #include <cstdint>
+#include <vector>
 
 namespace opendnp3
 {
@@ -94,7 +97,7 @@ public:
 
     inline list_size_type_t Capacity() const
     {
-        return underlying.length();
+        return static_cast<list_size_type_t>(underlying.size());
     }
 
     inline Node<T>* Head()
@@ -124,7 +127,8 @@ private:
     Node<T>* tail = nullptr;
     Node<T>* free = nullptr;
 
-    ser4cpp::Array<Node<T>, list_size_type_t> underlying;
+    // node storage is taken from the memory resource in scope when the list is constructed
+    std::vector<Node<T>, ResourceAllocator<Node<T>>> underlying;
 
     Node<T>* Insert(const T& value, Node<T>* left, Node<T>* right);
 
@@ -249,11 +253,11 @@ template<class T> void List<T>::Link(Node<T>* first, Node<T>* second)
 
 template<class T> void List<T>::Initialize()
 {
-    if (underlying.is_empty())
+    if (underlying.empty())
         return;
 
     this->free = &underlying[0];
-    for (list_size_type_t i = 1; i < underlying.length(); ++i)
+    for (size_t i = 1; i < underlying.size(); ++i)
     {
         Link(&underlying[i - 1], &underlying[i]);
     }
@@ -29,8 +29,10 @@
 namespace opendnp3
 {
 
-TransportLayer::TransportLayer(const Logger& logger, uint32_t maxRxFragSize)
-    : logger(logger), receiver(logger, maxRxFragSize), transmitter(logger)
+TransportLayer::TransportLayer(const Logger& logger,
+                               uint32_t maxRxFragSize,
+                               const std::shared_ptr<FragmentBufferPool>& pool)
+    : logger(logger), receiver(logger, maxRxFragSize, pool), transmitter(logger)
 {
 }
 
@@ -84,6 +86,7 @@ bool TransportLayer::OnReceive(const Message& message)
         {
             upper->OnReceive(asdu);
         }
+        receiver.ReleaseBuffer();
         return true;
     }
 
@@ -132,6 +135,12 @@ StackStatistics::Transport TransportLayer::GetStatistics() const
     return StackStatistics::Transport(this->receiver.Statistics(), this->transmitter.Statistics());
 }
 
+void TransportLayer::RecordMemory(StackStatistics::Memory& memory) const
+{
+    this->receiver.RecordMemory(memory);
+    memory.Add(MAX_TPDU_LENGTH, false);
+}
+
 bool TransportLayer::OnLowerLayerUp()
 {
     if (isOnline)
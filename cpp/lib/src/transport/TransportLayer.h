@@ -40,7 +40,9 @@ class TransportLayer final : public IUpperLayer, public ILowerLayer
 {
 
 public:
-    TransportLayer(const Logger& logger, uint32_t maxRxFragSize);
+    TransportLayer(const Logger& logger,
+                   uint32_t maxRxFragSize,
+                   const std::shared_ptr<FragmentBufferPool>& pool = nullptr);
 
     // ------ ILowerLayer ------
 
@@ -59,6 +61,8 @@ public:
 
     StackStatistics::Transport GetStatistics() const;
 
+    void RecordMemory(StackStatistics::Memory& memory) const;
+
 private:
     Logger logger;
 
@@ -32,14 +32,23 @@
 namespace opendnp3
 {
 
-TransportRx::TransportRx(const Logger& logger, uint32_t maxRxFragSize)
-    : logger(logger), rxBuffer(maxRxFragSize), numBytesRead(0)
+TransportRx::TransportRx(const Logger& logger, uint32_t maxRxFragSize, const std::shared_ptr<FragmentBufferPool>& pool)
+    : logger(logger), rxBuffer(maxRxFragSize, pool), numBytesRead(0)
 {
 }
 
 void TransportRx::Reset()
 {
     this->ClearRxBuffer();
+    this->rxBuffer.Release();
+}
+
+void TransportRx::ReleaseBuffer()
+{
+    if (this->numBytesRead == 0)
+    {
+        this->rxBuffer.Release();
+    }
 }
 
 void TransportRx::ClearRxBuffer()
@@ -78,6 +87,24 @@ Message TransportRx::ProcessReceive(const Message& segment)
         // continue processing
     }
 
+    // a complete fragment in a single segment is passed up without copying it into the reassembly buffer.
+    // The payload refers to the link layer's buffer, so it's only valid until the upper layer returns.
+    if (header.fir && header.fin)
+    {
+        if (payload.length() > this->rxBuffer.length())
+        {
+            ++statistics.numTransportBufferOverflow;
+            SIMPLE_LOG_BLOCK(logger, flags::WARN, "Exceeded the buffer size before a complete fragment was read");
+            return Message();
+        }
+
+        ++statistics.numTransportZeroCopyRx;
+        this->lastAddresses = segment.addresses;
+        this->expectedSeq = header.seq;
+        this->expectedSeq.Increment();
+        return Message(segment.addresses, payload);
+    }
+
     // there are special checks we must perform if it isn't the first packet
     if (!header.fir)
     {
@@ -115,6 +142,7 @@ Message TransportRx::ProcessReceive(const Message& segment)
         ++statistics.numTransportBufferOverflow;
         SIMPLE_LOG_BLOCK(logger, flags::WARN, "Exceeded the buffer size before a complete fragment was read");
         this->numBytesRead = 0;
+        this->rxBuffer.Release();
         return Message();
     }
 
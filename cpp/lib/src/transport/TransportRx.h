@@ -20,6 +20,7 @@
 #ifndef OPENDNP3_TRANSPORTRX_H
 #define OPENDNP3_TRANSPORTRX_H
 
+#include "FragmentBufferPool.h"
 #include "app/Message.h"
 #include "transport/TransportConstants.h"
 #include "transport/TransportSeqNum.h"
@@ -27,7 +28,6 @@
 #include "opendnp3/StackStatistics.h"
 #include "opendnp3/logging/Logger.h"
 
-#include <ser4cpp/container/Buffer.h>
 #include <ser4cpp/container/SequenceTypes.h>
 
 namespace opendnp3
@@ -40,12 +40,21 @@ class TransportRx
 {
 
 public:
-    TransportRx(const Logger&, uint32_t maxRxFragSize);
+    TransportRx(const Logger&, uint32_t maxRxFragSize, const std::shared_ptr<FragmentBufferPool>& pool = nullptr);
 
     Message ProcessReceive(const Message& segment);
 
     void Reset();
 
+    /// Return the reassembly buffer to the pool unless a fragment is partially assembled.
+    /// Called once the fragment returned by ProcessReceive(..) has been consumed.
+    void ReleaseBuffer();
+
+    void RecordMemory(StackStatistics::Memory& memory) const
+    {
+        memory.Add(rxBuffer.NumHeldBytes(), rxBuffer.IsPooled());
+    }
+
     const StackStatistics::Transport::Rx& Statistics() const
     {
         return statistics;
@@ -59,7 +68,7 @@ private:
     Logger logger;
     StackStatistics::Transport::Rx statistics;
 
-    ser4cpp::Buffer rxBuffer;
+    FragmentBuffer rxBuffer;
     size_t numBytesRead;
     Addresses lastAddresses;
 
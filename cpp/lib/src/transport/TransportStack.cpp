@@ -19,6 +19,9 @@
  */
 #include "TransportStack.h"
 
+#include "MemoryAccount.h"
+#include "link/LinkLayerConstants.h"
+
 namespace opendnp3
 {
 
@@ -26,11 +29,21 @@ TransportStack::TransportStack(const Logger& logger,
                                const std::shared_ptr<exe4cpp::IExecutor>& executor,
                                const std::shared_ptr<ILinkListener>& listener,
                                uint32_t maxRxFragSize,
-                               const LinkLayerConfig& config)
-    : transport(std::make_shared<TransportLayer>(logger, maxRxFragSize)),
-      link(std::make_shared<LinkLayer>(logger, executor, transport, listener, config))
+                               const LinkLayerConfig& config,
+                               const std::shared_ptr<FragmentBufferPool>& pool)
+    : transport(
+        std::allocate_shared<TransportLayer>(ResourceAllocator<TransportLayer>(), logger, maxRxFragSize, pool)),
+      link(std::allocate_shared<LinkLayer>(
+          ResourceAllocator<LinkLayer>(), logger, executor, transport, listener, config))
 {
     transport->SetLinkLayer(*link);
 }
 
+void TransportStack::RecordMemory(StackStatistics::Memory& memory) const
+{
+    // primary and secondary link tx buffers
+    memory.Add(LPDU_MAX_FRAME_SIZE + LPDU_HEADER_SIZE, false);
+    this->transport->RecordMemory(memory);
+}
+
 } // namespace opendnp3
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "opendnp3/util/MonotonicMemoryResource.h"
+
+#include <new>
+
+namespace opendnp3
+{
+
+MonotonicMemoryResource::MonotonicMemoryResource(std::size_t capacity)
+    : capacity(capacity), block(new uint8_t[capacity])
+{
+}
+
+void* MonotonicMemoryResource::Allocate(std::size_t bytes, std::size_t alignment)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    const auto address = reinterpret_cast<std::uintptr_t>(this->block.get()) + this->offset;
+    const auto padding = (alignment - (address % alignment)) % alignment;
+
+    if (padding + bytes > this->capacity - this->offset)
+    {
+        throw std::bad_alloc();
+    }
+
+    auto ret = this->block.get() + this->offset + padding;
+    this->offset += padding + bytes;
+    return ret;
+}
+
+std::size_t MonotonicMemoryResource::NumAllocatedBytes() const
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->offset;
+}
+
+} // namespace opendnp3
@@ -64,9 +64,9 @@ Timestamp& Timestamp::operator+=(const TimeDuration& duration)
 
 Timestamp Timestamp::operator-(const TimeDuration& duration) const
 {
-    const auto maximum = value - exe4cpp::steady_time_t::min();
+    const auto minimum = exe4cpp::steady_time_t::min() + duration.value;
 
-    return duration.value >= maximum ? Timestamp::Min() : Timestamp(value - duration.value);
+    return value <= minimum ? Timestamp::Min() : Timestamp(value - duration.value);
 }
 
 Timestamp& Timestamp::operator-=(const TimeDuration& duration)
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+std::atomic<uint64_t> numAllocations{0};
+std::atomic<uint64_t> numDeallocations{0};
+
+void* Allocate(std::size_t size)
+{
+    numAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    // malloc(0) may return null, but operator new must return a unique pointer
+    auto ret = std::malloc(size ? size : 1);
+    if (!ret)
+    {
+        throw std::bad_alloc();
+    }
+    return ret;
+}
+
+void Deallocate(void* ptr)
+{
+    if (ptr)
+    {
+        numDeallocations.fetch_add(1, std::memory_order_relaxed);
+        std::free(ptr);
+    }
+}
+} // namespace
+
+uint64_t AllocationCounter::NumAllocations()
+{
+    return numAllocations.load(std::memory_order_relaxed);
+}
+
+uint64_t AllocationCounter::NumDeallocations()
+{
+    return numDeallocations.load(std::memory_order_relaxed);
+}
+
+void* operator new(std::size_t size)
+{
+    return Allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return Allocate(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return Allocate(size);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return Allocate(size);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+}
+
+void operator delete(void* ptr) noexcept
+{
+    Deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    Deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    Deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    Deallocate(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    Deallocate(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    Deallocate(ptr);
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_ALLOCATIONTESTS_ALLOCATIONCOUNTER_H
+#define OPENDNP3_ALLOCATIONTESTS_ALLOCATIONCOUNTER_H
+
+#include <cstdint>
+
+/**
+ * Counts the calls to the global operator new of the whole process, on every thread.
+ *
+ * The allocationtests target replaces the global allocation functions to do this, so the
+ * counter only exists in that executable.
+ */
+class AllocationCounter
+{
+public:
+    static uint64_t NumAllocations();
+
+    static uint64_t NumDeallocations();
+
+    // allocations since construction
+    uint64_t Count() const
+    {
+        return NumAllocations() - start;
+    }
+
+private:
+    const uint64_t start = NumAllocations();
+};
+
+#endif
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "AllocationCounter.h"
+
+#include "mocks/InProcessStackPair.h"
+
+#include <master/MasterSchedulerBackend.h>
+
+#include <catch.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+using namespace opendnp3;
+
+#define SUITE(name) "SteadyStateAllocationsTestSuite - " name
+
+// The counts include what std::function and std::deque allocate, so they are only exact for libstdc++
+#if defined(__GLIBCXX__)
+
+const uint16_t OUTSTATION_ADDRESS = 1024;
+const uint16_t NUM_POINTS_PER_TYPE = 10;
+const size_t NUM_WARMUP_ITERATIONS = 100;
+const size_t NUM_ITERATIONS = 500;
+
+// The library itself doesn't allocate in steady state, but the MockExecutor beneath it does: it creates a timer object
+// for every timer that is started, and copies the actions of expired timers when it queues and runs them.
+//
+// An unsolicited response starts the confirm timer. An integrity poll starts the response timer and the task timers of
+// the scheduler, and runs the task timer that expired.
+const uint64_t ALLOCATIONS_PER_RESPONSE = 1;
+const uint64_t ALLOCATIONS_PER_POLL = 7;
+
+// The queues of the executor and of the master are std::deque, which allocate a new block every so many elements as
+// the queue moves through memory. No single operation ever hits more than both of them at once.
+const uint64_t MAX_QUEUE_BLOCKS_PER_OPERATION = 2;
+
+// runs the operation repeatedly on the calling thread and returns the number of allocations made by each run
+std::vector<uint64_t> CountAllocations(const std::function<void()>& operation)
+{
+    for (size_t i = 0; i < NUM_WARMUP_ITERATIONS; ++i)
+    {
+        operation();
+    }
+
+    std::vector<uint64_t> counts;
+    counts.reserve(NUM_ITERATIONS);
+    for (size_t i = 0; i < NUM_ITERATIONS; ++i)
+    {
+        AllocationCounter counter;
+        operation();
+        counts.push_back(counter.Count());
+    }
+    return counts;
+}
+
+void RequireAllocationsPerOperation(const std::vector<uint64_t>& counts, uint64_t expected)
+{
+    REQUIRE(*std::min_element(counts.begin(), counts.end()) == expected);
+    REQUIRE(*std::max_element(counts.begin(), counts.end()) <= expected + MAX_QUEUE_BLOCKS_PER_OPERATION);
+}
+
+TEST_CASE(SUITE("unsolicited event reporting"))
+{
+    const uint16_t EVENTS_PER_RESPONSE = 6;
+
+    const auto executor = std::make_shared<exe4cpp::MockExecutor>();
+    const auto scheduler = std::make_shared<MasterSchedulerBackend>(executor);
+    InProcessStackPair pair(executor, scheduler, OUTSTATION_ADDRESS, NUM_POINTS_PER_TYPE, true);
+    pair.Start();
+
+    const auto start = pair.GetNumFragmentsReceived();
+
+    // the response is sent, received, confirmed and the confirm processed before run_many() returns
+    const auto counts = CountAllocations([&]() {
+        pair.UpdateValues(EVENTS_PER_RESPONSE);
+        executor->run_many();
+    });
+
+    REQUIRE(pair.GetNumFragmentsReceived() - start == NUM_WARMUP_ITERATIONS + NUM_ITERATIONS);
+    RequireAllocationsPerOperation(counts, ALLOCATIONS_PER_RESPONSE);
+
+    scheduler->Shutdown();
+}
+
+TEST_CASE(SUITE("integrity polling"))
+{
+    const auto executor = std::make_shared<exe4cpp::MockExecutor>();
+    const auto scheduler = std::make_shared<MasterSchedulerBackend>(executor);
+    InProcessStackPair pair(executor, scheduler, OUTSTATION_ADDRESS, NUM_POINTS_PER_TYPE, false);
+    pair.Start();
+    pair.AddIntegrityScan(TimeDuration::Minutes(1));
+    executor->run_many();
+
+    const auto start = pair.GetNumFragmentsReceived();
+
+    // the scan is the only timer that is pending between polls
+    const auto counts = CountAllocations([&]() {
+        executor->advance_to_next_timer();
+        executor->run_many();
+    });
+
+    REQUIRE(pair.GetNumFragmentsReceived() - start == NUM_WARMUP_ITERATIONS + NUM_ITERATIONS);
+    RequireAllocationsPerOperation(counts, ALLOCATIONS_PER_POLL);
+
+    scheduler->Shutdown();
+}
+
+#endif
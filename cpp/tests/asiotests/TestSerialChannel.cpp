@@ -0,0 +1,234 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+
+#include "channel/SerialChannel.h"
+#include "link/LinkFrame.h"
+#include "link/LinkLayerConstants.h"
+#include "mocks/MockChannelCallbacks.h"
+#include "mocks/MockIO.h"
+
+#include <ser4cpp/container/StaticBuffer.h>
+
+#include <catch.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace opendnp3;
+
+#define SUITE(name) "SerialChannelTestSuite - " name
+
+// pseudo-terminal pair, the channel opens the slave side and the test drives the master side
+class PtyPair
+{
+public:
+    PtyPair() : master(posix_openpt(O_RDWR | O_NOCTTY))
+    {
+        REQUIRE(master >= 0);
+        REQUIRE(grantpt(master) == 0);
+        REQUIRE(unlockpt(master) == 0);
+        slave_name = ptsname(master);
+    }
+
+    ~PtyPair()
+    {
+        close(master);
+    }
+
+    void Write(const ser4cpp::rseq_t& data) const
+    {
+        REQUIRE(write(master, data, data.length()) == static_cast<ssize_t>(data.length()));
+    }
+
+    // blocks until the channel has transmitted the specified number of bytes, discarding them
+    void Discard(size_t num) const
+    {
+        uint8_t data[4096];
+        while (num > 0)
+        {
+            const auto count = read(master, data, std::min(num, sizeof(data)));
+            if (count <= 0)
+                return;
+            num -= static_cast<size_t>(count);
+        }
+    }
+
+    const int master;
+    std::string slave_name;
+};
+
+struct SerialChannelTest
+{
+    explicit SerialChannelTest(const SerialSettings& input)
+        : io(MockIO::Create()),
+          channel(SerialChannel::Create(io->GetExecutor())),
+          callbacks(std::make_shared<MockChannelCallbacks>())
+    {
+        auto settings = input;
+        settings.deviceName = pty.slave_name;
+
+        std::error_code ec;
+        REQUIRE(channel->Open(settings, ec));
+        channel->SetCallbacks(callbacks);
+        channel->BeginRead(buffer.as_wseq());
+    }
+
+    ~SerialChannelTest()
+    {
+        channel->Shutdown();
+        io->RunUntilOutOfWork();
+    }
+
+    ser4cpp::rseq_t Received() const
+    {
+        return buffer.as_seq(callbacks->reads.empty() ? 0 : callbacks->reads.front());
+    }
+
+    PtyPair pty;
+    std::shared_ptr<MockIO> io;
+    std::shared_ptr<SerialChannel> channel;
+    std::shared_ptr<MockChannelCallbacks> callbacks;
+    ser4cpp::StaticBuffer<LPDU_MAX_FRAME_SIZE> buffer;
+};
+
+SerialSettings WithFrameGap(TimeDuration gap)
+{
+    SerialSettings settings;
+    settings.frameGap = gap;
+    return settings;
+}
+
+TEST_CASE(SUITE("Bytes separated by less than the frame gap are delivered in one read"))
+{
+    SerialChannelTest test(WithFrameGap(TimeDuration::Milliseconds(200)));
+
+    uint8_t data[20] = {0};
+    for (uint8_t i = 0; i < 20; ++i)
+    {
+        data[i] = i;
+    }
+
+    test.pty.Write(ser4cpp::rseq_t(data, 10));
+    test.io->io->run_for(std::chrono::milliseconds(20));
+    REQUIRE(test.callbacks->reads.empty());
+
+    test.pty.Write(ser4cpp::rseq_t(data + 10, 10));
+    test.io->RunUntilTimeout([&]() { return !test.callbacks->reads.empty(); });
+
+    REQUIRE(test.callbacks->reads.size() == 1);
+    REQUIRE(test.Received().equals(ser4cpp::rseq_t(data, 20)));
+}
+
+TEST_CASE(SUITE("Complete link frame is delivered without waiting for the frame gap"))
+{
+    SerialChannelTest test(WithFrameGap(TimeDuration::Seconds(10)));
+
+    ser4cpp::StaticBuffer<LPDU_MAX_FRAME_SIZE> txBuffer;
+    auto dest = txBuffer.as_wseq();
+    const uint8_t payload[20] = {0xC0, 0xC1, 0x01, 0x3C, 0x01, 0x06};
+    const auto frame
+        = LinkFrame::FormatUnconfirmedUserData(dest, true, 1, 1024, ser4cpp::rseq_t(payload, 20), nullptr);
+
+    test.pty.Write(frame.take(7));
+    test.io->io->run_for(std::chrono::milliseconds(20));
+    test.pty.Write(frame.skip(7));
+
+    test.io->RunUntilTimeout([&]() { return !test.callbacks->reads.empty(); });
+
+    REQUIRE(test.callbacks->reads.size() == 1);
+    REQUIRE(test.Received().equals(frame));
+}
+
+TEST_CASE(SUITE("Transmission waits for the turnaround time after the last received byte"))
+{
+    auto settings = WithFrameGap(TimeDuration::Milliseconds(10));
+    settings.txTurnaround = TimeDuration::Milliseconds(100);
+    SerialChannelTest test(settings);
+
+    // the last byte is received after this, so the write can't complete any sooner than the turnaround after it
+    const auto start = std::chrono::steady_clock::now();
+
+    const uint8_t data[4] = {0x01, 0x02, 0x03, 0x04};
+    test.pty.Write(ser4cpp::rseq_t(data, 4));
+    test.io->RunUntilTimeout([&]() { return !test.callbacks->reads.empty(); });
+
+    test.channel->BeginWrite(ser4cpp::rseq_t(data, 4));
+    test.io->RunUntilTimeout([&]() { return !test.callbacks->writes.empty(); });
+
+    REQUIRE(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(100));
+    REQUIRE(test.callbacks->writes.size() == 1);
+    REQUIRE(test.callbacks->writes.front() == 4);
+}
+
+TEST_CASE(SUITE("Frame gap that expires during a write does not abort the write"))
+{
+    SerialChannelTest test(WithFrameGap(TimeDuration::Milliseconds(20)));
+
+    // larger than the pty can buffer, so the write stays in flight until the test drains it
+    std::vector<uint8_t> tx(256 * 1024, 0xAA);
+    test.channel->BeginWrite(ser4cpp::rseq_t(tx.data(), tx.size()));
+
+    const uint8_t data[4] = {0x01, 0x02, 0x03, 0x04};
+    test.pty.Write(ser4cpp::rseq_t(data, 4));
+    test.io->io->run_for(std::chrono::milliseconds(200));
+
+    REQUIRE(test.callbacks->num_write_error == 0);
+    REQUIRE(test.callbacks->writes.empty());
+
+    std::thread reader([&]() { test.pty.Discard(tx.size()); });
+    test.io->RunUntilTimeout([&]() { return !test.callbacks->writes.empty() && !test.callbacks->reads.empty(); },
+                             std::chrono::seconds(5));
+    reader.join();
+
+    REQUIRE(test.callbacks->num_write_error == 0);
+    REQUIRE(test.callbacks->writes.size() == 1);
+    REQUIRE(test.callbacks->writes.front() == tx.size());
+    REQUIRE(test.callbacks->num_read_error == 0);
+    REQUIRE(test.callbacks->reads.size() == 1);
+    REQUIRE(test.Received().equals(ser4cpp::rseq_t(data, 4)));
+}
+
+TEST_CASE(SUITE("Shutdown completes a write held by the turnaround timer"))
+{
+    auto settings = WithFrameGap(TimeDuration::Milliseconds(10));
+    settings.txTurnaround = TimeDuration::Seconds(10);
+    SerialChannelTest test(settings);
+
+    const uint8_t data[4] = {0x01, 0x02, 0x03, 0x04};
+    test.pty.Write(ser4cpp::rseq_t(data, 4));
+    test.io->RunUntilTimeout([&]() { return !test.callbacks->reads.empty(); });
+
+    test.channel->BeginWrite(ser4cpp::rseq_t(data, 4));
+    test.channel->Shutdown();
+    test.io->RunUntilOutOfWork();
+
+    // the channel only releases its callbacks once no read or write is outstanding
+    REQUIRE(test.callbacks.use_count() == 1);
+    REQUIRE(test.callbacks->writes.empty());
+}
+
+#endif
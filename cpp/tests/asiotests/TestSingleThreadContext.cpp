@@ -0,0 +1,113 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "channel/SingleThreadContext.h"
+#include "channel/TCPSocketChannel.h"
+#include "mocks/MockIO.h"
+
+#include <catch.hpp>
+
+using namespace opendnp3;
+
+#define SUITE(name) "SingleThreadContextTestSuite - " name
+
+// records whether each completion ran inside the channel's strand
+class StrandRecordingCallbacks final : public IChannelCallbacks
+{
+public:
+    explicit StrandRecordingCallbacks(std::shared_ptr<exe4cpp::StrandExecutor> executor)
+        : executor(std::move(executor))
+    {
+    }
+
+    void OnReadComplete(const std::error_code& /*ec*/, size_t /*num*/) final
+    {
+        reads.push_back(this->executor->strand.running_in_this_thread());
+    }
+
+    void OnWriteComplete(const std::error_code& /*ec*/, size_t /*num*/) final
+    {
+        writes.push_back(this->executor->strand.running_in_this_thread());
+    }
+
+    const std::shared_ptr<exe4cpp::StrandExecutor> executor;
+    std::vector<bool> reads;
+    std::vector<bool> writes;
+};
+
+// writes a byte from one TCP channel to another and returns the callbacks of both
+std::pair<std::shared_ptr<StrandRecordingCallbacks>, std::shared_ptr<StrandRecordingCallbacks>> Exchange(MockIO& io)
+{
+    asio::ip::tcp::acceptor acceptor(*io.io, asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+    asio::ip::tcp::socket client(*io.io);
+    asio::ip::tcp::socket server(*io.io);
+    client.connect(acceptor.local_endpoint());
+    acceptor.accept(server);
+
+    auto writerExecutor = io.GetExecutor();
+    auto readerExecutor = io.GetExecutor();
+    auto writer = TCPSocketChannel::Create(writerExecutor, std::move(client));
+    auto reader = TCPSocketChannel::Create(readerExecutor, std::move(server));
+    auto writerCallbacks = std::make_shared<StrandRecordingCallbacks>(writerExecutor);
+    auto readerCallbacks = std::make_shared<StrandRecordingCallbacks>(readerExecutor);
+    writer->SetCallbacks(writerCallbacks);
+    reader->SetCallbacks(readerCallbacks);
+
+    uint8_t tx = 0xAB;
+    uint8_t rx = 0;
+    reader->BeginRead(ser4cpp::wseq_t(&rx, 1));
+    writer->BeginWrite(ser4cpp::rseq_t(&tx, 1));
+    io.RunUntilTimeout([&]() { return !readerCallbacks->reads.empty() && !writerCallbacks->writes.empty(); });
+
+    REQUIRE(rx == 0xAB);
+
+    writer->Shutdown();
+    reader->Shutdown();
+    io.RunUntilOutOfWork();
+
+    return std::make_pair(writerCallbacks, readerCallbacks);
+}
+
+TEST_CASE(SUITE("Contexts are not marked by default"))
+{
+    auto io = MockIO::Create();
+    REQUIRE_FALSE(SingleThreadContext::IsMarked(*io->GetExecutor()));
+
+    SingleThreadContext::Mark(*io->io);
+    REQUIRE(SingleThreadContext::IsMarked(*io->GetExecutor()));
+}
+
+TEST_CASE(SUITE("Channel completions run in the strand on an unmarked context"))
+{
+    auto io = MockIO::Create();
+    const auto callbacks = Exchange(*io);
+
+    REQUIRE(callbacks.first->writes == std::vector<bool>{true});
+    REQUIRE(callbacks.second->reads == std::vector<bool>{true});
+}
+
+TEST_CASE(SUITE("Channel completions bypass the strand on a marked context"))
+{
+    auto io = MockIO::Create();
+    SingleThreadContext::Mark(*io->io);
+    const auto callbacks = Exchange(*io);
+
+    REQUIRE(callbacks.first->writes == std::vector<bool>{false});
+    REQUIRE(callbacks.second->reads == std::vector<bool>{false});
+}
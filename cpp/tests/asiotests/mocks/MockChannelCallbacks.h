@@ -0,0 +1,62 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_ASIOTESTS_MOCKCHANNELCALLBACKS_H
+#define OPENDNP3_ASIOTESTS_MOCKCHANNELCALLBACKS_H
+
+#include "channel/IChannelCallbacks.h"
+
+#include <vector>
+
+class MockChannelCallbacks final : public opendnp3::IChannelCallbacks
+{
+
+public:
+    void OnReadComplete(const std::error_code& ec, size_t num) final
+    {
+        if (ec)
+        {
+            ++num_read_error;
+        }
+        else
+        {
+            reads.push_back(num);
+        }
+    }
+
+    void OnWriteComplete(const std::error_code& ec, size_t num) final
+    {
+        if (ec)
+        {
+            ++num_write_error;
+        }
+        else
+        {
+            writes.push_back(num);
+        }
+    }
+
+    size_t num_read_error = 0;
+    size_t num_write_error = 0;
+
+    std::vector<size_t> reads;
+    std::vector<size_t> writes;
+};
+
+#endif
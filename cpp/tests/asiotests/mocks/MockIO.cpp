@@ -60,7 +60,7 @@ size_t MockIO::RunUntilTimeout(const std::function<bool()>& condition, std::chro
 
         ++iterations;
 
-        this->io.reset();
+        this->io->reset();
     }
 
     return iterations;
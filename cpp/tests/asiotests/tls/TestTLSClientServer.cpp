@@ -17,10 +17,13 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include "channel/SingleThreadContext.h"
+#include "mocks/MockChannelCallbacks.h"
 #include "mocks/MockTLSPair.h"
 
 #include <catch.hpp>
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 
@@ -41,6 +44,53 @@ bool exists(const std::string& file)
     return infile.good();
 }
 
+// writes a payload in each direction across a connected pair of TLS stream channels
+void ExchangeData(const std::shared_ptr<MockIO>& io)
+{
+    TLSConfig cfg1("certs/self_signed/entity2_cert.pem", "certs/self_signed/entity1_cert.pem",
+                   "certs/self_signed/entity1_key.pem");
+    TLSConfig cfg2("certs/self_signed/entity1_cert.pem", "certs/self_signed/entity2_cert.pem",
+                   "certs/self_signed/entity2_key.pem");
+
+    MockTLSPair pair(io, 20001, cfg1, cfg2);
+
+    pair.Connect(1);
+
+    auto client = pair.GetClientChannel();
+    auto server = pair.GetServerChannel();
+    auto clientCallbacks = std::make_shared<MockChannelCallbacks>();
+    auto serverCallbacks = std::make_shared<MockChannelCallbacks>();
+    client->SetCallbacks(clientCallbacks);
+    server->SetCallbacks(serverCallbacks);
+
+    const uint8_t request[] = {0x05, 0x64, 0x05, 0xC0};
+    const uint8_t response[] = {0x05, 0x64, 0x05, 0x00, 0x01};
+    uint8_t clientRx[16] = {0};
+    uint8_t serverRx[16] = {0};
+
+    REQUIRE(server->BeginRead(ser4cpp::wseq_t(serverRx, sizeof(serverRx))));
+    REQUIRE(client->BeginRead(ser4cpp::wseq_t(clientRx, sizeof(clientRx))));
+    REQUIRE(client->BeginWrite(ser4cpp::rseq_t(request, sizeof(request))));
+    REQUIRE(server->BeginWrite(ser4cpp::rseq_t(response, sizeof(response))));
+
+    io->RunUntilTimeout([&]() {
+        return !clientCallbacks->reads.empty() && !serverCallbacks->reads.empty() && !clientCallbacks->writes.empty()
+            && !serverCallbacks->writes.empty();
+    });
+
+    REQUIRE(clientCallbacks->num_read_error == 0);
+    REQUIRE(clientCallbacks->num_write_error == 0);
+    REQUIRE(serverCallbacks->num_read_error == 0);
+    REQUIRE(serverCallbacks->num_write_error == 0);
+
+    REQUIRE(clientCallbacks->writes == std::vector<size_t>{sizeof(request)});
+    REQUIRE(serverCallbacks->writes == std::vector<size_t>{sizeof(response)});
+    REQUIRE(serverCallbacks->reads == std::vector<size_t>{sizeof(request)});
+    REQUIRE(clientCallbacks->reads == std::vector<size_t>{sizeof(response)});
+    REQUIRE(std::equal(request, request + sizeof(request), serverRx));
+    REQUIRE(std::equal(response, response + sizeof(response), clientRx));
+}
+
 TEST_CASE(SUITE("client and server can connect using self-signed certificate and peer certifcate for verification"))
 {
     const auto key1 = "certs/self_signed/entity1_key.pem";
@@ -101,3 +151,16 @@ TEST_CASE(SUITE("client and server can connect using certificates signed by comm
         iteration();
     }
 }
+
+TEST_CASE(SUITE("client and server can exchange data through the stream channels"))
+{
+    WithIO([](const std::shared_ptr<MockIO>& io) { ExchangeData(io); });
+}
+
+TEST_CASE(SUITE("client and server can exchange data through the stream channels on a single-threaded context"))
+{
+    WithIO([](const std::shared_ptr<MockIO>& io) {
+        SingleThreadContext::Mark(*io->io);
+        ExchangeData(io);
+    });
+}
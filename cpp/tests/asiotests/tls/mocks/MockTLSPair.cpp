@@ -67,3 +67,13 @@ bool MockTLSPair::NumConnectionsEqual(size_t num) const
 {
     return (this->server->channels.size() == num) && (this->chandler->channels.size() == num);
 }
+
+std::shared_ptr<IAsyncChannel> MockTLSPair::GetClientChannel(size_t index) const
+{
+    return this->chandler->channels.at(index);
+}
+
+std::shared_ptr<IAsyncChannel> MockTLSPair::GetServerChannel(size_t index) const
+{
+    return this->server->channels.at(index);
+}
@@ -44,6 +44,10 @@ public:
 
     bool NumConnectionsEqual(size_t num) const;
 
+    std::shared_ptr<opendnp3::IAsyncChannel> GetClientChannel(size_t index = 0) const;
+
+    std::shared_ptr<opendnp3::IAsyncChannel> GetServerChannel(size_t index = 0) const;
+
     MockLogHandler log;
 
 private:
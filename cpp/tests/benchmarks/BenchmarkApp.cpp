@@ -0,0 +1,99 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "BenchmarkHelpers.h"
+
+#include <app/APDUHeader.h>
+#include <gen/objects/Group30.h>
+#include <master/MeasurementHandler.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace opendnp3;
+
+namespace
+{
+
+bool WriteAnalogs(APDUResponse& response, uint16_t count)
+{
+    auto writer = response.GetWriter();
+    auto iterator = writer.IterateOverRange<ser4cpp::UInt16, Analog>(QualifierCode::UINT16_START_STOP,
+                                                                     Group30Var1::Inst(), 0);
+    for (uint16_t i = 0; i < count; ++i)
+    {
+        if (!iterator.Write(Analog(i, Flags(0x01))))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+static void BM_HeaderWriter(benchmark::State& state)
+{
+    const auto count = static_cast<uint16_t>(state.range(0));
+    std::vector<uint8_t> buffer;
+
+    for (auto _ : state)
+    {
+        auto response = MakeResponse(buffer);
+        if (!WriteAnalogs(response, count))
+        {
+            state.SkipWithError("values don't fit in the fragment");
+            break;
+        }
+        benchmark::DoNotOptimize(response.ToRSeq());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_HeaderWriter)->Arg(10)->Arg(300);
+
+static void BM_APDUParser(benchmark::State& state)
+{
+    const auto count = static_cast<uint16_t>(state.range(0));
+    std::vector<uint8_t> buffer;
+    auto response = MakeResponse(buffer);
+    WriteAnalogs(response, count);
+
+    // the object headers as the master receives them, after the response header
+    const auto objects = response.ToRSeq().skip(APDUHeader::RESPONSE_SIZE);
+    auto logger = Logger::empty();
+    DecodingSOEHandler handler;
+
+    for (auto _ : state)
+    {
+        const auto result
+            = MeasurementHandler::ProcessMeasurements(ResponseInfo(false, true, true), objects, logger, &handler);
+        if (result != ParseResult::OK)
+        {
+            state.SkipWithError("the response didn't parse");
+            break;
+        }
+    }
+
+    benchmark::DoNotOptimize(handler.sum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * objects.length()));
+}
+BENCHMARK(BM_APDUParser)->Arg(10)->Arg(300);
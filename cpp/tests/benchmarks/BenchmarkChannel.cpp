@@ -0,0 +1,118 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <channel/SingleThreadContext.h>
+#include <channel/TCPSocketChannel.h>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+using namespace opendnp3;
+
+namespace
+{
+
+// echoes every byte it reads back to the sender, or counts the echoes if it's the sender
+class Peer final : public IChannelCallbacks
+{
+public:
+    Peer(std::shared_ptr<IAsyncChannel> channel, bool echo) : channel(std::move(channel)), echo(echo) {}
+
+    void Read()
+    {
+        this->channel->BeginRead(ser4cpp::wseq_t(&this->rx, 1));
+    }
+
+    void Send()
+    {
+        this->channel->BeginWrite(ser4cpp::rseq_t(&this->tx, 1));
+    }
+
+    void OnReadComplete(const std::error_code& ec, size_t num) final
+    {
+        if (ec)
+            return;
+
+        if (this->echo)
+        {
+            this->tx = this->rx;
+            this->Send();
+        }
+        else
+        {
+            ++this->numEchoes;
+        }
+
+        this->Read();
+    }
+
+    void OnWriteComplete(const std::error_code& /*ec*/, size_t /*num*/) final {}
+
+    const std::shared_ptr<IAsyncChannel> channel;
+    const bool echo;
+    uint8_t rx = 0;
+    uint8_t tx = 0xAB;
+    size_t numEchoes = 0;
+};
+
+} // namespace
+
+// round trips of a byte between two TCP channels on an io_context run by the benchmark thread,
+// with the completion handlers dispatched through the strand (0) or directly (1)
+static void BM_ChannelRoundTrip(benchmark::State& state)
+{
+    auto io = std::make_shared<asio::io_context>(1);
+    if (state.range(0) != 0)
+    {
+        SingleThreadContext::Mark(*io);
+    }
+
+    asio::ip::tcp::acceptor acceptor(*io, asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+    asio::ip::tcp::socket client(*io);
+    asio::ip::tcp::socket server(*io);
+    client.connect(acceptor.local_endpoint());
+    acceptor.accept(server);
+
+    auto clientChannel = TCPSocketChannel::Create(exe4cpp::StrandExecutor::create(io), std::move(client));
+    auto serverChannel = TCPSocketChannel::Create(exe4cpp::StrandExecutor::create(io), std::move(server));
+    auto sender = std::make_shared<Peer>(clientChannel, false);
+    auto echoer = std::make_shared<Peer>(serverChannel, true);
+    sender->channel->SetCallbacks(sender);
+    echoer->channel->SetCallbacks(echoer);
+    sender->Read();
+    echoer->Read();
+
+    for (auto _ : state)
+    {
+        const auto expected = sender->numEchoes + 1;
+        sender->Send();
+        while (sender->numEchoes != expected || !sender->channel->CanWrite())
+        {
+            io->run_one();
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+
+    sender->channel->Shutdown();
+    echoer->channel->Shutdown();
+    io->run();
+}
+BENCHMARK(BM_ChannelRoundTrip)->Arg(0)->Arg(1);
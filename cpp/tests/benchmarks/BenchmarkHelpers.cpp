@@ -0,0 +1,52 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "BenchmarkHelpers.h"
+
+using namespace opendnp3;
+
+APDUResponse MakeResponse(std::vector<uint8_t>& buffer)
+{
+    buffer.resize(FRAGMENT_SIZE);
+    APDUResponse response(ser4cpp::wseq_t(buffer.data(), buffer.size()));
+    response.SetFunction(FunctionCode::RESPONSE);
+    response.SetControl(AppControlField(true, true, false, false, 0));
+    response.SetIIN(IINField::Empty());
+    return response;
+}
+
+std::vector<uint8_t> AnalogObjects(uint16_t count, int32_t changed, uint16_t changeEvery)
+{
+    // g30v1 with a 16-bit start/stop range
+    const uint16_t stop = count - 1;
+    std::vector<uint8_t> objects{0x1E, 0x01, 0x01, 0x00, 0x00, static_cast<uint8_t>(stop & 0xFF),
+                                 static_cast<uint8_t>(stop >> 8)};
+
+    for (uint16_t i = 0; i < count; ++i)
+    {
+        const auto value = ((i % changeEvery) == (changed % changeEvery)) ? changed + 1 : 0;
+        objects.push_back(0x01);
+        for (int shift = 0; shift < 32; shift += 8)
+        {
+            objects.push_back(static_cast<uint8_t>((value >> shift) & 0xFF));
+        }
+    }
+
+    return objects;
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_BENCHMARKS_BENCHMARKHELPERS_H
+#define OPENDNP3_BENCHMARKS_BENCHMARKHELPERS_H
+
+#include <app/APDUResponse.h>
+
+#include <opendnp3/master/ISOEHandler.h>
+
+#include <cstdint>
+#include <vector>
+
+// the default maximum fragment size of both stacks
+const size_t FRAGMENT_SIZE = 2048;
+
+// an empty solicited response of FRAGMENT_SIZE written into the buffer
+opendnp3::APDUResponse MakeResponse(std::vector<uint8_t>& buffer);
+
+// g30v1 objects of an integrity poll of 'count' analogs, where every 'changeEvery'-th point offset by 'changed' has
+// the value 'changed' + 1 and the others are 0
+std::vector<uint8_t> AnalogObjects(uint16_t count, int32_t changed, uint16_t changeEvery);
+
+// the values are only decoded when a handler visits them
+class DecodingSOEHandler final : public opendnp3::ISOEHandler
+{
+public:
+    void BeginFragment(const opendnp3::ResponseInfo& info) final {}
+    void EndFragment(const opendnp3::ResponseInfo& info) final {}
+
+    void Process(const opendnp3::HeaderInfo& info,
+                 const opendnp3::ICollection<opendnp3::Indexed<opendnp3::Analog>>& values) final
+    {
+        values.ForeachItem([this](const opendnp3::Indexed<opendnp3::Analog>& item) { this->sum += item.value.value; });
+    }
+
+    void Process(const opendnp3::HeaderInfo& info,
+                 const opendnp3::ICollection<opendnp3::Indexed<opendnp3::Binary>>& values) final
+    {
+    }
+    void Process(const opendnp3::HeaderInfo& info,
+                 const opendnp3::ICollection<opendnp3::Indexed<opendnp3::DoubleBitBinary>>& values) final
+    {
+    }
+    void Process(const opendnp3::HeaderInfo& info,
+                 const opendnp3::ICollection<opendnp3::Indexed<opendnp3::Counter>>& values) final
+    {
+    }
+    void Process(const opendnp3::HeaderInfo& info,
+                 const opendnp3::ICollection<opendnp3::Indexed<opendnp3::FrozenCounter>>& values) final
+    {
+    }
+    void Process(const opendnp3::HeaderInfo& info,
+                 const opendnp3::ICollection<opendnp3::Indexed<opendnp3::BinaryOutputStatus>>& values) final
+    {
+    }
+    void Process(const opendnp3::HeaderInfo& info,
+                 const opendnp3::ICollection<opendnp3::Indexed<opendnp3::AnalogOutputStatus>>& values) final
+    {
+    }
+    void Process(const opendnp3::HeaderInfo& info,
+                 const opendnp3::ICollection<opendnp3::Indexed<opendnp3::OctetString>>& values) final
+    {
+    }
+    void Process(const opendnp3::HeaderInfo& info,
+                 const opendnp3::ICollection<opendnp3::Indexed<opendnp3::TimeAndInterval>>& values) final
+    {
+    }
+    void Process(const opendnp3::HeaderInfo& info,
+                 const opendnp3::ICollection<opendnp3::Indexed<opendnp3::BinaryCommandEvent>>& values) final
+    {
+    }
+    void Process(const opendnp3::HeaderInfo& info,
+                 const opendnp3::ICollection<opendnp3::Indexed<opendnp3::AnalogCommandEvent>>& values) final
+    {
+    }
+    void Process(const opendnp3::HeaderInfo& info, const opendnp3::ICollection<opendnp3::DNPTime>& values) final {}
+
+    double sum = 0;
+};
+
+#endif
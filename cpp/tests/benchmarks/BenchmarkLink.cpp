@@ -0,0 +1,243 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <channel/IOHandler.h>
+#include <link/CRC.h>
+#include <link/ILinkSession.h>
+#include <link/IFrameSink.h>
+#include <link/LinkFrame.h>
+#include <link/LinkLayerConstants.h>
+#include <link/LinkLayerParser.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+using namespace opendnp3;
+
+namespace
+{
+
+class CountingFrameSink final : public IFrameSink
+{
+public:
+    bool OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata) final
+    {
+        ++numFrames;
+        return true;
+    }
+
+    size_t numFrames = 0;
+};
+
+// a stream of maximum size user data frames, as a 2048 byte fragment is sent
+std::vector<uint8_t> FormatFrames(size_t numFrames)
+{
+    uint8_t userData[LPDU_MAX_USER_DATA_SIZE];
+    std::fill(userData, userData + sizeof(userData), 0xAB);
+
+    std::vector<uint8_t> stream(numFrames * LPDU_MAX_FRAME_SIZE);
+    ser4cpp::wseq_t dest(stream.data(), stream.size());
+    size_t length = 0;
+    for (size_t i = 0; i < numFrames; ++i)
+    {
+        const auto frame = LinkFrame::FormatUnconfirmedUserData(
+            dest, true, 1024, 1, ser4cpp::rseq_t(userData, sizeof(userData)), nullptr);
+        length += frame.length();
+    }
+
+    stream.resize(length);
+    return stream;
+}
+
+class CountingSession final : public ILinkSession
+{
+public:
+    bool OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata) final
+    {
+        ++numFrames;
+        return true;
+    }
+
+    bool OnTxReady() final
+    {
+        return true;
+    }
+
+    bool OnLowerLayerUp() final
+    {
+        return true;
+    }
+
+    bool OnLowerLayerDown() final
+    {
+        return true;
+    }
+
+    size_t numFrames = 0;
+};
+
+// hands the handler's read buffer to the benchmark instead of a socket
+class ReadChannel final : public IAsyncChannel
+{
+public:
+    explicit ReadChannel(const std::shared_ptr<exe4cpp::StrandExecutor>& executor) : IAsyncChannel(executor) {}
+
+    void Complete(size_t num)
+    {
+        this->OnReadCallback(std::error_code(), num);
+    }
+
+    ser4cpp::wseq_t buffer;
+
+private:
+    void BeginReadImpl(ser4cpp::wseq_t buffer) final
+    {
+        this->buffer = buffer;
+    }
+
+    void BeginWriteImpl(const ser4cpp::rseq_t& /*buffer*/) final {}
+
+    void ShutdownImpl() final {}
+};
+
+class RoutingIOHandler final : public IOHandler
+{
+public:
+    RoutingIOHandler() : IOHandler(Logger::empty(), false, nullptr) {}
+
+    void Open(const std::shared_ptr<IAsyncChannel>& channel)
+    {
+        this->OnNewChannel(channel);
+    }
+
+private:
+    void BeginChannelAccept() final {}
+    void SuspendChannelAccept() final {}
+    void ShutdownImpl() final {}
+    void OnChannelShutdown() final {}
+};
+
+} // namespace
+
+static void BM_CRC(benchmark::State& state)
+{
+    const auto size = static_cast<size_t>(state.range(0));
+    std::vector<uint8_t> data(size, 0xAB);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(CRC::CalcCrc(data.data(), data.size()));
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+// a full data block of a link frame and a whole fragment
+BENCHMARK(BM_CRC)->Arg(16)->Arg(2048);
+
+static void BM_LinkLayerParser(benchmark::State& state)
+{
+    const auto stream = FormatFrames(static_cast<size_t>(state.range(0)));
+    LinkLayerParser parser(Logger::empty());
+    CountingFrameSink sink;
+
+    for (auto _ : state)
+    {
+        // feed the stream the way a channel does, as large as the parser's free space allows
+        size_t position = 0;
+        while (position < stream.size())
+        {
+            auto buffer = parser.WriteBuff();
+            const auto num = std::min(buffer.length(), stream.size() - position);
+            std::memcpy(buffer, stream.data() + position, num);
+            parser.OnRead(num, sink);
+            position += num;
+        }
+    }
+
+    if (sink.numFrames != state.iterations() * static_cast<size_t>(state.range(0)))
+    {
+        state.SkipWithError("frames were dropped by the parser");
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(sink.numFrames));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * stream.size()));
+}
+BENCHMARK(BM_LinkLayerParser)->Arg(1)->Arg(9);
+
+static void BM_IOHandlerRouting(benchmark::State& state)
+{
+    const auto numSessions = static_cast<uint16_t>(state.range(0));
+
+    auto handler = std::make_shared<RoutingIOHandler>();
+    std::vector<std::shared_ptr<CountingSession>> sessions;
+    for (uint16_t i = 0; i < numSessions; ++i)
+    {
+        // a master talking to many outstations behind one terminal server
+        sessions.push_back(std::make_shared<CountingSession>());
+        handler->AddContext(sessions.back(), Addresses(static_cast<uint16_t>(10 + i), 1));
+        handler->Enable(sessions.back());
+    }
+
+    auto channel = std::make_shared<ReadChannel>(exe4cpp::StrandExecutor::create(std::make_shared<asio::io_context>()));
+    handler->Open(channel);
+
+    // one short response from each outstation in turn
+    uint8_t userData[16] = {};
+    std::vector<uint8_t> stream(numSessions * LPDU_MAX_FRAME_SIZE);
+    ser4cpp::wseq_t dest(stream.data(), stream.size());
+    size_t length = 0;
+    for (uint16_t i = 0; i < numSessions; ++i)
+    {
+        length += LinkFrame::FormatUnconfirmedUserData(dest, false, 1, static_cast<uint16_t>(10 + i),
+                                                       ser4cpp::rseq_t(userData, sizeof(userData)), nullptr)
+                      .length();
+    }
+    stream.resize(length);
+
+    for (auto _ : state)
+    {
+        size_t position = 0;
+        while (position < stream.size())
+        {
+            const auto num = std::min(channel->buffer.length(), stream.size() - position);
+            std::memcpy(channel->buffer, stream.data() + position, num);
+            position += num;
+            channel->Complete(num);
+        }
+    }
+
+    size_t numFrames = 0;
+    for (const auto& session : sessions)
+    {
+        numFrames += session->numFrames;
+    }
+
+    if (numFrames != static_cast<size_t>(state.iterations()) * numSessions)
+    {
+        state.SkipWithError("frames were not routed to exactly one session");
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numSessions));
+    handler->Shutdown();
+}
+// a dedicated channel and a terminal server shared by 250 outstations
+BENCHMARK(BM_IOHandlerRouting)->Arg(1)->Arg(250);
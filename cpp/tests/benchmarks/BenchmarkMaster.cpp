@@ -0,0 +1,127 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "BenchmarkHelpers.h"
+#include "mocks/InProcessStackPair.h"
+
+#include <master/MasterSchedulerBackend.h>
+#include <master/MeasurementHandler.h>
+#include <master/ShadowSOEHandler.h>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+using namespace opendnp3;
+
+namespace
+{
+
+const uint16_t FIRST_OUTSTATION_ADDRESS = 1024;
+const uint16_t NUM_POINTS_PER_TYPE = 10;
+
+} // namespace
+
+// masters sharing one scheduler, as on a multidrop channel, all polling at the same time
+static void BM_MasterSchedulerBackend(benchmark::State& state)
+{
+    const auto numMasters = static_cast<uint16_t>(state.range(0));
+
+    const auto executor = std::make_shared<exe4cpp::MockExecutor>();
+    const auto scheduler = std::make_shared<MasterSchedulerBackend>(executor);
+
+    std::vector<std::unique_ptr<InProcessStackPair>> pairs;
+    for (uint16_t i = 0; i < numMasters; ++i)
+    {
+        pairs.emplace_back(std::make_unique<InProcessStackPair>(
+            executor, scheduler, static_cast<uint16_t>(FIRST_OUTSTATION_ADDRESS + i), NUM_POINTS_PER_TYPE, false));
+        pairs.back()->Start();
+    }
+
+    for (auto& pair : pairs)
+    {
+        pair->AddIntegrityScan(TimeDuration::Minutes(1));
+    }
+    executor->run_many();
+
+    const auto countFragments = [&pairs]() {
+        size_t count = 0;
+        for (auto& pair : pairs)
+        {
+            count += pair->GetNumFragmentsReceived();
+        }
+        return count;
+    };
+
+    const auto start = countFragments();
+
+    for (auto _ : state)
+    {
+        executor->advance_to_next_timer();
+        executor->run_many();
+    }
+
+    if (countFragments() - start < static_cast<size_t>(state.iterations()) * numMasters)
+    {
+        state.SkipWithError("not every master polled once per iteration");
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numMasters));
+    scheduler->Shutdown();
+}
+BENCHMARK(BM_MasterSchedulerBackend)->Arg(1)->Arg(10)->Arg(100);
+
+// integrity polls of 50k analogs where a different 1% changes every time, with and without the static value shadow
+static void BM_IntegrityPollShadow(benchmark::State& state)
+{
+    const uint16_t NUM_POINTS = 50000;
+    const uint16_t CHANGE_EVERY = 100;
+    const int32_t NUM_RESPONSES = 10;
+
+    const bool suppressUnchanged = state.range(0) != 0;
+
+    // consecutive responses differ in the points that changed in either of them, 2% of the total
+    std::vector<std::vector<uint8_t>> responses;
+    for (int32_t i = 0; i < NUM_RESPONSES; ++i)
+    {
+        responses.push_back(AnalogObjects(NUM_POINTS, i, CHANGE_EVERY));
+    }
+
+    const auto handler = std::make_shared<DecodingSOEHandler>();
+    ShadowSOEHandler shadow(std::make_shared<StaticShadowTable>(), handler);
+    ISOEHandler* target = suppressUnchanged ? static_cast<ISOEHandler*>(&shadow) : handler.get();
+    auto logger = Logger::empty();
+
+    size_t poll = 0;
+    for (auto _ : state)
+    {
+        const auto& objects = responses[poll++ % responses.size()];
+        const auto result = MeasurementHandler::ProcessMeasurements(
+            ResponseInfo(false, true, true), ser4cpp::rseq_t(objects.data(), objects.size()), logger, target);
+        if (result != ParseResult::OK)
+        {
+            state.SkipWithError("the response didn't parse");
+            break;
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NUM_POINTS));
+}
+BENCHMARK(BM_IntegrityPollShadow)->ArgName("shadow")->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
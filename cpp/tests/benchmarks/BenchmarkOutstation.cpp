@@ -0,0 +1,286 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "BenchmarkHelpers.h"
+
+#include <app/OctetStringPool.h>
+#include <outstation/Database.h>
+#include <outstation/IEventReceiver.h>
+#include <outstation/event/ASDUEventWriteHandler.h>
+#include <outstation/event/EventStorage.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <vector>
+
+using namespace opendnp3;
+
+namespace
+{
+
+class CountingEventReceiver final : public IEventReceiver
+{
+public:
+    void Update(const Event<BinarySpec>& evt) final
+    {
+        ++numEvents;
+    }
+    void Update(const Event<DoubleBitBinarySpec>& evt) final
+    {
+        ++numEvents;
+    }
+    void Update(const Event<AnalogSpec>& evt) final
+    {
+        ++numEvents;
+    }
+    void Update(const Event<CounterSpec>& evt) final
+    {
+        ++numEvents;
+    }
+    void Update(const Event<FrozenCounterSpec>& evt) final
+    {
+        ++numEvents;
+    }
+    void Update(const Event<BinaryOutputStatusSpec>& evt) final
+    {
+        ++numEvents;
+    }
+    void Update(const Event<AnalogOutputStatusSpec>& evt) final
+    {
+        ++numEvents;
+    }
+    void Update(const Event<OctetStringSpec>& evt) final
+    {
+        ++numEvents;
+    }
+
+    size_t numEvents = 0;
+};
+
+} // namespace
+
+static void BM_DatabaseUpdate(benchmark::State& state)
+{
+    const auto numPoints = static_cast<uint16_t>(state.range(0));
+    const auto isEvent = state.range(1) != 0;
+
+    CountingEventReceiver receiver;
+    IDnpTimeSource timeSource;
+    Database database(DatabaseConfig(numPoints), receiver, timeSource, StaticTypeBitField::AllTypes());
+
+    uint16_t index = 0;
+    double value = 0;
+    for (auto _ : state)
+    {
+        // with a deadband of zero any change is an event, an unchanged value only updates the static value
+        database.Update(Analog(isEvent ? ++value : value), index, EventMode::Detect);
+        index = (index + 1) % numPoints;
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    state.counters["events"]
+        = benchmark::Counter(static_cast<double>(receiver.numEvents), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_DatabaseUpdate)->ArgNames({"points", "event"})->Args({100, 0})->Args({100, 1});
+
+static void BM_StaticResponse(benchmark::State& state)
+{
+    const auto numPoints = static_cast<uint16_t>(state.range(0));
+
+    CountingEventReceiver receiver;
+    IDnpTimeSource timeSource;
+    Database database(DatabaseConfig(numPoints), receiver, timeSource, StaticTypeBitField::AllTypes());
+    std::vector<uint8_t> buffer;
+    size_t numFragments = 0;
+
+    for (auto _ : state)
+    {
+        // a class 0 poll, split across as many fragments as it takes
+        database.SelectAll(GroupVariation::Group60Var1);
+        bool complete = false;
+        while (!complete)
+        {
+            auto response = MakeResponse(buffer);
+            auto writer = response.GetWriter();
+            complete = database.Load(writer);
+            ++numFragments;
+            benchmark::DoNotOptimize(response.ToRSeq());
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numPoints));
+    state.counters["fragments"]
+        = benchmark::Counter(static_cast<double>(numFragments), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_StaticResponse)->Arg(10)->Arg(100);
+
+static void BM_Class0Image(benchmark::State& state)
+{
+    const auto numPoints = static_cast<uint16_t>(state.range(0));
+    const auto useImage = state.range(1) != 0;
+
+    DatabaseConfig config;
+    for (uint16_t i = 0; i < numPoints; ++i)
+    {
+        config.analog_input[i] = AnalogConfig();
+    }
+
+    CountingEventReceiver receiver;
+    IDnpTimeSource timeSource;
+    Database database(config, receiver, timeSource, StaticTypeBitField::AllTypes());
+    std::vector<uint8_t> buffer;
+    size_t numFragments = 0;
+
+    for (auto _ : state)
+    {
+        // class 0 is copied from the pre-encoded image, 30/1 produces the same bytes via the regular writers
+        database.SelectAll(useImage ? GroupVariation::Group60Var1 : GroupVariation::Group30Var1);
+        bool complete = false;
+        while (!complete)
+        {
+            auto response = MakeResponse(buffer);
+            auto writer = response.GetWriter();
+            complete = database.Load(writer);
+            ++numFragments;
+            benchmark::DoNotOptimize(response.ToRSeq());
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numPoints));
+    state.counters["fragments"]
+        = benchmark::Counter(static_cast<double>(numFragments), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_Class0Image)->ArgNames({"points", "image"})->Args({1000, 0})->Args({1000, 1});
+
+static void BM_PackedBinaryResponse(benchmark::State& state)
+{
+    // the most binaries a database can index
+    const uint16_t numPoints = 65535;
+    const auto usePackedImage = state.range(0) != 0;
+
+    DatabaseConfig config;
+    for (uint16_t i = 0; i < numPoints; ++i)
+    {
+        config.binary_input[i].svariation = StaticBinaryVariation::Group1Var1;
+    }
+
+    CountingEventReceiver receiver;
+    IDnpTimeSource timeSource;
+    Database database(config, receiver, timeSource, StaticTypeBitField::AllTypes());
+    for (uint16_t i = 0; i < numPoints; ++i)
+    {
+        database.Update(Binary((i % 3) == 0, Flags(0x01)), i, EventMode::Suppress);
+    }
+
+    std::vector<uint8_t> buffer;
+    size_t numFragments = 0;
+
+    for (auto _ : state)
+    {
+        // class 0 is copied from the packed image, 1/1 produces the same bytes via the regular writers
+        database.SelectAll(usePackedImage ? GroupVariation::Group60Var1 : GroupVariation::Group1Var1);
+        bool complete = false;
+        while (!complete)
+        {
+            auto response = MakeResponse(buffer);
+            auto writer = response.GetWriter();
+            complete = database.Load(writer);
+            ++numFragments;
+            benchmark::DoNotOptimize(response.ToRSeq());
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numPoints));
+    state.counters["fragments"]
+        = benchmark::Counter(static_cast<double>(numFragments), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_PackedBinaryResponse)->ArgName("image")->Arg(0)->Arg(1);
+
+static void BM_EventStorage(benchmark::State& state)
+{
+    const auto numEvents = static_cast<uint16_t>(state.range(0));
+
+    EventStorage storage(EventBufferConfig::AllTypes(numEvents));
+    std::vector<uint8_t> buffer;
+    uint32_t numWritten = 0;
+
+    for (auto _ : state)
+    {
+        for (uint16_t i = 0; i < numEvents; ++i)
+        {
+            storage.Update(Event<AnalogSpec>(Analog(i), i, EventClass::EC1, EventAnalogVariation::Group32Var1));
+        }
+
+        storage.SelectByClass(EventClass::EC1);
+
+        // events that don't fit in a fragment stay selected for the next one
+        while (storage.NumSelected() > 0)
+        {
+            auto response = MakeResponse(buffer);
+            auto writer = response.GetWriter();
+            ASDUEventWriteHandler handler(writer);
+            numWritten += storage.Write(handler);
+            storage.ClearWritten();
+        }
+    }
+
+    if (numWritten != state.iterations() * numEvents)
+    {
+        state.SkipWithError("events were not written");
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(numWritten));
+}
+BENCHMARK(BM_EventStorage)->Arg(10)->Arg(1000);
+
+static void BM_OctetStringMemory(benchmark::State& state)
+{
+    const auto numPoints = static_cast<uint16_t>(state.range(0));
+    const auto usedBefore = OctetStringPool::NumUsedBytes();
+
+    DatabaseConfig config;
+    for (uint16_t i = 0; i < numPoints; ++i)
+    {
+        config.octet_string[i] = OctetStringConfig();
+    }
+
+    CountingEventReceiver receiver;
+    IDnpTimeSource timeSource;
+    Database database(config, receiver, timeSource, StaticTypeBitField::AllTypes());
+
+    uint32_t count = 0;
+    char text[9];
+    for (auto _ : state)
+    {
+        // a short device status string that changes with every update
+        for (uint16_t i = 0; i < numPoints; ++i)
+        {
+            std::snprintf(text, sizeof(text), "%08X", count++);
+            database.Update(OctetString(text), i, EventMode::Detect);
+        }
+    }
+
+    const auto pooled = static_cast<double>(OctetStringPool::NumUsedBytes() - usedBefore);
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numPoints));
+    state.counters["cell_bytes"] = static_cast<double>(sizeof(StaticDataCell<OctetStringSpec>));
+    state.counters["pooled_bytes_per_string"] = pooled / numPoints;
+}
+BENCHMARK(BM_OctetStringMemory)->Arg(10000);
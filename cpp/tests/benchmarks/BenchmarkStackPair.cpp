@@ -0,0 +1,128 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "mocks/InProcessStackPair.h"
+
+#include <master/MasterSchedulerBackend.h>
+
+#include <benchmark/benchmark.h>
+
+using namespace opendnp3;
+
+namespace
+{
+
+const uint16_t OUTSTATION_ADDRESS = 1024;
+
+} // namespace
+
+static void BM_UnsolicitedEvents(benchmark::State& state)
+{
+    const auto numEvents = static_cast<uint16_t>(state.range(0));
+
+    const auto executor = std::make_shared<exe4cpp::MockExecutor>();
+    const auto scheduler = std::make_shared<MasterSchedulerBackend>(executor);
+    InProcessStackPair pair(executor, scheduler, OUTSTATION_ADDRESS, numEvents, true);
+    pair.Start();
+
+    const auto start = pair.GetNumFragmentsReceived();
+
+    for (auto _ : state)
+    {
+        // the response is sent, received, confirmed and the confirm processed before run_many() returns
+        pair.UpdateValues(numEvents);
+        executor->run_many();
+    }
+
+    if (pair.GetNumFragmentsReceived() - start != static_cast<size_t>(state.iterations()))
+    {
+        state.SkipWithError("events were not reported as one unsolicited response each");
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numEvents));
+    scheduler->Shutdown();
+}
+BENCHMARK(BM_UnsolicitedEvents)->Arg(1)->Arg(100);
+
+static void BM_IntegrityPoll(benchmark::State& state)
+{
+    const auto numPointsPerType = static_cast<uint16_t>(state.range(0));
+
+    const auto executor = std::make_shared<exe4cpp::MockExecutor>();
+    const auto scheduler = std::make_shared<MasterSchedulerBackend>(executor);
+    InProcessStackPair pair(executor, scheduler, OUTSTATION_ADDRESS, numPointsPerType, false);
+    pair.Start();
+    pair.AddIntegrityScan(TimeDuration::Minutes(1));
+    executor->run_many();
+
+    const auto start = pair.GetNumFragmentsReceived();
+
+    for (auto _ : state)
+    {
+        // the scan is the only timer that is pending between polls
+        executor->advance_to_next_timer();
+        executor->run_many();
+    }
+
+    const auto numFragments = pair.GetNumFragmentsReceived() - start;
+    if (numFragments < static_cast<size_t>(state.iterations()))
+    {
+        state.SkipWithError("the scan didn't run once per iteration");
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numPointsPerType));
+    state.counters["fragments"]
+        = benchmark::Counter(static_cast<double>(numFragments), benchmark::Counter::kAvgIterations);
+    scheduler->Shutdown();
+}
+BENCHMARK(BM_IntegrityPoll)->Arg(10)->Arg(100);
+
+static void BM_LargeIntegrityPoll(benchmark::State& state)
+{
+    // ~100k points spread across the 9 static types of the database
+    const uint16_t numPointsPerType = 11112;
+    const auto maxFragSize = static_cast<uint32_t>(state.range(0));
+
+    const auto executor = std::make_shared<exe4cpp::MockExecutor>();
+    const auto scheduler = std::make_shared<MasterSchedulerBackend>(executor);
+    InProcessStackPair pair(executor, scheduler, OUTSTATION_ADDRESS, numPointsPerType, false, maxFragSize);
+    pair.Start();
+    pair.AddIntegrityScan(TimeDuration::Minutes(1));
+    executor->run_many();
+
+    const auto start = pair.GetNumFragmentsReceived();
+
+    for (auto _ : state)
+    {
+        executor->advance_to_next_timer();
+        executor->run_many();
+    }
+
+    const auto numFragments = pair.GetNumFragmentsReceived() - start;
+    if (numFragments < static_cast<size_t>(state.iterations()))
+    {
+        state.SkipWithError("the scan didn't run once per iteration");
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numPointsPerType * 9));
+    state.counters["fragments"]
+        = benchmark::Counter(static_cast<double>(numFragments), benchmark::Counter::kAvgIterations);
+    scheduler->Shutdown();
+}
+BENCHMARK(BM_LargeIntegrityPoll)->ArgName("fragment")->Arg(2048)->Arg(65536)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <transport/TransportRx.h>
+#include <transport/TransportTx.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace opendnp3;
+
+namespace
+{
+
+const Addresses ADDRESSES(1, 1024);
+
+std::vector<uint8_t> MakeFragment(size_t size)
+{
+    std::vector<uint8_t> fragment(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        fragment[i] = static_cast<uint8_t>(i);
+    }
+    return fragment;
+}
+
+} // namespace
+
+static void BM_TransportTx(benchmark::State& state)
+{
+    const auto fragment = MakeFragment(static_cast<size_t>(state.range(0)));
+    TransportTx tx(Logger::empty());
+    size_t numSegments = 0;
+
+    for (auto _ : state)
+    {
+        tx.Configure(Message(ADDRESSES, ser4cpp::rseq_t(fragment.data(), fragment.size())));
+        while (tx.HasValue())
+        {
+            benchmark::DoNotOptimize(tx.GetSegment());
+            tx.Advance();
+            ++numSegments;
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(numSegments));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * fragment.size()));
+}
+BENCHMARK(BM_TransportTx)->Arg(249)->Arg(2048);
+
+static void BM_TransportRx(benchmark::State& state)
+{
+    const auto fragment = MakeFragment(static_cast<size_t>(state.range(0)));
+
+    // segment the fragment once up front, only reassembly is measured
+    std::vector<std::vector<uint8_t>> segments;
+    TransportTx tx(Logger::empty());
+    tx.Configure(Message(ADDRESSES, ser4cpp::rseq_t(fragment.data(), fragment.size())));
+    while (tx.HasValue())
+    {
+        const auto segment = tx.GetSegment();
+        const auto begin = static_cast<const uint8_t*>(segment);
+        segments.emplace_back(begin, begin + segment.length());
+        tx.Advance();
+    }
+
+    TransportRx rx(Logger::empty(), static_cast<uint32_t>(fragment.size()));
+    size_t numFragments = 0;
+
+    for (auto _ : state)
+    {
+        for (const auto& segment : segments)
+        {
+            const auto message = rx.ProcessReceive(Message(ADDRESSES, ser4cpp::rseq_t(segment.data(), segment.size())));
+            if (message.payload.is_not_empty())
+            {
+                ++numFragments;
+                rx.ReleaseBuffer();
+            }
+        }
+    }
+
+    if (numFragments != static_cast<size_t>(state.iterations()))
+    {
+        state.SkipWithError("fragments were not reassembled");
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * segments.size()));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * fragment.size()));
+}
+BENCHMARK(BM_TransportRx)->Arg(249)->Arg(2048);
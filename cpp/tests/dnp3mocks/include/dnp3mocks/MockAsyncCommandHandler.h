@@ -0,0 +1,136 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_UNITTESTS_MOCK_ASYNC_COMMAND_HANDLER_H
+#define OPENDNP3_UNITTESTS_MOCK_ASYNC_COMMAND_HANDLER_H
+
+#include <opendnp3/outstation/IAsyncCommandHandler.h>
+
+#include <vector>
+
+class MockAsyncCommandHandler final : public opendnp3::IAsyncCommandHandler
+{
+public:
+    struct PendingOperate
+    {
+        uint16_t index;
+        opendnp3::OperateType opType;
+        opendnp3::CommandCompletion completion;
+    };
+
+    void Begin() override
+    {
+        ++numBegin;
+    }
+
+    void End() override
+    {
+        ++numEnd;
+    }
+
+    opendnp3::CommandStatus Select(const opendnp3::ControlRelayOutputBlock& command, uint16_t index) override
+    {
+        return this->DoSelect();
+    }
+
+    void Operate(const opendnp3::ControlRelayOutputBlock& command,
+                 uint16_t index,
+                 opendnp3::IUpdateHandler& handler,
+                 opendnp3::OperateType opType,
+                 const opendnp3::CommandCompletion& completion) override
+    {
+        this->DoOperate(index, opType, completion);
+    }
+
+    opendnp3::CommandStatus Select(const opendnp3::AnalogOutputInt16& command, uint16_t index) override
+    {
+        return this->DoSelect();
+    }
+
+    void Operate(const opendnp3::AnalogOutputInt16& command,
+                 uint16_t index,
+                 opendnp3::IUpdateHandler& handler,
+                 opendnp3::OperateType opType,
+                 const opendnp3::CommandCompletion& completion) override
+    {
+        this->DoOperate(index, opType, completion);
+    }
+
+    opendnp3::CommandStatus Select(const opendnp3::AnalogOutputInt32& command, uint16_t index) override
+    {
+        return this->DoSelect();
+    }
+
+    void Operate(const opendnp3::AnalogOutputInt32& command,
+                 uint16_t index,
+                 opendnp3::IUpdateHandler& handler,
+                 opendnp3::OperateType opType,
+                 const opendnp3::CommandCompletion& completion) override
+    {
+        this->DoOperate(index, opType, completion);
+    }
+
+    opendnp3::CommandStatus Select(const opendnp3::AnalogOutputFloat32& command, uint16_t index) override
+    {
+        return this->DoSelect();
+    }
+
+    void Operate(const opendnp3::AnalogOutputFloat32& command,
+                 uint16_t index,
+                 opendnp3::IUpdateHandler& handler,
+                 opendnp3::OperateType opType,
+                 const opendnp3::CommandCompletion& completion) override
+    {
+        this->DoOperate(index, opType, completion);
+    }
+
+    opendnp3::CommandStatus Select(const opendnp3::AnalogOutputDouble64& command, uint16_t index) override
+    {
+        return this->DoSelect();
+    }
+
+    void Operate(const opendnp3::AnalogOutputDouble64& command,
+                 uint16_t index,
+                 opendnp3::IUpdateHandler& handler,
+                 opendnp3::OperateType opType,
+                 const opendnp3::CommandCompletion& completion) override
+    {
+        this->DoOperate(index, opType, completion);
+    }
+
+    uint32_t numBegin = 0;
+    uint32_t numEnd = 0;
+    uint32_t numSelect = 0;
+    opendnp3::CommandStatus selectStatus = opendnp3::CommandStatus::SUCCESS;
+    std::vector<PendingOperate> operates;
+
+private:
+    opendnp3::CommandStatus DoSelect()
+    {
+        ++numSelect;
+        return selectStatus;
+    }
+
+    void DoOperate(uint16_t index, opendnp3::OperateType opType, const opendnp3::CommandCompletion& completion)
+    {
+        this->operates.push_back(PendingOperate{index, opType, completion});
+    }
+};
+
+#endif
@@ -145,6 +145,7 @@ public:
         binaryCommandEventSOE.clear();
         analogCommandEventSOE.clear();
         timeSOE.clear();
+        headers.clear();
     }
 
     std::map<uint16_t, Record<opendnp3::Binary>> binarySOE;
@@ -160,6 +161,9 @@ public:
     std::map<uint16_t, Record<opendnp3::AnalogCommandEvent>> analogCommandEventSOE;
     std::vector<opendnp3::DNPTime> timeSOE;
 
+    // every header with indexed values, including headers without any values
+    std::vector<opendnp3::HeaderInfo> headers;
+
 private:
     uint32_t soeCount;
 
@@ -174,6 +178,7 @@ private:
             ++this->soeCount;
         };
 
+        this->headers.push_back(info);
         values.ForeachItem(process);
     }
 };
@@ -0,0 +1,161 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "mocks/QueuedChannelListener.h"
+
+#include <opendnp3/DNP3Manager.h>
+#include <opendnp3/logging/LogLevels.h>
+#include <opendnp3/master/DefaultMasterApplication.h>
+#include <opendnp3/outstation/DefaultOutstationApplication.h>
+#include <opendnp3/outstation/SimpleCommandHandler.h>
+
+#include <dnp3mocks/DatabaseHelpers.h>
+
+#include <catch.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <unordered_map>
+
+using namespace opendnp3;
+
+#define SUITE(name) "DecodeOnThreadPoolTestSuite - " name
+
+// stores every value like a historian would and counts the completed responses
+class HistorianSOEHandler final : public ISOEHandler
+{
+public:
+    void WaitForResponse(std::chrono::steady_clock::duration timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (!cv.wait_for(lock, timeout, [this]() { return this->numResponses > 0; }))
+        {
+            throw std::logic_error("timeout waiting for response");
+        }
+        --numResponses;
+    }
+
+    size_t GetNumValues()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return binaries.size() + analogs.size();
+    }
+
+    void BeginFragment(const ResponseInfo&) override {}
+
+    void EndFragment(const ResponseInfo& info) override
+    {
+        if (info.fin)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++numResponses;
+            cv.notify_all();
+        }
+    }
+
+    void Process(const HeaderInfo&, const ICollection<Indexed<Binary>>& values) override
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        values.ForeachItem([this](const Indexed<Binary>& item) { this->binaries[item.index] = item.value.value; });
+    }
+    void Process(const HeaderInfo&, const ICollection<Indexed<Analog>>& values) override
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        values.ForeachItem([this](const Indexed<Analog>& item) { this->analogs[item.index] = item.value.value; });
+    }
+
+    void Process(const HeaderInfo&, const ICollection<Indexed<DoubleBitBinary>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<Counter>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<FrozenCounter>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<BinaryOutputStatus>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<AnalogOutputStatus>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<OctetString>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<TimeAndInterval>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<BinaryCommandEvent>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<AnalogCommandEvent>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<DNPTime>&) override {}
+
+private:
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t numResponses = 0;
+    std::unordered_map<uint16_t, bool> binaries;
+    std::unordered_map<uint16_t, double> analogs;
+};
+
+// average time of an integrity poll of 50k binaries and 50k analogs over an in-process loopback channel
+std::chrono::microseconds MeasureIntegrityPoll(const std::string& name, bool decodeOnThreadPool)
+{
+    const uint16_t NUM_POINTS_PER_TYPE = 50000;
+    const int NUM_POLLS = 5;
+
+    const auto LEVELS = levels::NOTHING | flags::ERR;
+    const auto TIMEOUT = std::chrono::seconds(30);
+
+    DNP3Manager manager(4);
+
+    const auto serverListener = std::make_shared<QueuedChannelListener>();
+    const auto clientListener = std::make_shared<QueuedChannelListener>();
+
+    auto server = manager.AddLoopbackChannel("server", LEVELS, name, serverListener);
+    auto client = manager.AddLoopbackChannel("client", LEVELS, name, clientListener);
+
+    OutstationStackConfig outstationConfig(
+        configure::database_by_sizes(NUM_POINTS_PER_TYPE, 0, NUM_POINTS_PER_TYPE, 0, 0, 0, 0, 0, 0));
+    auto outstation = server->AddOutstation("outstation", SuccessCommandHandler::Create(),
+                                            DefaultOutstationApplication::Create(), outstationConfig);
+    outstation->Enable();
+
+    MasterStackConfig masterConfig;
+    masterConfig.master.unsolClassMask = ClassField::None();
+    masterConfig.master.startupIntegrityClassMask = ClassField::None();
+    masterConfig.master.decodeOnThreadPool = decodeOnThreadPool;
+
+    const auto historian = std::make_shared<HistorianSOEHandler>();
+    auto master = client->AddMaster("master", historian, DefaultMasterApplication::Create(), masterConfig);
+    master->Enable();
+
+    REQUIRE(serverListener->WaitForState(ChannelState::OPEN, TIMEOUT));
+    REQUIRE(clientListener->WaitForState(ChannelState::OPEN, TIMEOUT));
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < NUM_POLLS; ++i)
+    {
+        master->ScanClasses(ClassField(PointClass::Class0), historian);
+        historian->WaitForResponse(TIMEOUT);
+    }
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    REQUIRE(historian->GetNumValues() == 2 * NUM_POINTS_PER_TYPE);
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(elapsed) / NUM_POLLS;
+}
+
+TEST_CASE(SUITE("100k point integrity poll over loopback"))
+{
+    const auto strand = MeasureIntegrityPoll("strand", false);
+    const auto pool = MeasureIntegrityPoll("pool", true);
+
+    std::cout << "100k point integrity poll: " << strand.count() << " us decoding on the channel strand, "
+              << pool.count() << " us decoding on the thread pool" << std::endl;
+}
@@ -0,0 +1,258 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mocks/NullSOEHandler.h"
+
+#include <opendnp3/DNP3Manager.h>
+#include <opendnp3/logging/LogLevels.h>
+#include <opendnp3/master/DefaultMasterApplication.h>
+#include <opendnp3/master/IListenCallbacks.h>
+
+#include <catch.hpp>
+
+#if defined(__linux__)
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace opendnp3;
+
+#define SUITE(name) "ListenerFootprintTestSuite - " name
+
+class FootprintListenCallbacks final : public IListenCallbacks
+{
+public:
+    explicit FootprintListenCallbacks(bool poolFragmentBuffers) : poolFragmentBuffers(poolFragmentBuffers) {}
+
+    bool AcceptConnection(uint64_t /*sessionid*/, const std::string& /*ipaddress*/) override
+    {
+        ++numAccepted;
+        return true;
+    }
+
+    bool AcceptCertificate(uint64_t /*sessionid*/, const X509Info& /*info*/) override
+    {
+        return true;
+    }
+
+    TimeDuration GetFirstFrameTimeout() override
+    {
+        return TimeDuration::Minutes(5);
+    }
+
+    void OnFirstFrame(uint64_t sessionid, const LinkHeaderFields& header, ISessionAcceptor& acceptor) override
+    {
+        MasterStackConfig config;
+        config.link.LocalAddr = header.addresses.destination;
+        config.link.RemoteAddr = header.addresses.source;
+        config.master.poolFragmentBuffers = poolFragmentBuffers;
+
+        acceptor.AcceptSession(std::to_string(sessionid), NullSOEHandler::Create(), DefaultMasterApplication::Create(),
+                               config);
+        ++numSessions;
+    }
+
+    void OnConnectionClose(uint64_t /*sessionid*/, const std::shared_ptr<IMasterSession>& /*session*/) override
+    {
+        ++numClosed;
+    }
+
+    void OnCertificateError(uint64_t /*sessionid*/, const X509Info& /*info*/, int /*error*/) override {}
+
+    const bool poolFragmentBuffers;
+    std::atomic<size_t> numAccepted{0};
+    std::atomic<size_t> numSessions{0};
+    std::atomic<size_t> numClosed{0};
+};
+
+// resident set size of this process in bytes
+size_t ResidentBytes()
+{
+    std::ifstream statm("/proc/self/statm");
+    size_t total = 0;
+    size_t resident = 0;
+    statm >> total >> resident;
+    return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+// REQUEST_LINK_STATUS from an outstation, enough for the listener to create a session
+std::vector<uint8_t> LinkStatusRequest(uint16_t source)
+{
+    std::vector<uint8_t> frame
+        = {0x05, 0x64, 0x05, 0x49, 0x01, 0x00, static_cast<uint8_t>(source & 0xFF), static_cast<uint8_t>(source >> 8)};
+
+    uint16_t crc = 0;
+    for (auto byte : frame)
+    {
+        crc ^= byte;
+        for (int i = 0; i < 8; ++i)
+        {
+            crc = (crc & 0x01) ? static_cast<uint16_t>((crc >> 1) ^ 0xA6BC) : static_cast<uint16_t>(crc >> 1);
+        }
+    }
+    crc = static_cast<uint16_t>(~crc);
+
+    frame.push_back(static_cast<uint8_t>(crc & 0xFF));
+    frame.push_back(static_cast<uint8_t>(crc >> 8));
+    return frame;
+}
+
+template<class Predicate> bool WaitFor(Predicate predicate, std::chrono::steady_clock::duration timeout)
+{
+    const auto expiration = std::chrono::steady_clock::now() + timeout;
+    while (!predicate())
+    {
+        if (std::chrono::steady_clock::now() > expiration)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return true;
+}
+
+// Opens a large number of loopback connections to a listener and reports the resident memory
+// per connection before (pre-session) and after (full master session) the first frame.
+void MeasureFootprint(bool poolFragmentBuffers)
+{
+    const uint16_t PORT = 20000;
+    const size_t MAX_CONNECTIONS = 20000;
+    const auto TIMEOUT = std::chrono::seconds(60);
+
+    // each connection uses two descriptors in this process
+    rlimit limit{};
+    getrlimit(RLIMIT_NOFILE, &limit);
+    const auto numConnections = std::min<size_t>(MAX_CONNECTIONS, (limit.rlim_cur - 100) / 2);
+
+    const auto concurrency = std::max<unsigned int>(std::thread::hardware_concurrency(), 2);
+
+    DNP3Manager manager(concurrency);
+
+    auto callbacks = std::make_shared<FootprintListenCallbacks>(poolFragmentBuffers);
+    auto listener = manager.CreateListener("listener", levels::NOTHING, IPEndpoint::Localhost(PORT),
+                                           ListenerConfig(static_cast<uint16_t>(concurrency), 0), callbacks);
+
+    const auto baseline = ResidentBytes();
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(PORT);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    std::vector<int> sockets;
+    for (size_t i = 0; i < numConnections; ++i)
+    {
+        const auto fd = socket(AF_INET, SOCK_STREAM, 0);
+        REQUIRE(fd >= 0);
+        REQUIRE(connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0);
+        sockets.push_back(fd);
+    }
+
+    REQUIRE(WaitFor([&]() { return callbacks->numAccepted == numConnections; }, TIMEOUT));
+
+    const auto connected = ResidentBytes();
+
+    for (size_t i = 0; i < sockets.size(); ++i)
+    {
+        const auto frame = LinkStatusRequest(static_cast<uint16_t>(1024 + i));
+        REQUIRE(send(sockets[i], frame.data(), frame.size(), 0) == static_cast<ssize_t>(frame.size()));
+    }
+
+    REQUIRE(WaitFor([&]() { return callbacks->numSessions == numConnections; }, TIMEOUT));
+
+    const auto sessions = ResidentBytes();
+
+    std::cout << numConnections << " connections, pooled fragment buffers: " << std::boolalpha << poolFragmentBuffers
+              << std::endl;
+    std::cout << "pre-session: " << (connected - baseline) / numConnections << " bytes per connection" << std::endl;
+    std::cout << "master session: " << (sessions - connected) / numConnections << " additional bytes per connection"
+              << std::endl;
+
+    for (auto fd : sockets)
+    {
+        close(fd);
+    }
+}
+
+TEST_CASE(SUITE("Pooled session stacks are reused across reconnects"))
+{
+    const uint16_t PORT = 20001;
+    const size_t NUM_CONNECTIONS = 8;
+    const auto TIMEOUT = std::chrono::seconds(10);
+
+    DNP3Manager manager(2);
+
+    auto callbacks = std::make_shared<FootprintListenCallbacks>(false);
+    auto listener = manager.CreateListener("listener", levels::NOTHING, IPEndpoint::Localhost(PORT),
+                                           ListenerConfig(1, NUM_CONNECTIONS), callbacks);
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(PORT);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    for (size_t round = 1; round <= 3; ++round)
+    {
+        std::vector<int> sockets;
+        for (size_t i = 0; i < NUM_CONNECTIONS; ++i)
+        {
+            const auto fd = socket(AF_INET, SOCK_STREAM, 0);
+            REQUIRE(fd >= 0);
+            REQUIRE(connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0);
+            const auto frame = LinkStatusRequest(static_cast<uint16_t>(1024 + i));
+            REQUIRE(send(fd, frame.data(), frame.size(), 0) == static_cast<ssize_t>(frame.size()));
+            sockets.push_back(fd);
+        }
+
+        REQUIRE(WaitFor([&]() { return callbacks->numSessions == round * NUM_CONNECTIONS; }, TIMEOUT));
+
+        for (auto fd : sockets)
+        {
+            close(fd);
+        }
+
+        REQUIRE(WaitFor([&]() { return callbacks->numClosed == round * NUM_CONNECTIONS; }, TIMEOUT));
+    }
+}
+
+// Hidden from the default run since they need a large file descriptor limit
+
+TEST_CASE(SUITE("Per-session memory footprint"), "[.]")
+{
+    MeasureFootprint(false);
+}
+
+TEST_CASE(SUITE("Per-session memory footprint with pooled buffers"), "[.]")
+{
+    MeasureFootprint(true);
+}
+
+#endif
@@ -0,0 +1,146 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mocks/NullSOEHandler.h"
+#include "mocks/PerformanceStackPair.h"
+#include "mocks/QueuedChannelListener.h"
+
+#include <opendnp3/DNP3Manager.h>
+#include <opendnp3/logging/LogLevels.h>
+#include <opendnp3/master/DefaultMasterApplication.h>
+#include <opendnp3/outstation/DefaultOutstationApplication.h>
+#include <opendnp3/outstation/SimpleCommandHandler.h>
+
+#include <dnp3mocks/DatabaseHelpers.h>
+
+#include <catch.hpp>
+
+#include <iostream>
+#include <memory>
+#include <thread>
+
+using namespace opendnp3;
+
+#define SUITE(name) "LoopbackChannelTestSuite - " name
+
+namespace
+{
+const auto LEVELS = levels::NOTHING | flags::ERR | flags::WARN;
+const auto TEST_TIMEOUT = std::chrono::seconds(5);
+
+std::shared_ptr<IChannel> AddMaster(DNP3Manager& manager, const char* id, std::shared_ptr<IChannelListener> listener)
+{
+    auto channel = manager.AddLoopbackChannel(id, LEVELS, "loopback", std::move(listener));
+    auto master = channel->AddMaster(id, NullSOEHandler::Create(), DefaultMasterApplication::Create(),
+                                     MasterStackConfig());
+    master->Enable();
+    return channel;
+}
+
+std::shared_ptr<IChannel> AddOutstation(DNP3Manager& manager, std::shared_ptr<IChannelListener> listener)
+{
+    auto channel = manager.AddLoopbackChannel("outstation", LEVELS, "loopback", std::move(listener));
+    auto outstation = channel->AddOutstation("outstation", SuccessCommandHandler::Create(),
+                                             DefaultOutstationApplication::Create(),
+                                             OutstationStackConfig(configure::by_count_of::all_types(5)));
+    outstation->Enable();
+    return channel;
+}
+} // namespace
+
+TEST_CASE(SUITE("Channels with the same name connect and reconnect to a new peer"))
+{
+    DNP3Manager manager(2);
+
+    auto outstationListener = std::make_shared<QueuedChannelListener>();
+    auto firstListener = std::make_shared<QueuedChannelListener>();
+    auto secondListener = std::make_shared<QueuedChannelListener>();
+
+    auto outstation = AddOutstation(manager, outstationListener);
+    auto first = AddMaster(manager, "first", firstListener);
+
+    REQUIRE(outstationListener->WaitForState(ChannelState::OPEN, TEST_TIMEOUT));
+    REQUIRE(firstListener->WaitForState(ChannelState::OPEN, TEST_TIMEOUT));
+
+    // the outstation is already connected, so a third channel with the name waits
+    auto second = AddMaster(manager, "second", secondListener);
+
+    first->Shutdown();
+
+    // the outstation sees the close and pairs with the waiting channel
+    REQUIRE(outstationListener->WaitForState(ChannelState::OPEN, TEST_TIMEOUT));
+    REQUIRE(secondListener->WaitForState(ChannelState::OPEN, TEST_TIMEOUT));
+}
+
+TEST_CASE(SUITE("PointsPerSecond with many stack pairs"))
+{
+    // no sockets or ports are used, so the number of pairs is only limited by memory
+    const uint16_t NUM_STACK_PAIRS = 1000;
+
+    const uint16_t NUM_POINTS_PER_TYPE = 10;
+    const uint16_t EVENTS_PER_ITERATION = 10;
+    const int NUM_ITERATIONS = 20;
+
+    const auto STACK_TIMEOUT = TimeDuration::Seconds(1);
+
+    const auto concurrency = std::max<unsigned int>(std::thread::hardware_concurrency(), 2);
+
+    DNP3Manager manager(concurrency);
+
+    std::vector<std::unique_ptr<PerformanceStackPair>> pairs;
+
+    for (uint16_t i = 0; i < NUM_STACK_PAIRS; ++i)
+    {
+        pairs.push_back(std::make_unique<PerformanceStackPair>(LEVELS, STACK_TIMEOUT, manager, i, NUM_POINTS_PER_TYPE,
+                                                               EVENTS_PER_ITERATION, UnsolicitedBatchPolicy(),
+                                                               PerformanceStackPair::Transport::Loopback));
+    }
+
+    for (auto& pair : pairs)
+    {
+        pair->WaitForChannelsOnline(TEST_TIMEOUT);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < NUM_ITERATIONS; ++i)
+    {
+        for (auto& pair : pairs)
+        {
+            pair->SendValues();
+        }
+
+        for (auto& pair : pairs)
+        {
+            pair->WaitForValues(TEST_TIMEOUT);
+        }
+    }
+
+    const auto milliseconds
+        = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    const auto total_events_transferred = static_cast<uint64_t>(NUM_STACK_PAIRS)
+        * static_cast<uint64_t>(EVENTS_PER_ITERATION) * static_cast<uint64_t>(NUM_ITERATIONS);
+
+    const auto rate = (total_events_transferred * 1000) / std::max<int64_t>(milliseconds.count(), 1);
+
+    std::cout << NUM_STACK_PAIRS << " loopback pairs: " << total_events_transferred << " in " << milliseconds.count()
+              << " ms == " << rate << " events per/sec" << std::endl;
+}
@@ -0,0 +1,248 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "mocks/QueuedChannelListener.h"
+
+#include <opendnp3/DNP3Manager.h>
+#include <opendnp3/logging/LogLevels.h>
+#include <opendnp3/master/DefaultMasterApplication.h>
+#include <opendnp3/outstation/DefaultOutstationApplication.h>
+#include <opendnp3/outstation/SimpleCommandHandler.h>
+#include <opendnp3/util/MonotonicMemoryResource.h>
+
+#include <dnp3mocks/DatabaseHelpers.h>
+
+#include <catch.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <new>
+#include <vector>
+
+using namespace opendnp3;
+
+#define SUITE(name) "MemoryResourceTestSuite - " name
+
+// counts the completed responses of every master sharing it
+class ResponseCounter final : public ISOEHandler
+{
+public:
+    void WaitForResponses(size_t count, std::chrono::steady_clock::duration timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (!cv.wait_for(lock, timeout, [&]() { return this->numResponses >= count; }))
+        {
+            throw std::logic_error("timeout waiting for responses");
+        }
+        numResponses -= count;
+    }
+
+    void BeginFragment(const ResponseInfo&) override {}
+
+    void EndFragment(const ResponseInfo& info) override
+    {
+        if (info.fin)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++numResponses;
+            cv.notify_all();
+        }
+    }
+
+    void Process(const HeaderInfo&, const ICollection<Indexed<Binary>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<DoubleBitBinary>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<Analog>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<Counter>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<FrozenCounter>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<BinaryOutputStatus>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<AnalogOutputStatus>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<OctetString>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<TimeAndInterval>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<BinaryCommandEvent>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<Indexed<AnalogCommandEvent>>&) override {}
+    void Process(const HeaderInfo&, const ICollection<DNPTime>&) override {}
+
+private:
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t numResponses = 0;
+};
+
+TEST_CASE(SUITE("1000 stacks built from a monotonic arena poll without growing it"))
+{
+    const uint16_t NUM_PAIRS = 500;
+    const uint16_t MASTER_ADDRESS = 1000;
+    const int NUM_ROUNDS = 3;
+
+    const auto LEVELS = levels::NOTHING | flags::ERR;
+    const auto TIMEOUT = std::chrono::seconds(60);
+
+    auto arena = std::make_shared<MonotonicMemoryResource>(256 * 1024 * 1024);
+
+    DNP3Manager manager(4);
+    manager.SetMemoryResource(arena);
+
+    const auto serverListener = std::make_shared<QueuedChannelListener>();
+    const auto clientListener = std::make_shared<QueuedChannelListener>();
+
+    auto server = manager.AddLoopbackChannel("server", LEVELS, "arena", serverListener);
+    auto client = manager.AddLoopbackChannel("client", LEVELS, "arena", clientListener);
+
+    const auto counter = std::make_shared<ResponseCounter>();
+
+    std::vector<std::shared_ptr<IOutstation>> outstations;
+    std::vector<std::shared_ptr<IMaster>> masters;
+
+    for (uint16_t i = 1; i <= NUM_PAIRS; ++i)
+    {
+        OutstationStackConfig outstationConfig(configure::database_by_sizes(10, 10, 10, 10, 10, 10, 10, 10, 0));
+        outstationConfig.outstation.eventBufferConfig = EventBufferConfig::AllTypes(10);
+        outstationConfig.link.LocalAddr = i;
+        outstationConfig.link.RemoteAddr = MASTER_ADDRESS;
+        auto outstation = server->AddOutstation("outstation" + std::to_string(i), SuccessCommandHandler::Create(),
+                                                DefaultOutstationApplication::Create(), outstationConfig);
+        outstation->Enable();
+        outstations.push_back(outstation);
+
+        MasterStackConfig masterConfig;
+        masterConfig.link.LocalAddr = MASTER_ADDRESS;
+        masterConfig.link.RemoteAddr = i;
+        masterConfig.master.unsolClassMask = ClassField::None();
+        masterConfig.master.startupIntegrityClassMask = ClassField::None();
+        auto master = client->AddMaster("master" + std::to_string(i), counter, DefaultMasterApplication::Create(),
+                                        masterConfig);
+        master->Enable();
+        masters.push_back(master);
+    }
+
+    REQUIRE(serverListener->WaitForState(ChannelState::OPEN, TIMEOUT));
+    REQUIRE(clientListener->WaitForState(ChannelState::OPEN, TIMEOUT));
+
+    const auto built = arena->NumAllocatedBytes();
+
+    size_t arenaBytesAfterFirstRound = 0;
+    for (int round = 0; round < NUM_ROUNDS; ++round)
+    {
+        for (auto& master : masters)
+        {
+            master->ScanClasses(ClassField::AllClasses(), counter);
+        }
+        counter->WaitForResponses(NUM_PAIRS, TIMEOUT);
+
+        if (round == 0)
+        {
+            arenaBytesAfterFirstRound = arena->NumAllocatedBytes();
+        }
+    }
+
+    // every stack accounts for its own share of the arena
+    size_t numStackBytes = 0;
+    for (auto& outstation : outstations)
+    {
+        const auto bytes = outstation->GetStackStatistics().memory.numResourceBytes;
+        REQUIRE(bytes > 0);
+        numStackBytes += bytes;
+    }
+    for (auto& master : masters)
+    {
+        const auto bytes = master->GetStackStatistics().memory.numResourceBytes;
+        REQUIRE(bytes > 0);
+        numStackBytes += bytes;
+    }
+
+    REQUIRE(numStackBytes <= built);
+
+    // steady state polling draws nothing more from the arena
+    REQUIRE(arena->NumAllocatedBytes() == arenaBytesAfterFirstRound);
+
+    std::cout << 2 * NUM_PAIRS << " stacks: " << built / (2 * NUM_PAIRS) << " arena bytes per stack, "
+              << numStackBytes / (2 * NUM_PAIRS) << " accounted to the stacks" << std::endl;
+}
+
+TEST_CASE(SUITE("An exhausted arena rejects new stacks while existing stacks keep polling"))
+{
+    const uint16_t MASTER_ADDRESS = 1000;
+    const auto LEVELS = levels::NOTHING;
+    const auto TIMEOUT = std::chrono::seconds(10);
+
+    auto arena = std::make_shared<MonotonicMemoryResource>(512 * 1024);
+
+    DNP3Manager manager(2);
+    manager.SetMemoryResource(arena);
+
+    const auto serverListener = std::make_shared<QueuedChannelListener>();
+    const auto clientListener = std::make_shared<QueuedChannelListener>();
+
+    auto server = manager.AddLoopbackChannel("server", LEVELS, "exhausted", serverListener);
+    auto client = manager.AddLoopbackChannel("client", LEVELS, "exhausted", clientListener);
+
+    auto AddOutstation = [&](uint16_t address) {
+        OutstationStackConfig config(configure::database_by_sizes(10, 10, 10, 10, 10, 10, 10, 10, 0));
+        config.outstation.eventBufferConfig = EventBufferConfig::AllTypes(10);
+        config.link.LocalAddr = address;
+        config.link.RemoteAddr = MASTER_ADDRESS;
+        return server->AddOutstation("outstation" + std::to_string(address), SuccessCommandHandler::Create(),
+                                     DefaultOutstationApplication::Create(), config);
+    };
+
+    auto outstation = AddOutstation(1);
+    REQUIRE(outstation);
+    outstation->Enable();
+
+    MasterStackConfig masterConfig;
+    masterConfig.link.LocalAddr = MASTER_ADDRESS;
+    masterConfig.link.RemoteAddr = 1;
+    masterConfig.master.unsolClassMask = ClassField::None();
+    masterConfig.master.startupIntegrityClassMask = ClassField::None();
+    const auto counter = std::make_shared<ResponseCounter>();
+    auto master = client->AddMaster("master", counter, DefaultMasterApplication::Create(), masterConfig);
+    REQUIRE(master);
+    master->Enable();
+
+    REQUIRE(serverListener->WaitForState(ChannelState::OPEN, TIMEOUT));
+    REQUIRE(clientListener->WaitForState(ChannelState::OPEN, TIMEOUT));
+
+    // exhausting the arena fails in the caller, either while building a stack or while binding it to the channel
+    bool exhausted = false;
+    std::vector<std::shared_ptr<IOutstation>> outstations;
+    for (uint16_t address = 2; !exhausted && address < 1000; ++address)
+    {
+        try
+        {
+            auto added = AddOutstation(address);
+            exhausted = !added;
+            outstations.push_back(added);
+        }
+        catch (const std::bad_alloc&)
+        {
+            exhausted = true;
+        }
+    }
+
+    REQUIRE(exhausted);
+
+    // the thread pool is unaffected and the stacks that were built keep running without the arena
+    for (int i = 0; i < 3; ++i)
+    {
+        master->ScanClasses(ClassField::AllClasses(), counter);
+        counter->WaitForResponses(1, TIMEOUT);
+    }
+}
@@ -0,0 +1,234 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "mocks/NullSOEHandler.h"
+#include "mocks/QueuedChannelListener.h"
+
+#include <opendnp3/DNP3Manager.h>
+#include <opendnp3/logging/LogLevels.h>
+#include <opendnp3/master/DefaultMasterApplication.h>
+#include <opendnp3/outstation/DefaultOutstationApplication.h>
+#include <opendnp3/outstation/SimpleCommandHandler.h>
+#include <opendnp3/outstation/UpdateBuilder.h>
+
+#include <dnp3mocks/DatabaseHelpers.h>
+
+#include <catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace opendnp3;
+
+#define SUITE(name) "MultidropPollingTestSuite - " name
+
+LinkStatistics::Polling MeasurePolling(IChannel& channel, std::chrono::steady_clock::duration duration)
+{
+    const auto before = channel.GetStatistics().polling;
+    std::this_thread::sleep_for(duration);
+    const auto after = channel.GetStatistics().polling;
+
+    LinkStatistics::Polling ret;
+    ret.numTasksStarted = after.numTasksStarted - before.numTasksStarted;
+    ret.numTasksStartedEarly = after.numTasksStartedEarly - before.numTasksStartedEarly;
+    ret.busyMicroseconds = after.busyMicroseconds - before.busyMicroseconds;
+    ret.elapsedMicroseconds = after.elapsedMicroseconds - before.elapsedMicroseconds;
+    return ret;
+}
+
+void PrintPolling(const char* name, const LinkStatistics::Polling& polling)
+{
+    const auto utilization = (100.0 * polling.busyMicroseconds) / polling.elapsedMicroseconds;
+
+    std::cout << name << ": " << polling.numTasksStarted << " polls (" << polling.numTasksStartedEarly
+              << " early) in " << polling.elapsedMicroseconds / 1000 << " ms, line utilization " << utilization << "%"
+              << std::endl;
+}
+
+TEST_CASE(SUITE("Poll planner fills idle time on a shared channel"))
+{
+    const uint16_t PORT = 20300;
+    const uint16_t MASTER_ADDRESS = 1;
+    const uint16_t FIRST_OUTSTATION_ADDRESS = 10;
+    const uint16_t NUM_OUTSTATIONS = 8;
+
+    const auto LEVELS = levels::NOTHING | flags::ERR;
+    const auto SCAN_PERIOD = TimeDuration::Milliseconds(50);
+    const auto TIMEOUT = std::chrono::seconds(5);
+
+    DNP3Manager manager(2);
+
+    const auto serverListener = std::make_shared<QueuedChannelListener>();
+    const auto clientListener = std::make_shared<QueuedChannelListener>();
+
+    auto server = manager.AddTCPServer("server", LEVELS, ServerAcceptMode::CloseExisting, IPEndpoint::Localhost(PORT),
+                                       serverListener);
+    auto client = manager.AddTCPClient("client", LEVELS, ChannelRetry::Default(), {IPEndpoint::Localhost(PORT)},
+                                       "127.0.0.1", clientListener);
+
+    // every outstation and master shares a single connection, like the drops of a multidrop line
+    std::vector<std::shared_ptr<IOutstation>> outstations;
+    std::vector<std::shared_ptr<IMaster>> masters;
+
+    for (uint16_t i = 0; i < NUM_OUTSTATIONS; ++i)
+    {
+        OutstationStackConfig outstationConfig(configure::by_count_of::all_types(5));
+        outstationConfig.link.LocalAddr = FIRST_OUTSTATION_ADDRESS + i;
+        outstationConfig.link.RemoteAddr = MASTER_ADDRESS;
+
+        auto outstation = server->AddOutstation("outstation" + std::to_string(i), SuccessCommandHandler::Create(),
+                                                DefaultOutstationApplication::Create(), outstationConfig);
+        outstation->Enable();
+        outstations.push_back(outstation);
+
+        MasterStackConfig masterConfig;
+        masterConfig.link.LocalAddr = MASTER_ADDRESS;
+        masterConfig.link.RemoteAddr = FIRST_OUTSTATION_ADDRESS + i;
+        masterConfig.master.disableUnsolOnStartup = false;
+        masterConfig.master.unsolClassMask = ClassField::None();
+        masterConfig.master.startupIntegrityClassMask = ClassField::None();
+
+        auto master = client->AddMaster("master" + std::to_string(i), NullSOEHandler::Create(),
+                                        DefaultMasterApplication::Create(), masterConfig);
+        master->AddClassScan(ClassField::AllEventClasses(), SCAN_PERIOD, NullSOEHandler::Create());
+        master->Enable();
+        masters.push_back(master);
+    }
+
+    REQUIRE(serverListener->WaitForState(ChannelState::OPEN, TIMEOUT));
+    REQUIRE(clientListener->WaitForState(ChannelState::OPEN, TIMEOUT));
+
+    // let the startup tasks settle
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    const auto scheduled = MeasurePolling(*client, std::chrono::seconds(1));
+    PrintPolling("scheduled", scheduled);
+    REQUIRE(scheduled.numTasksStartedEarly == 0);
+
+    client->SetPollPlanner(PollPlannerConfig(SCAN_PERIOD, true));
+
+    const auto planned = MeasurePolling(*client, std::chrono::seconds(1));
+    PrintPolling("planned", planned);
+    REQUIRE(planned.numTasksStartedEarly > 0);
+    REQUIRE(planned.numTasksStarted > scheduled.numTasksStarted);
+    REQUIRE(planned.busyMicroseconds > scheduled.busyMicroseconds);
+}
+
+size_t MeasureScanBytes(uint16_t port, bool adaptive)
+{
+    const uint16_t MASTER_ADDRESS = 1;
+    const uint16_t FIRST_OUTSTATION_ADDRESS = 10;
+    const uint16_t NUM_OUTSTATIONS = 8;
+    const uint16_t NUM_BUSY_OUTSTATIONS = 2;
+
+    const auto LEVELS = levels::NOTHING | flags::ERR;
+    const auto MIN_PERIOD = TimeDuration::Milliseconds(50);
+    const auto MAX_PERIOD = TimeDuration::Milliseconds(800);
+    const auto TIMEOUT = std::chrono::seconds(5);
+
+    DNP3Manager manager(2);
+
+    const auto serverListener = std::make_shared<QueuedChannelListener>();
+    const auto clientListener = std::make_shared<QueuedChannelListener>();
+
+    auto server = manager.AddTCPServer("server", LEVELS, ServerAcceptMode::CloseExisting, IPEndpoint::Localhost(port),
+                                       serverListener);
+    auto client = manager.AddTCPClient("client", LEVELS, ChannelRetry::Default(), {IPEndpoint::Localhost(port)},
+                                       "127.0.0.1", clientListener);
+
+    std::vector<std::shared_ptr<IOutstation>> outstations;
+    std::vector<std::shared_ptr<IMaster>> masters;
+
+    for (uint16_t i = 0; i < NUM_OUTSTATIONS; ++i)
+    {
+        OutstationStackConfig outstationConfig(configure::by_count_of::all_types(5));
+        outstationConfig.link.LocalAddr = FIRST_OUTSTATION_ADDRESS + i;
+        outstationConfig.link.RemoteAddr = MASTER_ADDRESS;
+        outstationConfig.outstation.eventBufferConfig = EventBufferConfig::AllTypes(100);
+
+        auto outstation = server->AddOutstation("outstation" + std::to_string(i), SuccessCommandHandler::Create(),
+                                                DefaultOutstationApplication::Create(), outstationConfig);
+        outstation->Enable();
+        outstations.push_back(outstation);
+
+        MasterStackConfig masterConfig;
+        masterConfig.link.LocalAddr = MASTER_ADDRESS;
+        masterConfig.link.RemoteAddr = FIRST_OUTSTATION_ADDRESS + i;
+        masterConfig.master.unsolClassMask = ClassField::None();
+        masterConfig.master.startupIntegrityClassMask = ClassField::None();
+
+        auto master = client->AddMaster("master" + std::to_string(i), NullSOEHandler::Create(),
+                                        DefaultMasterApplication::Create(), masterConfig);
+        if (adaptive)
+        {
+            master->AddAdaptiveClassScan(ClassField::AllEventClasses(), AdaptiveScanConfig(MIN_PERIOD, MAX_PERIOD),
+                                         NullSOEHandler::Create());
+        }
+        else
+        {
+            master->AddClassScan(ClassField::AllEventClasses(), MIN_PERIOD, NullSOEHandler::Create());
+        }
+        master->Enable();
+        masters.push_back(master);
+    }
+
+    REQUIRE(serverListener->WaitForState(ChannelState::OPEN, TIMEOUT));
+    REQUIRE(clientListener->WaitForState(ChannelState::OPEN, TIMEOUT));
+
+    // the first few outstations keep generating events, the others stay quiet
+    std::atomic<bool> running(true);
+    std::thread generator([&]() {
+        for (double value = 0; running; ++value)
+        {
+            for (uint16_t i = 0; i < NUM_BUSY_OUTSTATIONS; ++i)
+            {
+                UpdateBuilder builder;
+                builder.Update(Analog(value), 0);
+                outstations[i]->Apply(builder.Build());
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    });
+
+    // let the adaptive scans of the quiet outstations back off
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    const auto before = client->GetStatistics().channel;
+    std::this_thread::sleep_for(std::chrono::seconds(2));
+    const auto after = client->GetStatistics().channel;
+
+    running = false;
+    generator.join();
+
+    return (after.numBytesTx - before.numBytesTx) + (after.numBytesRx - before.numBytesRx);
+}
+
+TEST_CASE(SUITE("Adaptive scans save bandwidth on quiet outstations"))
+{
+    const auto fixed = MeasureScanBytes(20310, false);
+    const auto adaptive = MeasureScanBytes(20320, true);
+
+    std::cout << "fixed period scans: " << fixed << " bytes, adaptive scans: " << adaptive << " bytes ("
+              << (100.0 * (fixed - adaptive)) / fixed << "% saved)" << std::endl;
+
+    REQUIRE(adaptive < fixed);
+}
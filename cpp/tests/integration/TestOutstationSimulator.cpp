@@ -0,0 +1,315 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "OutstationSimulator.h"
+
+#include <opendnp3/DNP3Manager.h>
+#include <opendnp3/logging/LogLevels.h>
+#include <opendnp3/master/ISOEHandler.h>
+
+#include <catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace opendnp3;
+
+#define SUITE(name) "OutstationSimulatorTestSuite - " name
+
+namespace
+{
+
+const uint16_t NUM_OUTSTATIONS = 6;
+const uint16_t NUM_CHANNELS = 2;
+const uint16_t POINTS_PER_TYPE = 100;
+const auto LEVELS = levels::NOTHING | flags::ERR;
+const auto TIMEOUT = std::chrono::seconds(10);
+
+// an event takes at least 2 bytes in a response, the index and the flags of a binary, so a fragment with more
+// events than this can't fit in a single transport segment
+const uint32_t MAX_EVENTS_PER_SEGMENT = 249 / 2;
+
+// counts what one master receives, called from the strand of its channel
+class CountingHandler final : public ISOEHandler
+{
+public:
+    void BeginFragment(const ResponseInfo& info) override
+    {
+        this->eventsInFragment = 0;
+    }
+
+    void EndFragment(const ResponseInfo& info) override
+    {
+        if (this->eventsInFragment > this->maxEventsPerFragment)
+        {
+            this->maxEventsPerFragment = this->eventsInFragment;
+        }
+    }
+
+    void Process(const HeaderInfo& info, const ICollection<Indexed<Binary>>& values) override
+    {
+        this->Count(info, values.Count(), this->numBinaries);
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<Counter>>& values) override
+    {
+        this->Count(info, values.Count(), this->numCounters);
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<Analog>>& values) override
+    {
+        this->Count(info, values.Count(), this->numAnalogs);
+    }
+
+    void Process(const HeaderInfo& info, const ICollection<Indexed<DoubleBitBinary>>& values) override
+    {
+        ++this->numUnexpected;
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<FrozenCounter>>& values) override
+    {
+        ++this->numUnexpected;
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryOutputStatus>>& values) override
+    {
+        ++this->numUnexpected;
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogOutputStatus>>& values) override
+    {
+        ++this->numUnexpected;
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<OctetString>>& values) override
+    {
+        ++this->numUnexpected;
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<TimeAndInterval>>& values) override
+    {
+        ++this->numUnexpected;
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryCommandEvent>>& values) override
+    {
+        ++this->numUnexpected;
+    }
+    void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogCommandEvent>>& values) override
+    {
+        ++this->numUnexpected;
+    }
+    void Process(const HeaderInfo& info, const ICollection<DNPTime>& values) override
+    {
+        ++this->numUnexpected;
+    }
+
+    // static values of each type
+    std::atomic<uint32_t> numBinaries{0};
+    std::atomic<uint32_t> numCounters{0};
+    std::atomic<uint32_t> numAnalogs{0};
+
+    std::atomic<uint64_t> numEvents{0};
+    std::atomic<uint32_t> maxEventsPerFragment{0};
+    std::atomic<uint32_t> numUnexpected{0};
+
+private:
+    void Count(const HeaderInfo& info, uint32_t count, std::atomic<uint32_t>& numStatic)
+    {
+        if (info.isEventVariation)
+        {
+            this->numEvents += count;
+            this->eventsInFragment += count;
+        }
+        else
+        {
+            numStatic += count;
+        }
+    }
+
+    uint32_t eventsInFragment = 0;
+};
+
+class RecordingApplication final : public IMasterApplication
+{
+public:
+    void OnReceiveIIN(const IINField& iin) override
+    {
+        if (iin.HasRequestError())
+        {
+            ++this->numRequestErrors;
+        }
+    }
+
+    void OnTaskComplete(const TaskInfo& info) override
+    {
+        if (info.result != TaskCompletion::SUCCESS)
+        {
+            ++this->numFailures;
+            return;
+        }
+
+        switch (info.type)
+        {
+        case (MasterTaskType::DISABLE_UNSOLICITED):
+        case (MasterTaskType::CLEAR_RESTART):
+        case (MasterTaskType::STARTUP_INTEGRITY_POLL):
+        case (MasterTaskType::ENABLE_UNSOLICITED):
+            ++this->numStartupTasks;
+            break;
+        default:
+            break;
+        }
+    }
+
+    UTCTimestamp Now() override
+    {
+        return UTCTimestamp();
+    }
+
+    static const uint32_t NUM_STARTUP_TASKS = 4;
+
+    std::atomic<uint32_t> numStartupTasks{0};
+    std::atomic<uint32_t> numFailures{0};
+    std::atomic<uint32_t> numRequestErrors{0};
+};
+
+struct SimulatedMaster
+{
+    std::shared_ptr<CountingHandler> handler = std::make_shared<CountingHandler>();
+    std::shared_ptr<RecordingApplication> application = std::make_shared<RecordingApplication>();
+    std::shared_ptr<IMaster> master;
+};
+
+bool WaitFor(const std::function<bool()>& condition)
+{
+    const auto expiration = std::chrono::steady_clock::now() + TIMEOUT;
+    while (!condition())
+    {
+        if (std::chrono::steady_clock::now() > expiration)
+            return false;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return true;
+}
+
+void TestSimulator(SimulatorSettings::Transport transport, uint16_t basePort)
+{
+    SimulatorSettings settings;
+    settings.numOutstations = NUM_OUTSTATIONS;
+    settings.pointsPerType = POINTS_PER_TYPE;
+    settings.eventCapacity = 1000;
+    // enough events per tick that an unsolicited response needs several segments
+    settings.eventsPerSecond = 2000.0;
+    settings.numThreads = 2;
+    settings.transport = transport;
+    settings.numChannels = NUM_CHANNELS;
+    settings.basePort = basePort;
+    settings.localAdapter = "127.0.0.1";
+
+    OutstationSimulator simulator(settings);
+    simulator.Start();
+
+    DNP3Manager manager(2);
+    std::vector<SimulatedMaster> masters;
+
+    for (uint16_t c = 0; c < NUM_CHANNELS; ++c)
+    {
+        const auto port = static_cast<uint16_t>(basePort + c);
+
+        // the master of a UDP channel sends from the port 100 above the one of the simulator
+        const auto channel = (transport == SimulatorSettings::Transport::TCP)
+            ? manager.AddTCPClient("client", LEVELS, ChannelRetry::Default(), {IPEndpoint::Localhost(port)},
+                                   "127.0.0.1", nullptr)
+            : manager.AddUDPChannel("udp", LEVELS, ChannelRetry::Default(),
+                                    IPEndpoint::Localhost(static_cast<uint16_t>(port + 100)),
+                                    IPEndpoint::Localhost(port), nullptr);
+
+        // outstation i is on channel i % NUM_CHANNELS, at address base + i / NUM_CHANNELS
+        for (uint16_t i = c; i < NUM_OUTSTATIONS; i += NUM_CHANNELS)
+        {
+            SimulatedMaster master;
+
+            MasterStackConfig config;
+            config.link.LocalAddr = settings.masterAddress;
+            config.link.RemoteAddr = static_cast<uint16_t>(settings.baseOutstationAddress + i / NUM_CHANNELS);
+            config.master.unsolClassMask = ClassField::AllEventClasses();
+            config.master.responseTimeout = TimeDuration::Seconds(5);
+
+            master.master = channel->AddMaster("master", master.handler, master.application, config);
+            master.master->Enable();
+            masters.push_back(master);
+        }
+    }
+
+    const auto all = [&](const std::function<bool(const SimulatedMaster&)>& condition) {
+        for (const auto& master : masters)
+        {
+            if (!condition(master))
+                return false;
+        }
+        return true;
+    };
+
+    // the startup sequence ends with the integrity poll and enabling unsolicited responses
+    REQUIRE(WaitFor([&]() {
+        return all([](const SimulatedMaster& m) {
+            return m.application->numStartupTasks >= RecordingApplication::NUM_STARTUP_TASKS;
+        });
+    }));
+
+    // the integrity poll returned every point, in a response that spans several segments
+    for (const auto& master : masters)
+    {
+        REQUIRE(master.handler->numBinaries == POINTS_PER_TYPE);
+        REQUIRE(master.handler->numCounters == POINTS_PER_TYPE);
+        REQUIRE(master.handler->numAnalogs == POINTS_PER_TYPE);
+    }
+
+    REQUIRE(WaitFor([&]() {
+        return all([](const SimulatedMaster& m) { return m.handler->maxEventsPerFragment > MAX_EVENTS_PER_SEGMENT; });
+    }));
+
+    // every event the masters have received so far gets confirmed
+    uint64_t numReceived = 0;
+    for (const auto& master : masters)
+    {
+        numReceived += master.handler->numEvents;
+    }
+    REQUIRE(WaitFor([&]() { return simulator.GetNumEventsConfirmed() >= numReceived; }));
+
+    for (const auto& master : masters)
+    {
+        REQUIRE(master.application->numFailures == 0);
+        REQUIRE(master.application->numRequestErrors == 0);
+        REQUIRE(master.handler->numUnexpected == 0);
+    }
+
+    manager.Shutdown();
+    simulator.Stop();
+}
+
+} // namespace
+
+TEST_CASE(SUITE("Masters complete startup, integrity polls and confirm events over TCP"))
+{
+    TestSimulator(SimulatorSettings::Transport::TCP, 20400);
+}
+
+TEST_CASE(SUITE("Masters complete startup, integrity polls and confirm events over UDP"))
+{
+    TestSimulator(SimulatorSettings::Transport::UDP, 20410);
+}
@@ -97,3 +97,167 @@ TEST_CASE(SUITE("PointsPerSecond"))
     std::cout << total_events_transferred << " in " << milliseconds.count() << " ms == " << rate << " events per/sec"
               << std::endl;
 }
+
+TEST_CASE(SUITE("ConfirmedFragmentsPerSecond"))
+{
+    // one event per iteration means every unsolicited response is a single segment fragment
+    // followed by a confirm, so this measures per-fragment overhead rather than bulk throughput
+    const uint16_t START_PORT = 20100;
+    const uint16_t NUM_STACK_PAIRS = 10;
+
+    const uint16_t NUM_POINTS_PER_TYPE = 10;
+    const uint16_t EVENTS_PER_ITERATION = 1;
+    const int NUM_ITERATIONS = 500;
+
+    const auto LEVELS = levels::NOTHING | flags::ERR | flags::WARN;
+
+    const auto TEST_TIMEOUT = std::chrono::seconds(5);
+    const auto STACK_TIMEOUT = TimeDuration::Seconds(1);
+
+    const auto concurrency = std::max<unsigned int>(std::thread::hardware_concurrency(), 2);
+
+    DNP3Manager manager(concurrency);
+
+    std::vector<std::unique_ptr<PerformanceStackPair>> pairs;
+
+    for (uint16_t i = 0; i < NUM_STACK_PAIRS; ++i)
+    {
+        pairs.push_back(std::make_unique<PerformanceStackPair>(LEVELS, STACK_TIMEOUT, manager, START_PORT + i,
+                                                               NUM_POINTS_PER_TYPE, EVENTS_PER_ITERATION));
+    }
+
+    for (auto& pair : pairs)
+    {
+        pair->WaitForChannelsOnline(TEST_TIMEOUT);
+    }
+
+    // the integrity poll on startup may be multi-segment, so only count what the loop transfers
+    const auto countFragments = [&pairs](uint64_t& fragments, uint64_t& zeroCopy) {
+        for (auto& pair : pairs)
+        {
+            for (const auto& stats : {pair->GetMasterStatistics(), pair->GetOutstationStatistics()})
+            {
+                fragments += stats.transport.rx.numTransportRx;
+                zeroCopy += stats.transport.rx.numTransportZeroCopyRx;
+            }
+        }
+    };
+
+    uint64_t fragments = 0;
+    uint64_t zeroCopy = 0;
+    countFragments(fragments, zeroCopy);
+    const auto initialFragments = fragments;
+    const auto initialZeroCopy = zeroCopy;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < NUM_ITERATIONS; ++i)
+    {
+        for (auto& pair : pairs)
+        {
+            pair->SendValues();
+        }
+
+        for (auto& pair : pairs)
+        {
+            pair->WaitForValues(TEST_TIMEOUT);
+        }
+    }
+
+    const auto milliseconds
+        = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    fragments = 0;
+    zeroCopy = 0;
+    countFragments(fragments, zeroCopy);
+    fragments -= initialFragments;
+    zeroCopy -= initialZeroCopy;
+
+    REQUIRE(zeroCopy == fragments);
+
+    const auto rate = (fragments * 1000) / std::max<int64_t>(milliseconds.count(), 1);
+
+    std::cout << fragments << " fragments (" << zeroCopy << " zero-copy) in " << milliseconds.count()
+              << " ms == " << rate << " fragments per/sec" << std::endl;
+}
+
+void MeasureUnsolicitedBatching(const char* name, uint16_t startPort, const UnsolicitedBatchPolicy& policy)
+{
+    const uint16_t NUM_STACK_PAIRS = 4;
+
+    const uint16_t NUM_POINTS_PER_TYPE = 10;
+    const uint16_t UPDATES_PER_ITERATION = 200;
+    const int NUM_ITERATIONS = 20;
+
+    const auto LEVELS = levels::NOTHING | flags::ERR | flags::WARN;
+
+    const auto TEST_TIMEOUT = std::chrono::seconds(5);
+    const auto STACK_TIMEOUT = TimeDuration::Seconds(1);
+
+    const auto concurrency = std::max<unsigned int>(std::thread::hardware_concurrency(), 2);
+
+    DNP3Manager manager(concurrency);
+
+    std::vector<std::unique_ptr<PerformanceStackPair>> pairs;
+
+    for (uint16_t i = 0; i < NUM_STACK_PAIRS; ++i)
+    {
+        pairs.push_back(std::make_unique<PerformanceStackPair>(LEVELS, STACK_TIMEOUT, manager, startPort + i,
+                                                               NUM_POINTS_PER_TYPE, UPDATES_PER_ITERATION, policy));
+    }
+
+    for (auto& pair : pairs)
+    {
+        pair->WaitForChannelsOnline(TEST_TIMEOUT);
+    }
+
+    size_t initialFragments = 0;
+    for (auto& pair : pairs)
+    {
+        initialFragments += pair->GetNumFragmentsReceived();
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < NUM_ITERATIONS; ++i)
+    {
+        for (auto& pair : pairs)
+        {
+            pair->SendValuesIndividually();
+        }
+
+        for (auto& pair : pairs)
+        {
+            pair->WaitForValues(TEST_TIMEOUT);
+        }
+    }
+
+    const auto milliseconds
+        = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    size_t fragments = 0;
+    for (auto& pair : pairs)
+    {
+        fragments += pair->GetNumFragmentsReceived();
+    }
+    fragments -= initialFragments;
+
+    const auto events = static_cast<uint64_t>(NUM_STACK_PAIRS) * UPDATES_PER_ITERATION * NUM_ITERATIONS;
+
+    REQUIRE(fragments > 0);
+
+    std::cout << name << ": " << events << " events in " << fragments << " fragments ("
+              << static_cast<double>(events) / fragments << " events per fragment), "
+              << (fragments * 1000) / std::max<int64_t>(milliseconds.count(), 1) << " fragments per/sec in "
+              << milliseconds.count() << " ms" << std::endl;
+}
+
+TEST_CASE(SUITE("UnsolicitedBatching"))
+{
+    MeasureUnsolicitedBatching("immediate", 20200, UnsolicitedBatchPolicy());
+    MeasureUnsolicitedBatching("hold 20 ms", 20210,
+                               UnsolicitedBatchPolicy::AllClasses(TimeDuration::Milliseconds(20), 0));
+    MeasureUnsolicitedBatching("hold 20 ms or full fragment", 20220,
+                               UnsolicitedBatchPolicy::AllClasses(TimeDuration::Milliseconds(20), 0,
+                                                                  DEFAULT_MAX_APDU_SIZE));
+}
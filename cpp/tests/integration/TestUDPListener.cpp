@@ -0,0 +1,205 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mocks/NullSOEHandler.h"
+
+#include <opendnp3/DNP3Manager.h>
+#include <opendnp3/logging/LogLevels.h>
+#include <opendnp3/master/DefaultMasterApplication.h>
+#include <opendnp3/master/IListenCallbacks.h>
+#include <opendnp3/outstation/DefaultOutstationApplication.h>
+#include <opendnp3/outstation/SimpleCommandHandler.h>
+
+#include <dnp3mocks/DatabaseHelpers.h>
+
+#include <catch.hpp>
+
+#include <chrono>
+#include <functional>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <thread>
+
+using namespace opendnp3;
+
+#define SUITE(name) "UDPListenerTestSuite - " name
+
+class CountingMasterApplication final : public IMasterApplication
+{
+public:
+    explicit CountingMasterApplication(std::function<void()> onIntegrity) : onIntegrity(std::move(onIntegrity)) {}
+
+    void OnTaskComplete(const TaskInfo& info) override
+    {
+        if (info.type == MasterTaskType::STARTUP_INTEGRITY_POLL && info.result == TaskCompletion::SUCCESS)
+        {
+            onIntegrity();
+        }
+    }
+
+    UTCTimestamp Now() override
+    {
+        return default_app.Now();
+    }
+
+private:
+    std::function<void()> onIntegrity;
+    DefaultMasterApplication default_app;
+};
+
+class CountingListenCallbacks final : public IListenCallbacks
+{
+public:
+    bool AcceptConnection(uint64_t /*sessionid*/, const std::string& /*ipaddress*/) override
+    {
+        return true;
+    }
+
+    bool AcceptCertificate(uint64_t /*sessionid*/, const X509Info& /*info*/) override
+    {
+        return true;
+    }
+
+    TimeDuration GetFirstFrameTimeout() override
+    {
+        return TimeDuration::Seconds(30);
+    }
+
+    void OnFirstFrame(uint64_t sessionid, const LinkHeaderFields& header, ISessionAcceptor& acceptor) override
+    {
+        MasterStackConfig config;
+        config.link.LocalAddr = header.addresses.destination;
+        config.link.RemoteAddr = header.addresses.source;
+
+        auto app = std::make_shared<CountingMasterApplication>([this]() { this->OnIntegrity(); });
+
+        acceptor.AcceptSession(std::to_string(sessionid), NullSOEHandler::Create(), app, config);
+
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->sources.insert(header.addresses.source);
+        ++this->numSessions;
+    }
+
+    void OnConnectionClose(uint64_t /*sessionid*/, const std::shared_ptr<IMasterSession>& /*session*/) override {}
+
+    void OnCertificateError(uint64_t /*sessionid*/, const X509Info& /*info*/, int /*error*/) override {}
+
+    bool WaitForIntegrity(size_t count, std::chrono::steady_clock::duration timeout)
+    {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        return this->condition.wait_for(lock, timeout, [&]() { return this->numIntegrity >= count; });
+    }
+
+    size_t NumSessions()
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->numSessions;
+    }
+
+    size_t NumSources()
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->sources.size();
+    }
+
+private:
+    void OnIntegrity()
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        ++this->numIntegrity;
+        this->condition.notify_all();
+    }
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    size_t numSessions = 0;
+    size_t numIntegrity = 0;
+    std::set<uint16_t> sources;
+};
+
+// spin up N UDP outstations that all report to the same listener port and
+// wait until the listener has completed an integrity poll with each of them
+void TestUDPListener(uint16_t numOutstations, bool distinctPorts)
+{
+    const uint16_t LISTEN_PORT = 20000;
+    const uint16_t START_PORT = 30000;
+    const auto TIMEOUT = std::chrono::seconds(30);
+
+    const auto concurrency = std::max<unsigned int>(std::thread::hardware_concurrency(), 2);
+
+    DNP3Manager manager(concurrency);
+
+    auto callbacks = std::make_shared<CountingListenCallbacks>();
+    auto listener
+        = manager.CreateUDPListener("listener", levels::NOTHING, IPEndpoint::Localhost(LISTEN_PORT), callbacks);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::shared_ptr<IChannel>> channels;
+
+    // with a single local port, the outstations are only distinguished by their link address
+    const auto numChannels = distinctPorts ? numOutstations : 1;
+
+    for (uint16_t i = 0; i < numChannels; ++i)
+    {
+        channels.push_back(manager.AddUDPChannel("outstation", levels::NOTHING, ChannelRetry::Default(),
+                                                 IPEndpoint::Localhost(START_PORT + i),
+                                                 IPEndpoint::Localhost(LISTEN_PORT), nullptr));
+    }
+
+    for (uint16_t i = 0; i < numOutstations; ++i)
+    {
+        OutstationStackConfig config(configure::by_count_of::all_types(0));
+        config.outstation.params.allowUnsolicited = true;
+        config.link.LocalAddr = 1024 + i;
+
+        auto outstation = channels[distinctPorts ? i : 0]->AddOutstation(
+            "outstation", SuccessCommandHandler::Create(), DefaultOutstationApplication::Create(), config);
+        outstation->Enable();
+    }
+
+    REQUIRE(callbacks->WaitForIntegrity(numOutstations, TIMEOUT));
+
+    const auto milliseconds
+        = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    REQUIRE(callbacks->NumSessions() == numOutstations);
+    REQUIRE(callbacks->NumSources() == numOutstations);
+
+    std::cout << numOutstations << " UDP outstations on " << numChannels << " port(s) polled by one listener in "
+              << milliseconds.count() << " ms" << std::endl;
+}
+
+TEST_CASE(SUITE("One session per outstation port"))
+{
+    TestUDPListener(10, true);
+}
+
+TEST_CASE(SUITE("Sessions demultiplexed by link address"))
+{
+    TestUDPListener(10, false);
+}
+
+TEST_CASE(SUITE("500 outstation endpoints"))
+{
+    TestUDPListener(500, true);
+}
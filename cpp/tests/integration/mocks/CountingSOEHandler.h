@@ -31,6 +31,7 @@ class CountingSOEHandler final : public opendnp3::ISOEHandler
     std::mutex mutex;
     std::condition_variable cv;
     size_t count = 0;
+    size_t numFragments = 0;
 
 public:
     void WaitForCount(size_t num, std::chrono::steady_clock::duration timeout)
@@ -45,9 +46,16 @@ public:
         count -= num;
     }
 
+    size_t GetNumFragments()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return numFragments;
+    }
+
     void BeginFragment(const opendnp3::ResponseInfo&) override
     {
         mutex.lock();
+        ++numFragments;
     }
 
     void EndFragment(const opendnp3::ResponseInfo&) override
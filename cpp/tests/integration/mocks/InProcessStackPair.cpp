@@ -0,0 +1,144 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "mocks/InProcessStackPair.h"
+
+#include <opendnp3/master/DefaultMasterApplication.h>
+#include <opendnp3/outstation/DefaultOutstationApplication.h>
+#include <opendnp3/outstation/SimpleCommandHandler.h>
+
+using namespace opendnp3;
+
+namespace
+{
+
+const uint16_t MASTER_ADDRESS = 1;
+
+OutstationConfig GetOutstationConfig(uint16_t numPointsPerType, bool unsolicited, uint32_t maxFragSize)
+{
+    OutstationConfig config;
+    config.params.allowUnsolicited = unsolicited;
+    config.params.maxTxFragSize = maxFragSize;
+    config.params.maxRxFragSize = maxFragSize;
+    config.eventBufferConfig = EventBufferConfig::AllTypes(numPointsPerType);
+    return config;
+}
+
+MasterParams GetMasterParams(bool unsolicited, uint32_t maxFragSize)
+{
+    MasterParams params;
+    params.maxTxFragSize = maxFragSize;
+    params.maxRxFragSize = maxFragSize;
+    params.disableUnsolOnStartup = !unsolicited;
+    params.unsolClassMask = unsolicited ? ClassField::AllEventClasses() : ClassField::None();
+    return params;
+}
+
+} // namespace
+
+LoopbackLayer::LoopbackLayer(std::shared_ptr<exe4cpp::MockExecutor> executor) : executor(std::move(executor)) {}
+
+void LoopbackLayer::SetPeer(LoopbackLayer& peer)
+{
+    this->peer = &peer;
+}
+
+void LoopbackLayer::Up()
+{
+    this->pUpperLayer->OnLowerLayerUp();
+}
+
+bool LoopbackLayer::BeginTransmit(const Message& message)
+{
+    // the sender may reuse its buffer as soon as it is told the transmission completed
+    const auto data = static_cast<const uint8_t*>(message.payload);
+    this->buffer.assign(data, data + message.payload.length());
+    this->addresses = message.addresses;
+    this->executor->post([this]() { this->Deliver(); });
+    return true;
+}
+
+void LoopbackLayer::Deliver()
+{
+    // anything the peer sends in reply is posted, so the sender sees its transmission complete first
+    this->peer->pUpperLayer->OnReceive(
+        Message(this->addresses, ser4cpp::rseq_t(this->buffer.data(), this->buffer.size())));
+    this->pUpperLayer->OnTxReady();
+}
+
+InProcessStackPair::InProcessStackPair(const std::shared_ptr<exe4cpp::MockExecutor>& executor,
+                                       const std::shared_ptr<IMasterScheduler>& scheduler,
+                                       uint16_t outstationAddress,
+                                       uint16_t numPointsPerType,
+                                       bool unsolicited,
+                                       uint32_t maxFragSize)
+    : executor(executor),
+      soeHandler(std::make_shared<CountingSOEHandler>()),
+      outstationLower(std::make_shared<LoopbackLayer>(executor)),
+      masterLower(std::make_shared<LoopbackLayer>(executor)),
+      outstation(Addresses(outstationAddress, MASTER_ADDRESS),
+                 GetOutstationConfig(numPointsPerType, unsolicited, maxFragSize),
+                 DatabaseConfig(numPointsPerType),
+                 Logger::empty(),
+                 executor,
+                 outstationLower,
+                 SuccessCommandHandler::Create(),
+                 DefaultOutstationApplication::Create()),
+      master(std::make_shared<MContext>(Addresses(MASTER_ADDRESS, outstationAddress),
+                                        Logger::empty(),
+                                        executor,
+                                        masterLower,
+                                        soeHandler,
+                                        DefaultMasterApplication::Create(),
+                                        scheduler,
+                                        GetMasterParams(unsolicited, maxFragSize)))
+{
+    this->outstationLower->SetUpperLayer(this->outstation);
+    this->masterLower->SetUpperLayer(*this->master);
+    this->outstationLower->SetPeer(*this->masterLower);
+    this->masterLower->SetPeer(*this->outstationLower);
+}
+
+void InProcessStackPair::Start()
+{
+    this->outstationLower->Up();
+    this->masterLower->Up();
+    this->executor->run_many();
+}
+
+void InProcessStackPair::AddIntegrityScan(TimeDuration period)
+{
+    this->master->AddClassScan(ClassField::AllClasses(), period, this->soeHandler);
+}
+
+void InProcessStackPair::UpdateValues(uint16_t count)
+{
+    auto& handler = this->outstation.GetUpdateHandler();
+    ++this->value;
+    for (uint16_t i = 0; i < count; ++i)
+    {
+        handler.Update(Analog(this->value), i);
+    }
+    this->outstation.HandleNewEvents();
+}
+
+size_t InProcessStackPair::GetNumFragmentsReceived()
+{
+    return this->soeHandler->GetNumFragments();
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_INTEGRATIONTESTS_INPROCESSSTACKPAIR_H
+#define OPENDNP3_INTEGRATIONTESTS_INPROCESSSTACKPAIR_H
+
+#include "mocks/CountingSOEHandler.h"
+
+#include <exe4cpp/MockExecutor.h>
+
+#include <opendnp3/app/AppConstants.h>
+
+#include <LayerInterfaces.h>
+#include <master/IMasterScheduler.h>
+#include <master/MasterContext.h>
+#include <outstation/OutstationContext.h>
+
+#include <memory>
+#include <vector>
+
+/**
+ * Lower layer that hands every message to the upper layer of its peer on the executor,
+ * standing in for the link and transport layers of both stacks and the channel between them
+ */
+class LoopbackLayer final : public opendnp3::ILowerLayer, public opendnp3::HasUpperLayer
+{
+public:
+    explicit LoopbackLayer(std::shared_ptr<exe4cpp::MockExecutor> executor);
+
+    void SetPeer(LoopbackLayer& peer);
+
+    void Up();
+
+    bool BeginTransmit(const opendnp3::Message& message) final;
+
+private:
+    void Deliver();
+
+    const std::shared_ptr<exe4cpp::MockExecutor> executor;
+    LoopbackLayer* peer = nullptr;
+
+    opendnp3::Addresses addresses;
+    std::vector<uint8_t> buffer;
+};
+
+/**
+ * An outstation and a master talking over a LoopbackLayer, driven by a MockExecutor
+ *
+ * The whole exchange runs on the calling thread, so the layers above the link are
+ * measured without sockets, threads or timing noise.
+ */
+class InProcessStackPair
+{
+public:
+    InProcessStackPair(const std::shared_ptr<exe4cpp::MockExecutor>& executor,
+                       const std::shared_ptr<opendnp3::IMasterScheduler>& scheduler,
+                       uint16_t outstationAddress,
+                       uint16_t numPointsPerType,
+                       bool unsolicited,
+                       uint32_t maxFragSize = opendnp3::DEFAULT_MAX_APDU_SIZE);
+
+    // brings both sides online and runs the startup sequence of the master to completion
+    void Start();
+
+    void AddIntegrityScan(opendnp3::TimeDuration period);
+
+    // changes the values of the first count analogs on the outstation
+    void UpdateValues(uint16_t count);
+
+    size_t GetNumFragmentsReceived();
+
+private:
+    const std::shared_ptr<exe4cpp::MockExecutor> executor;
+    const std::shared_ptr<CountingSOEHandler> soeHandler;
+    const std::shared_ptr<LoopbackLayer> outstationLower;
+    const std::shared_ptr<LoopbackLayer> masterLower;
+
+    opendnp3::OContext outstation;
+    const std::shared_ptr<opendnp3::MContext> master;
+
+    double value = 0;
+};
+
+#endif
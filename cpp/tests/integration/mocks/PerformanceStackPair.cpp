@@ -38,15 +38,24 @@ PerformanceStackPair::PerformanceStackPair(LogLevels levels,
                                            DNP3Manager& manager,
                                            uint16_t port,
                                            uint16_t numPointsPerType,
-                                           uint32_t eventsPerIteration)
+                                           uint32_t eventsPerIteration,
+                                           const UnsolicitedBatchPolicy& unsolBatchPolicy,
+                                           Transport transport)
     : NUM_POINTS_PER_TYPE(numPointsPerType),
       EVENTS_PER_ITERATION(eventsPerIteration),
       soeHandler(std::make_shared<CountingSOEHandler>()),
       clientListener(std::make_shared<QueuedChannelListener>()),
       serverListener(std::make_shared<QueuedChannelListener>()),
-      master(CreateMaster(levels, timeout, manager, port, this->soeHandler, this->clientListener)),
-      outstation(CreateOutstation(
-          levels, timeout, manager, port, numPointsPerType, 3 * eventsPerIteration, this->serverListener))
+      master(CreateMaster(levels, timeout, manager, port, transport, this->soeHandler, this->clientListener)),
+      outstation(CreateOutstation(levels,
+                                  timeout,
+                                  manager,
+                                  port,
+                                  transport,
+                                  numPointsPerType,
+                                  3 * eventsPerIteration,
+                                  unsolBatchPolicy,
+                                  this->serverListener))
 {
     this->outstation->Enable();
     this->master->Enable();
@@ -67,12 +76,20 @@ void PerformanceStackPair::WaitForChannelsOnline(std::chrono::steady_clock::dura
 
 void PerformanceStackPair::SendValues()
 {
-    UpdateBuilder builder;
     for (uint32_t i = 0; i < EVENTS_PER_ITERATION; ++i)
     {
-        AddValue(i, builder);
+        AddValue(i, this->builder);
+    }
+    this->outstation->Apply(this->builder.Build());
+}
+
+void PerformanceStackPair::SendValuesIndividually()
+{
+    for (uint32_t i = 0; i < EVENTS_PER_ITERATION; ++i)
+    {
+        AddValue(i, this->builder);
+        this->outstation->Apply(this->builder.Build());
     }
-    this->outstation->Apply(builder.Build());
 }
 
 void PerformanceStackPair::AddValue(uint32_t i, UpdateBuilder& builder)
@@ -108,15 +125,22 @@ void PerformanceStackPair::WaitForValues(std::chrono::steady_clock::duration tim
     this->soeHandler->WaitForCount(this->EVENTS_PER_ITERATION, timeout);
 }
 
+void PerformanceStackPair::AddIntegrityScan(TimeDuration period)
+{
+    this->integrityScan = this->master->AddClassScan(ClassField(PointClass::Class0), period, this->soeHandler);
+}
+
 OutstationStackConfig PerformanceStackPair::GetOutstationStackConfig(uint16_t numPointsPerType,
                                                                      uint16_t eventBufferSize,
-                                                                     TimeDuration timeout)
+                                                                     TimeDuration timeout,
+                                                                     const UnsolicitedBatchPolicy& unsolBatchPolicy)
 {
     OutstationStackConfig config(configure::by_count_of::all_types(numPointsPerType));
 
     config.outstation.params.unsolConfirmTimeout = timeout;
     config.outstation.eventBufferConfig = EventBufferConfig::AllTypes(eventBufferSize);
     config.outstation.params.allowUnsolicited = true;
+    config.outstation.params.unsolBatchPolicy = unsolBatchPolicy;
 
     return config;
 }
@@ -138,11 +162,14 @@ std::shared_ptr<IMaster> PerformanceStackPair::CreateMaster(LogLevels levels,
                                                             TimeDuration timeout,
                                                             DNP3Manager& manager,
                                                             uint16_t port,
+                                                            Transport transport,
                                                             std::shared_ptr<ISOEHandler> soehandler,
                                                             std::shared_ptr<IChannelListener> listener)
 {
-    auto channel = manager.AddTCPClient(GetId("client", port), levels, ChannelRetry::Default(),
-                                        {IPEndpoint("127.0.0.1", port)}, "127.0.0.1", std::move(listener));
+    auto channel = (transport == Transport::Loopback)
+        ? manager.AddLoopbackChannel(GetId("client", port), levels, GetId("loopback", port), std::move(listener))
+        : manager.AddTCPClient(GetId("client", port), levels, ChannelRetry::Default(), {IPEndpoint("127.0.0.1", port)},
+                               "127.0.0.1", std::move(listener));
 
     return channel->AddMaster(GetId("master", port), std::move(soehandler), DefaultMasterApplication::Create(),
                               GetMasterStackConfig(timeout));
@@ -152,16 +179,21 @@ std::shared_ptr<IOutstation> PerformanceStackPair::CreateOutstation(LogLevels le
                                                                     TimeDuration timeout,
                                                                     DNP3Manager& manager,
                                                                     uint16_t port,
+                                                                    Transport transport,
                                                                     uint16_t numPointsPerType,
                                                                     uint16_t eventBufferSize,
+                                                                    const UnsolicitedBatchPolicy& unsolBatchPolicy,
                                                                     std::shared_ptr<IChannelListener> listener)
 {
-    auto channel = manager.AddTCPServer(GetId("server", port), levels, ServerAcceptMode::CloseExisting,
-                                        IPEndpoint("127.0.0.1", port), std::move(listener));
+    auto channel = (transport == Transport::Loopback)
+        ? manager.AddLoopbackChannel(GetId("server", port), levels, GetId("loopback", port), std::move(listener))
+        : manager.AddTCPServer(GetId("server", port), levels, ServerAcceptMode::CloseExisting,
+                               IPEndpoint("127.0.0.1", port), std::move(listener));
+
+    const auto config = GetOutstationStackConfig(numPointsPerType, eventBufferSize, timeout, unsolBatchPolicy);
 
     return channel->AddOutstation(GetId("outstation", port), SuccessCommandHandler::Create(),
-                                  DefaultOutstationApplication::Create(),
-                                  GetOutstationStackConfig(numPointsPerType, eventBufferSize, timeout));
+                                  DefaultOutstationApplication::Create(), config);
 }
 
 std::string PerformanceStackPair::GetId(const char* name, uint16_t port)
@@ -34,6 +34,15 @@
 
 class PerformanceStackPair final : opendnp3::Uncopyable
 {
+public:
+    enum class Transport
+    {
+        TCP,
+        // in-process channels named after the port, so no sockets are used
+        Loopback
+    };
+
+private:
     const uint16_t NUM_POINTS_PER_TYPE;
     const uint32_t EVENTS_PER_ITERATION;
 
@@ -45,15 +54,23 @@ class PerformanceStackPair final : opendnp3::Uncopyable
     const std::shared_ptr<opendnp3::IMaster> master;
     const std::shared_ptr<opendnp3::IOutstation> outstation;
 
-    static opendnp3::OutstationStackConfig GetOutstationStackConfig(uint16_t numPointsPerType,
-                                                                    uint16_t eventBufferSize,
-                                                                    opendnp3::TimeDuration timeout);
+    std::shared_ptr<opendnp3::IMasterScan> integrityScan;
+
+    // reused so that its storage is recycled between iterations
+    opendnp3::UpdateBuilder builder;
+
+    static opendnp3::OutstationStackConfig GetOutstationStackConfig(
+        uint16_t numPointsPerType,
+        uint16_t eventBufferSize,
+        opendnp3::TimeDuration timeout,
+        const opendnp3::UnsolicitedBatchPolicy& unsolBatchPolicy);
     static opendnp3::MasterStackConfig GetMasterStackConfig(opendnp3::TimeDuration timeout);
 
     static std::shared_ptr<opendnp3::IMaster> CreateMaster(opendnp3::LogLevels levels,
                                                            opendnp3::TimeDuration timeout,
                                                            opendnp3::DNP3Manager& manager,
                                                            uint16_t port,
+                                                           Transport transport,
                                                            std::shared_ptr<opendnp3::ISOEHandler>,
                                                            std::shared_ptr<opendnp3::IChannelListener> listener);
     static std::shared_ptr<opendnp3::IOutstation> CreateOutstation(
@@ -61,8 +78,10 @@ class PerformanceStackPair final : opendnp3::Uncopyable
         opendnp3::TimeDuration timeout,
         opendnp3::DNP3Manager& manager,
         uint16_t port,
+        Transport transport,
         uint16_t numPointsPerType,
         uint16_t eventBufferSize,
+        const opendnp3::UnsolicitedBatchPolicy& unsolBatchPolicy,
         std::shared_ptr<opendnp3::IChannelListener> listener);
 
     static std::string GetId(const char* name, uint16_t port);
@@ -74,13 +93,36 @@ public:
                          opendnp3::DNP3Manager& manager,
                          uint16_t port,
                          uint16_t numPointsPerType,
-                         uint32_t eventsPerIteration);
+                         uint32_t eventsPerIteration,
+                         const opendnp3::UnsolicitedBatchPolicy& unsolBatchPolicy = opendnp3::UnsolicitedBatchPolicy(),
+                         Transport transport = Transport::TCP);
 
     void WaitForChannelsOnline(std::chrono::steady_clock::duration timeout);
 
     void SendValues();
 
+    // applies each value as a separate update, like a point that changes rapidly
+    void SendValuesIndividually();
+
     void WaitForValues(std::chrono::steady_clock::duration timeout);
+
+    // periodically polls every static value, reporting to the same handler as the events
+    void AddIntegrityScan(opendnp3::TimeDuration period);
+
+    size_t GetNumFragmentsReceived() const
+    {
+        return soeHandler->GetNumFragments();
+    }
+
+    opendnp3::StackStatistics GetMasterStatistics() const
+    {
+        return master->GetStackStatistics();
+    }
+
+    opendnp3::StackStatistics GetOutstationStatistics() const
+    {
+        return outstation->GetStackStatistics();
+    }
 };
 
 #endif
@@ -24,6 +24,7 @@
 
 #include <app/APDURequest.h>
 #include <app/APDUResponse.h>
+#include <app/PackedBits.h>
 #include <catch.hpp>
 #include <gen/objects/Group1.h>
 #include <gen/objects/Group12.h>
@@ -35,6 +36,7 @@
 #include <gen/objects/Group60.h>
 
 #include <cassert>
+#include <vector>
 
 using namespace opendnp3;
 using namespace ser4cpp;
@@ -128,6 +130,121 @@ TEST_CASE(SUITE("CountIterator UInt8 boundary condition"))
     REQUIRE(beginsWith == truncated);
 }
 
+TEST_CASE(SUITE("RangeIterator stops at the last UInt8 index"))
+{
+    APDUResponse response(APDUHelpers::Response());
+    auto writer = response.GetWriter();
+
+    {
+        auto iterator
+            = writer.IterateOverRange<UInt8, Binary>(QualifierCode::UINT8_START_STOP, Group1Var2::Inst(), 200);
+
+        for (int i = 200; i < 256; ++i)
+        {
+            REQUIRE(iterator.Write(Binary(true)));
+        }
+
+        REQUIRE_FALSE(iterator.Write(Binary(true)));
+    }
+
+    std::string beginsWith("C0 81 00 00 01 02 00 C8 FF");
+    auto truncated = HexConversions::to_hex(response.ToRSeq()).substr(0, beginsWith.size());
+
+    REQUIRE(beginsWith == truncated);
+}
+
+TEST_CASE(SUITE("PrefixIterator UInt8 count boundary condition"))
+{
+    APDUResponse response(APDUHelpers::Response());
+    auto writer = response.GetWriter();
+
+    {
+        auto iterator = writer.IterateOverCountWithPrefix<UInt8, Binary>(QualifierCode::UINT8_CNT_UINT8_INDEX,
+                                                                         Group2Var1::Inst());
+
+        for (int i = 0; i < 255; ++i)
+        {
+            REQUIRE(iterator.Write(Binary(true), static_cast<uint8_t>(i)));
+        }
+
+        REQUIRE_FALSE(iterator.Write(Binary(true), 0));
+    }
+
+    std::string beginsWith("C0 81 00 00 02 01 17 FF");
+    auto truncated = HexConversions::to_hex(response.ToRSeq()).substr(0, beginsWith.size());
+
+    REQUIRE(beginsWith == truncated);
+}
+
+TEST_CASE(SUITE("BitfieldIterator covers the whole UInt16 index range in a large fragment"))
+{
+    std::vector<uint8_t> buffer(65536);
+    APDUResponse response(wseq_t(buffer.data(), buffer.size()));
+    response.SetFunction(FunctionCode::RESPONSE);
+    response.SetControl(AppControlField(true, true, false, false, 0));
+    response.SetIIN(IINField::Empty());
+    auto writer = response.GetWriter();
+
+    {
+        auto iterator
+            = writer.IterateOverSingleBitfield<UInt16>(Group1Var1::ID(), QualifierCode::UINT16_START_STOP, 0);
+
+        for (int i = 0; i < 65536; ++i)
+        {
+            REQUIRE(iterator.Write(true));
+        }
+
+        REQUIRE_FALSE(iterator.Write(true));
+    }
+
+    // the header is followed by 65536 bits
+    REQUIRE(response.ToRSeq().length() == 4 + 3 + 4 + 65536 / 8);
+
+    std::string beginsWith("C0 81 00 00 01 01 01 00 00 FF FF FF");
+    auto truncated = HexConversions::to_hex(response.ToRSeq()).substr(0, beginsWith.size());
+
+    REQUIRE(beginsWith == truncated);
+}
+
+TEST_CASE(SUITE("BitfieldIterator writes packed bits the same as single bits"))
+{
+    PackedBits bits;
+    bits.resize(200);
+    for (size_t i = 0; i < bits.size(); ++i)
+    {
+        bits.set(i, (i % 3) == 0 || (i % 7) == 0);
+    }
+
+    // a fragment that fits 152 bits, written as an unaligned run of 150 and then whatever fits
+    auto write = [&](bool packed) {
+        APDUResponse response(APDUHelpers::Response(4 + 3 + 2 + 19));
+        auto writer = response.GetWriter();
+        {
+            auto iterator
+                = writer.IterateOverSingleBitfield<UInt8>(Group1Var1::ID(), QualifierCode::UINT8_START_STOP, 5);
+
+            if (packed)
+            {
+                REQUIRE(iterator.Write(bits, 5, 150) == 150);
+                REQUIRE(iterator.Write(bits, 155, 45) == 2);
+            }
+            else
+            {
+                for (size_t i = 5; i < 157; ++i)
+                {
+                    REQUIRE(iterator.Write(bits.get(i)));
+                }
+                REQUIRE_FALSE(iterator.Write(true));
+            }
+        }
+        return HexConversions::to_hex(response.ToRSeq());
+    };
+
+    const auto expected = write(false);
+    REQUIRE(expected.substr(0, 23) == "C0 81 00 00 01 01 00 05");
+    REQUIRE(write(true) == expected);
+}
+
 TEST_CASE(SUITE("EmptyHeadersWhenNotEnoughSpaceForSingleValue"))
 {
     APDUResponse response(APDUHelpers::Response(8));
@@ -0,0 +1,374 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "dnp3mocks/MockLinkListener.h"
+#include "dnp3mocks/MockLogHandler.h"
+#include "dnp3mocks/MockTransportLayer.h"
+#include "utils/LinkHex.h"
+#include "utils/LinkLayerTest.h"
+#include "utils/MockTransportSegment.h"
+
+#include <ser4cpp/util/HexConversions.h>
+
+#include <catch.hpp>
+#include <link/LinkLayerParser.h>
+#include <transport/TransportHeader.h>
+
+#include <set>
+#include <vector>
+
+using namespace opendnp3;
+using namespace ser4cpp;
+
+#define SUITE(name) "LinkLayerConfirmedTestSuite - " name
+
+namespace
+{
+    // a fragment of full sized segments, each starting with a transport header
+    std::vector<std::string> Segments(uint8_t count, uint8_t firstSeq = 0)
+    {
+        std::vector<std::string> segments;
+        for (uint8_t i = 0; i < count; ++i)
+        {
+            std::vector<uint8_t> bytes(LPDU_MAX_USER_DATA_SIZE, i);
+            bytes[0] = TransportHeader::ToByte(i == 0, i == (count - 1), (firstSeq + i) % 64);
+            segments.push_back(HexConversions::to_hex(rseq_t(bytes.data(), bytes.size())));
+        }
+        return segments;
+    }
+
+    std::string Join(const std::vector<std::string>& segments)
+    {
+        std::string ret;
+        for (const auto& segment : segments)
+        {
+            ret += ret.empty() ? segment : (" " + segment);
+        }
+        return ret;
+    }
+
+    LinkConfig ConfirmedConfig(bool isMaster, uint8_t window, uint32_t numRetry = 0)
+    {
+        LinkConfig config(isMaster, true);
+        config.KeepAliveTimeout = TimeDuration::Max();
+        config.NumRetry = numRetry;
+        config.ConfirmWindow = window;
+        return config;
+    }
+
+    // one end of a simulated line: writes complete immediately and frames arrive at the remote after a delay
+    class DelayLine final : public ILinkTx
+    {
+    public:
+        DelayLine(const Logger& logger, std::shared_ptr<exe4cpp::MockExecutor> exe, TimeDuration delay)
+            : exe(std::move(exe)), delay(delay), parser(logger)
+        {
+        }
+
+        void Connect(ILinkSession& local, ILinkSession& remote)
+        {
+            this->local = &local;
+            this->remote = &remote;
+        }
+
+        void BeginTransmit(const rseq_t& buffer, ILinkSession& /*context*/) override
+        {
+            const auto index = numFrames++;
+            std::vector<uint8_t> frame(static_cast<const uint8_t*>(buffer), buffer + buffer.length());
+
+            exe->post([this]() { local->OnTxReady(); });
+
+            if (drops.count(index) == 0)
+            {
+                exe->start(delay.value, [this, frame]() { this->Deliver(frame); });
+            }
+        }
+
+        // indices of the frames written to the line that are lost
+        std::set<uint32_t> drops;
+        uint32_t numFrames = 0;
+
+    private:
+        void Deliver(const std::vector<uint8_t>& frame)
+        {
+            auto dest = parser.WriteBuff();
+            dest.copy_from(rseq_t(frame.data(), frame.size()));
+            parser.OnRead(frame.size(), *remote);
+        }
+
+        const std::shared_ptr<exe4cpp::MockExecutor> exe;
+        const TimeDuration delay;
+        LinkLayerParser parser;
+        ILinkSession* local = nullptr;
+        ILinkSession* remote = nullptr;
+    };
+
+    // a master sending confirmed user data to an outstation over a line with the specified one-way delay
+    class DelayLineTest
+    {
+    public:
+        DelayLineTest(uint8_t window, TimeDuration delay, uint32_t numRetry = 0)
+            : exe(std::make_shared<exe4cpp::MockExecutor>()),
+              masterUpper(std::make_shared<MockTransportLayer>()),
+              outstationUpper(std::make_shared<MockTransportLayer>()),
+              master(log.logger,
+                     exe,
+                     masterUpper,
+                     std::make_shared<MockLinkListener>(),
+                     LinkLayerConfig(ConfirmedConfig(true, window, numRetry), false)),
+              outstation(log.logger,
+                         exe,
+                         outstationUpper,
+                         std::make_shared<MockLinkListener>(),
+                         LinkLayerConfig(ConfirmedConfig(false, window), false)),
+              masterTx(log.logger, exe, delay),
+              outstationTx(log.logger, exe, delay)
+        {
+            masterUpper->SetLinkLayer(master);
+            outstationUpper->SetLinkLayer(outstation);
+            masterTx.Connect(master, outstation);
+            outstationTx.Connect(outstation, master);
+            master.SetRouter(masterTx);
+            outstation.SetRouter(outstationTx);
+            master.OnLowerLayerUp();
+            outstation.OnLowerLayerUp();
+        }
+
+        // send the segments from the master and run the line until the send completes, returning the time it took
+        std::chrono::steady_clock::duration Send(MockTransportSegment& segments)
+        {
+            const auto start = exe->get_time();
+            const auto numTxReady = masterUpper->GetCounters().numTxReady;
+
+            master.Send(segments);
+
+            while (true)
+            {
+                exe->run_many();
+                if (masterUpper->GetCounters().numTxReady > numTxReady)
+                {
+                    break;
+                }
+                REQUIRE(exe->advance_to_next_timer());
+            }
+
+            return exe->get_time() - start;
+        }
+
+        MockLogHandler log;
+        std::shared_ptr<exe4cpp::MockExecutor> exe;
+        std::shared_ptr<MockTransportLayer> masterUpper;
+        std::shared_ptr<MockTransportLayer> outstationUpper;
+        LinkLayer master;
+        LinkLayer outstation;
+        DelayLine masterTx;
+        DelayLine outstationTx;
+    };
+} // namespace
+
+TEST_CASE(SUITE("Confirmed send resets the remote link before the first frame"))
+{
+    LinkLayerTest t(ConfirmedConfig(true, 1));
+    t.link.OnLowerLayerUp();
+
+    const auto hex = Segments(1)[0];
+    MockTransportSegment segments(LPDU_MAX_USER_DATA_SIZE, hex, Addresses(1, 1024));
+    t.link.Send(segments);
+    REQUIRE(t.NumTotalWrites() == 1);
+    REQUIRE(t.PopLastWriteAsHex() == LinkHex::ResetLinkStates(true, 1024, 1));
+    t.link.OnTxReady();
+
+    t.OnFrame(LinkFunction::SEC_ACK, false, false, false, 1, 1024);
+    REQUIRE(t.NumTotalWrites() == 2);
+    REQUIRE(t.PopLastWriteAsHex() == LinkHex::ConfirmedUserData(true, true, 1024, 1, hex));
+    t.link.OnTxReady();
+
+    REQUIRE(t.exe->run_many() == 0);
+    REQUIRE(t.upper->GetCounters().numTxReady == 0);
+
+    t.OnFrame(LinkFunction::SEC_ACK, false, false, false, 1, 1024);
+    REQUIRE(t.exe->run_many() > 0);
+    REQUIRE(t.upper->GetCounters().numTxReady == 1);
+
+    // the link stays reset, so the next frame is sent immediately with the other FCB
+    segments.Reset();
+    t.link.Send(segments);
+    REQUIRE(t.NumTotalWrites() == 3);
+    REQUIRE(t.PopLastWriteAsHex() == LinkHex::ConfirmedUserData(true, false, 1024, 1, hex));
+}
+
+TEST_CASE(SUITE("Confirmed frame is retransmitted with the same FCB until the retries are exhausted"))
+{
+    LinkLayerTest t(ConfirmedConfig(true, 1, 1));
+    t.link.OnLowerLayerUp();
+
+    const auto hex = Segments(1)[0];
+    MockTransportSegment segments(LPDU_MAX_USER_DATA_SIZE, hex, Addresses(1, 1024));
+    t.link.Send(segments);
+    t.link.OnTxReady();
+    t.OnFrame(LinkFunction::SEC_ACK, false, false, false, 1, 1024);
+    t.link.OnTxReady();
+    REQUIRE(t.NumTotalWrites() == 2);
+
+    REQUIRE(t.exe->advance_to_next_timer());
+    REQUIRE(t.exe->run_many() > 0);
+    REQUIRE(t.NumTotalWrites() == 3);
+    REQUIRE(t.PopLastWriteAsHex() == LinkHex::ConfirmedUserData(true, true, 1024, 1, hex));
+    t.link.OnTxReady();
+
+    REQUIRE(t.exe->advance_to_next_timer());
+    REQUIRE(t.exe->run_many() > 0);
+    REQUIRE(t.NumTotalWrites() == 3);
+    REQUIRE(t.upper->GetCounters().numTxReady == 1);
+
+    // a failure requires the remote link to be reset again
+    segments.Reset();
+    t.link.Send(segments);
+    REQUIRE(t.NumTotalWrites() == 4);
+    REQUIRE(t.PopLastWriteAsHex() == LinkHex::ResetLinkStates(true, 1024, 1));
+}
+
+TEST_CASE(SUITE("Window of frames is transmitted without waiting for ACKs"))
+{
+    LinkLayerTest t(ConfirmedConfig(true, 2));
+    t.link.OnLowerLayerUp();
+
+    const auto hex = Segments(3);
+    MockTransportSegment segments(LPDU_MAX_USER_DATA_SIZE, Join(hex), Addresses(1, 1024));
+    t.link.Send(segments);
+    t.link.OnTxReady();
+    t.OnFrame(LinkFunction::SEC_ACK, false, false, false, 1, 1024);
+
+    REQUIRE(t.PopLastWriteAsHex() == LinkHex::ConfirmedUserData(true, true, 1024, 1, hex[0]));
+    t.link.OnTxReady();
+    REQUIRE(t.PopLastWriteAsHex() == LinkHex::ConfirmedUserData(true, false, 1024, 1, hex[1]));
+    t.link.OnTxReady();
+    REQUIRE(t.NumTotalWrites() == 3); // the window is full
+
+    t.OnFrame(LinkFunction::SEC_ACK, false, false, false, 1, 1024);
+    REQUIRE(t.NumTotalWrites() == 4);
+    REQUIRE(t.PopLastWriteAsHex() == LinkHex::ConfirmedUserData(true, true, 1024, 1, hex[2]));
+    t.link.OnTxReady();
+
+    t.OnFrame(LinkFunction::SEC_ACK, false, false, false, 1, 1024);
+    t.OnFrame(LinkFunction::SEC_ACK, false, false, false, 1, 1024);
+    REQUIRE(t.exe->run_many() > 0);
+    REQUIRE(t.upper->GetCounters().numTxReady == 1);
+}
+
+TEST_CASE(SUITE("Windowed secondary orders frames by transport sequence number"))
+{
+    LinkLayerTest t(ConfirmedConfig(false, 4));
+    t.link.OnLowerLayerUp();
+    t.OnFrame(LinkFunction::PRI_RESET_LINK_STATES, true, false, false, 1024, 1);
+    t.link.OnTxReady();
+
+    const auto hex = Segments(4);
+    HexSequence first(hex[0]);
+    HexSequence second(hex[1]);
+    HexSequence fourth(hex[3]);
+
+    // the second frame arrives while the ACK of the first is being written
+    t.OnFrame(LinkFunction::PRI_CONFIRMED_USER_DATA, true, true, false, 1024, 1, first.ToRSeq());
+    t.OnFrame(LinkFunction::PRI_CONFIRMED_USER_DATA, true, false, false, 1024, 1, second.ToRSeq());
+    REQUIRE(t.upper->receivedQueue.size() == 2);
+    REQUIRE(t.NumTotalWrites() == 2);
+    t.link.OnTxReady();
+    REQUIRE(t.NumTotalWrites() == 3);
+    REQUIRE(t.PopLastWriteAsHex() == LinkHex::Ack(false, false, 1, 1024));
+    t.link.OnTxReady();
+
+    // a repeated frame is acknowledged but not passed up
+    t.OnFrame(LinkFunction::PRI_CONFIRMED_USER_DATA, true, true, false, 1024, 1, first.ToRSeq());
+    REQUIRE(t.NumTotalWrites() == 4);
+    REQUIRE(t.upper->receivedQueue.size() == 2);
+    t.link.OnTxReady();
+
+    // a frame past a lost one is neither acknowledged nor passed up
+    t.OnFrame(LinkFunction::PRI_CONFIRMED_USER_DATA, true, false, false, 1024, 1, fourth.ToRSeq());
+    REQUIRE(t.NumTotalWrites() == 4);
+    REQUIRE(t.upper->receivedQueue.size() == 2);
+}
+
+TEST_CASE(SUITE("Delay line: stop-and-wait takes a round trip per frame"))
+{
+    DelayLineTest t(1, TimeDuration::Milliseconds(300));
+
+    const auto hex = Segments(8);
+    MockTransportSegment segments(LPDU_MAX_USER_DATA_SIZE, Join(hex), Addresses(1, 1024));
+
+    // one round trip for the link reset and one for each frame
+    REQUIRE(t.Send(segments) == TimeDuration::Milliseconds(9 * 600).value);
+    REQUIRE(std::vector<std::string>(t.outstationUpper->receivedQueue.begin(), t.outstationUpper->receivedQueue.end())
+            == hex);
+}
+
+TEST_CASE(SUITE("Delay line: a window of 8 frames takes a single round trip"))
+{
+    DelayLineTest t(8, TimeDuration::Milliseconds(300));
+
+    const auto hex = Segments(8);
+    MockTransportSegment segments(LPDU_MAX_USER_DATA_SIZE, Join(hex), Addresses(1, 1024));
+
+    // one round trip for the link reset and one for the whole window
+    REQUIRE(t.Send(segments) == TimeDuration::Milliseconds(2 * 600).value);
+    REQUIRE(std::vector<std::string>(t.outstationUpper->receivedQueue.begin(), t.outstationUpper->receivedQueue.end())
+            == hex);
+}
+
+TEST_CASE(SUITE("Delay line: window goes back to a lost frame"))
+{
+    DelayLineTest t(8, TimeDuration::Milliseconds(300), 2);
+    t.masterTx.drops.insert(3); // the third data frame, after the link reset
+
+    const auto hex = Segments(8);
+    MockTransportSegment segments(LPDU_MAX_USER_DATA_SIZE, Join(hex), Addresses(1, 1024));
+    t.Send(segments);
+
+    // the reset, the window, then the lost frame and every frame after it again
+    REQUIRE(t.masterTx.numFrames == 1 + 8 + 6);
+
+    REQUIRE(std::vector<std::string>(t.outstationUpper->receivedQueue.begin(), t.outstationUpper->receivedQueue.end())
+            == hex);
+}
+
+TEST_CASE(SUITE("Delay line: window recovers from lost ACKs"))
+{
+    DelayLineTest t(8, TimeDuration::Milliseconds(300), 2);
+    t.outstationTx.drops.insert(2);
+    t.outstationTx.drops.insert(8); // the ACK of the last frame
+
+    const auto hex = Segments(8);
+    MockTransportSegment segments(LPDU_MAX_USER_DATA_SIZE, Join(hex), Addresses(1, 1024));
+    t.Send(segments);
+
+    // only the frames still outstanding when the last ACK was lost are retransmitted
+    REQUIRE(t.masterTx.numFrames == 1 + 8 + 2);
+    REQUIRE(std::vector<std::string>(t.outstationUpper->receivedQueue.begin(), t.outstationUpper->receivedQueue.end())
+            == hex);
+
+    // the following fragment continues on the same link without a reset
+    const auto next = Segments(2, 8);
+    MockTransportSegment nextSegments(LPDU_MAX_USER_DATA_SIZE, Join(next), Addresses(1, 1024));
+    t.outstationUpper->receivedQueue.clear();
+    t.Send(nextSegments);
+
+    REQUIRE(std::vector<std::string>(t.outstationUpper->receivedQueue.begin(), t.outstationUpper->receivedQueue.end())
+            == next);
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <catch.hpp>
+#include <channel/LoopbackPipe.h>
+
+#include <numeric>
+#include <vector>
+
+using namespace opendnp3;
+using namespace ser4cpp;
+
+#define SUITE(name) "LoopbackPipeSuite - " name
+
+const static size_t CAPACITY = LoopbackPipe::CAPACITY;
+
+TEST_CASE(SUITE("Bytes are read in the order they were written"))
+{
+    LoopbackPipe pipe;
+
+    const uint8_t data[] = {0x01, 0x02, 0x03, 0x04, 0x05};
+    REQUIRE(pipe.Write(rseq_t(data, sizeof(data))) == 5);
+
+    uint8_t output[3] = {};
+    REQUIRE(pipe.Read(wseq_t(output, sizeof(output))) == 3);
+    REQUIRE(output[0] == 0x01);
+    REQUIRE(output[2] == 0x03);
+
+    REQUIRE(pipe.Read(wseq_t(output, sizeof(output))) == 2);
+    REQUIRE(output[0] == 0x04);
+    REQUIRE(output[1] == 0x05);
+
+    REQUIRE(pipe.Read(wseq_t(output, sizeof(output))) == 0);
+}
+
+TEST_CASE(SUITE("Writes are truncated when the pipe is full"))
+{
+    LoopbackPipe pipe;
+
+    std::vector<uint8_t> data(CAPACITY + 10, 0xAA);
+    REQUIRE(pipe.Write(rseq_t(data.data(), data.size())) == CAPACITY);
+    REQUIRE(pipe.Write(rseq_t(data.data(), data.size())) == 0);
+
+    uint8_t output[10] = {};
+    REQUIRE(pipe.Read(wseq_t(output, sizeof(output))) == 10);
+    REQUIRE(pipe.Write(rseq_t(data.data(), data.size())) == 10);
+}
+
+TEST_CASE(SUITE("Data wraps around the end of the buffer"))
+{
+    LoopbackPipe pipe;
+
+    std::vector<uint8_t> filler(CAPACITY - 2);
+    REQUIRE(pipe.Write(rseq_t(filler.data(), filler.size())) == filler.size());
+    REQUIRE(pipe.Read(wseq_t(filler.data(), filler.size())) == filler.size());
+
+    std::vector<uint8_t> data(6);
+    std::iota(data.begin(), data.end(), 0);
+    REQUIRE(pipe.Write(rseq_t(data.data(), data.size())) == 6);
+
+    std::vector<uint8_t> output(6);
+    REQUIRE(pipe.Read(wseq_t(output.data(), output.size())) == 6);
+    REQUIRE(output == data);
+}
+
+TEST_CASE(SUITE("Data written before the close can still be read"))
+{
+    LoopbackPipe pipe;
+
+    const uint8_t data[] = {0x01, 0x02};
+    REQUIRE(pipe.Write(rseq_t(data, sizeof(data))) == 2);
+
+    pipe.Close();
+    REQUIRE(pipe.IsClosed());
+    REQUIRE(pipe.Write(rseq_t(data, sizeof(data))) == 0);
+
+    uint8_t output[4] = {};
+    REQUIRE(pipe.Read(wseq_t(output, sizeof(output))) == 2);
+    REQUIRE(pipe.Read(wseq_t(output, sizeof(output))) == 0);
+}
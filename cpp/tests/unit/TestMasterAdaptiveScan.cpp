@@ -0,0 +1,120 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "utils/APDUHexBuilders.h"
+#include "utils/MasterTestFixture.h"
+
+#include <catch.hpp>
+
+using namespace opendnp3;
+
+#define SUITE(name) "MasterAdaptiveScanTestSuite - " name
+
+TimeDuration RespondToPoll(MasterTestFixture& t, uint8_t seq, const std::string& response);
+void AdvanceToNextPoll(MasterTestFixture& t, const TimeDuration& expected);
+
+TEST_CASE(SUITE("Backs off exponentially while the outstation is idle"))
+{
+    MasterTestFixture t(NoStartupTasks());
+    auto scan = t.context->AddAdaptiveClassScan(
+        ClassField::AllEventClasses(), AdaptiveScanConfig(TimeDuration::Seconds(1), TimeDuration::Seconds(8)), t.meas);
+    t.context->OnLowerLayerUp();
+    REQUIRE(t.exe->run_many() > 0);
+
+    REQUIRE(RespondToPoll(t, 0, hex::EmptyResponse(0)) == TimeDuration::Seconds(2));
+    AdvanceToNextPoll(t, TimeDuration::Seconds(2));
+    REQUIRE(RespondToPoll(t, 1, hex::EmptyResponse(1)) == TimeDuration::Seconds(4));
+    AdvanceToNextPoll(t, TimeDuration::Seconds(4));
+    REQUIRE(RespondToPoll(t, 2, hex::EmptyResponse(2)) == TimeDuration::Seconds(8));
+    AdvanceToNextPoll(t, TimeDuration::Seconds(8));
+    REQUIRE(RespondToPoll(t, 3, hex::EmptyResponse(3)) == TimeDuration::Seconds(8));
+    AdvanceToNextPoll(t, TimeDuration::Seconds(8));
+}
+
+TEST_CASE(SUITE("Returns to the minimum period when the outstation reports pending events"))
+{
+    MasterTestFixture t(NoStartupTasks());
+    auto scan = t.context->AddAdaptiveClassScan(
+        ClassField::AllEventClasses(), AdaptiveScanConfig(TimeDuration::Seconds(1), TimeDuration::Seconds(8)), t.meas);
+    t.context->OnLowerLayerUp();
+    REQUIRE(t.exe->run_many() > 0);
+
+    REQUIRE(RespondToPoll(t, 0, hex::EmptyResponse(0)) == TimeDuration::Seconds(2));
+    AdvanceToNextPoll(t, TimeDuration::Seconds(2));
+    REQUIRE(RespondToPoll(t, 1, hex::EmptyResponse(1, IINField(IINBit::CLASS2_EVENTS)))
+            == TimeDuration::Seconds(1));
+    AdvanceToNextPoll(t, TimeDuration::Seconds(1));
+}
+
+TEST_CASE(SUITE("Event counts below the backlog threshold hold the period"))
+{
+    MasterTestFixture t(NoStartupTasks());
+    auto scan = t.context->AddAdaptiveClassScan(
+        ClassField::AllEventClasses(), AdaptiveScanConfig(TimeDuration::Seconds(1), TimeDuration::Seconds(8), 2),
+        t.meas);
+    t.context->OnLowerLayerUp();
+    REQUIRE(t.exe->run_many() > 0);
+
+    REQUIRE(RespondToPoll(t, 0, hex::EmptyResponse(0)) == TimeDuration::Seconds(2));
+    AdvanceToNextPoll(t, TimeDuration::Seconds(2));
+    REQUIRE(RespondToPoll(t, 1, "C1 81 00 00 02 01 28 01 00 00 00 81") == TimeDuration::Seconds(2));
+    REQUIRE(t.meas->TotalReceived() == 1);
+    AdvanceToNextPoll(t, TimeDuration::Seconds(2));
+}
+
+TEST_CASE(SUITE("Channel bandwidth budget stretches the period"))
+{
+    MasterTestFixture t(NoStartupTasks());
+
+    // the 11 byte request and 4 byte response of each poll take 1.5 seconds of a 10 byte/s budget
+    PollPlannerConfig planner;
+    planner.adaptiveScanBytesPerSecond = 10;
+    t.scheduler->SetPollPlanner(planner);
+
+    auto scan = t.context->AddAdaptiveClassScan(
+        ClassField::AllEventClasses(), AdaptiveScanConfig(TimeDuration::Seconds(1), TimeDuration::Seconds(8)), t.meas);
+    t.context->OnLowerLayerUp();
+    REQUIRE(t.exe->run_many() > 0);
+
+    REQUIRE(RespondToPoll(t, 0, hex::EmptyResponse(0)) == TimeDuration::Seconds(2));
+    AdvanceToNextPoll(t, TimeDuration::Seconds(2));
+    REQUIRE(RespondToPoll(t, 1, hex::EmptyResponse(1, IINField(IINBit::CLASS1_EVENTS)))
+            == TimeDuration::Milliseconds(1500));
+    AdvanceToNextPoll(t, TimeDuration::Milliseconds(1500));
+}
+
+TimeDuration RespondToPoll(MasterTestFixture& t, uint8_t seq, const std::string& response)
+{
+    REQUIRE(t.lower->PopWriteAsHex() == hex::EventPoll(seq));
+    REQUIRE(t.context->OnTxReady());
+    t.SendToMaster(response);
+    REQUIRE(t.exe->run_many() > 0);
+
+    REQUIRE_FALSE(t.application->taskCompletionEvents.empty());
+    REQUIRE(t.application->taskCompletionEvents.back().result == TaskCompletion::SUCCESS);
+    return t.application->taskCompletionEvents.back().period;
+}
+
+void AdvanceToNextPoll(MasterTestFixture& t, const TimeDuration& expected)
+{
+    REQUIRE(t.lower->PopWriteAsHex().empty());
+    REQUIRE(t.exe->next_timer_expiration_abs() - t.exe->get_time() == expected.value);
+    REQUIRE(t.exe->advance_to_next_timer());
+    REQUIRE(t.exe->run_many() > 0);
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "utils/APDUHexBuilders.h"
+#include "utils/MasterTestFixture.h"
+
+#include <catch.hpp>
+
+using namespace opendnp3;
+
+#define SUITE(name) "MasterDecodeOnThreadPoolTestSuite - " name
+
+MasterParams DecodeOnThreadPool(uint32_t maxQueuedFragments = 8);
+void StartIntegrityPoll(MasterTestFixture& t);
+
+TEST_CASE(SUITE("Measurements are delivered on the decode executor"))
+{
+    MasterTestFixture t(DecodeOnThreadPool());
+    t.context->OnLowerLayerUp();
+
+    StartIntegrityPoll(t);
+    t.SendToMaster("C0 81 00 00 1E 01 00 00 01 01 01 00 00 00 01 02 00 00 00");
+    REQUIRE(t.exe->run_many() > 0);
+
+    REQUIRE(t.meas->TotalReceived() == 0);
+
+    REQUIRE(t.decodeExe->run_many() > 0);
+    REQUIRE(t.meas->TotalReceived() == 2);
+}
+
+TEST_CASE(SUITE("Task completion is reported after its measurements are delivered"))
+{
+    MasterTestFixture t(DecodeOnThreadPool());
+    t.context->OnLowerLayerUp();
+
+    StartIntegrityPoll(t);
+    t.SendToMaster("C0 81 00 00 1E 01 00 00 01 01 01 00 00 00 01 02 00 00 00");
+    REQUIRE(t.exe->run_many() > 0);
+    REQUIRE(t.application->taskCompletionEvents.empty());
+
+    REQUIRE(t.decodeExe->run_many() > 0);
+    REQUIRE(t.application->taskCompletionEvents.empty());
+
+    // completion is posted back to the channel strand
+    REQUIRE(t.exe->run_many() > 0);
+    REQUIRE(t.application->taskCompletionEvents.size() == 1);
+    REQUIRE(t.application->taskCompletionEvents.back().result == TaskCompletion::SUCCESS);
+}
+
+TEST_CASE(SUITE("Fragments are delivered in the order they were received"))
+{
+    MasterTestFixture t(DecodeOnThreadPool());
+    t.context->OnLowerLayerUp();
+
+    StartIntegrityPoll(t);
+    t.SendToMaster("A0 81 00 00 1E 01 00 00 00 01 01 00 00 00");
+    t.exe->run_many();
+    REQUIRE(t.lower->PopWriteAsHex() == hex::SolicitedConfirm(0));
+    REQUIRE(t.context->OnTxReady());
+
+    t.SendToMaster("41 81 00 00 1E 01 00 01 01 01 02 00 00 00");
+    t.exe->run_many();
+    REQUIRE(t.meas->TotalReceived() == 0);
+
+    REQUIRE(t.decodeExe->run_many() > 0);
+    REQUIRE(t.meas->TotalReceived() == 2);
+    REQUIRE(t.meas->analogSOE[0].sequence < t.meas->analogSOE[1].sequence);
+}
+
+TEST_CASE(SUITE("Confirms are held back while the decoder is full"))
+{
+    MasterTestFixture t(DecodeOnThreadPool(1));
+    t.context->OnLowerLayerUp();
+
+    StartIntegrityPoll(t);
+    t.SendToMaster("A0 81 00 00 1E 01 00 00 00 01 01 00 00 00");
+    t.exe->run_many();
+    REQUIRE(t.lower->PopWriteAsHex().empty());
+
+    REQUIRE(t.decodeExe->run_many() > 0);
+    REQUIRE(t.exe->run_many() > 0);
+    REQUIRE(t.lower->PopWriteAsHex() == hex::SolicitedConfirm(0));
+}
+
+TEST_CASE(SUITE("Malformed responses fail the task without being queued"))
+{
+    MasterTestFixture t(DecodeOnThreadPool());
+    t.context->OnLowerLayerUp();
+
+    StartIntegrityPoll(t);
+    t.SendToMaster("C0 81 00 00 1E 01 00 00 01 01 01 00");
+    REQUIRE(t.exe->run_many() > 0);
+
+    REQUIRE(t.application->taskCompletionEvents.back().result == TaskCompletion::FAILURE_BAD_RESPONSE);
+    REQUIRE(t.decodeExe->run_many() == 0);
+}
+
+MasterParams DecodeOnThreadPool(uint32_t maxQueuedFragments)
+{
+    auto params = NoStartupTasks();
+    params.decodeOnThreadPool = true;
+    params.maxQueuedDecodeFragments = maxQueuedFragments;
+    return params;
+}
+
+void StartIntegrityPoll(MasterTestFixture& t)
+{
+    t.context->ScanClasses(ClassField::AllClasses(), t.meas);
+    REQUIRE(t.exe->run_many() > 0);
+    REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+    REQUIRE(t.context->OnTxReady());
+}
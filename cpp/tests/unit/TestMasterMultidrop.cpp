@@ -172,6 +172,80 @@ TEST_CASE(SUITE("Scheduler still does integrity polls if exception scan set to h
     ExpectRequestAndRespond(t1, hex::IntegrityPoll(2), hex::EmptyResponse(2));
 }
 
+TEST_CASE(SUITE("Poll planner starts periodic tasks early when the channel is idle"))
+{
+    const auto executor = std::make_shared<exe4cpp::MockExecutor>();
+    const auto scheduler = std::make_shared<MasterSchedulerBackend>(executor);
+    const auto log = std::make_shared<MockLogHandlerImpl>();
+    const auto startTime = executor->get_time();
+
+    scheduler->SetPollPlanner(PollPlannerConfig(TimeDuration::Seconds(5), false));
+
+    MasterTestFixture t1(NoStartupTasks(), Addresses(1, 10), "s1", log, executor, scheduler);
+    MasterTestFixture t2(NoStartupTasks(), Addresses(1, 11), "s2", log, executor, scheduler);
+
+    auto integrity1 = t1.context->AddClassScan(ClassField::AllClasses(), TimeDuration::Seconds(10), t1.meas);
+    auto integrity2 = t2.context->AddClassScan(ClassField::AllClasses(), TimeDuration::Seconds(20), t2.meas);
+
+    t1.context->OnLowerLayerUp();
+    t2.context->OnLowerLayerUp();
+
+    REQUIRE(executor->run_many() > 0);
+
+    ExpectRequestAndRespond(t1, hex::IntegrityPoll(0), hex::EmptyResponse(0));
+    ExpectRequestAndRespond(t2, hex::IntegrityPoll(0), hex::EmptyResponse(0));
+
+    // the channel is idle, so the poll for S1 starts 5 seconds ahead of its 10 second period
+    REQUIRE(executor->advance_to_next_timer());
+    REQUIRE(executor->get_time() - startTime == std::chrono::milliseconds(5000));
+    REQUIRE(executor->run_many() > 0);
+    ExpectRequestAndRespond(t1, hex::IntegrityPoll(1), hex::EmptyResponse(1));
+
+    // and again 10 seconds after it completed, still ahead of the poll for S2 due at t = 20000
+    REQUIRE(executor->advance_to_next_timer());
+    REQUIRE(executor->get_time() - startTime == std::chrono::milliseconds(10000));
+    REQUIRE(executor->run_many() > 0);
+    ExpectRequestAndRespond(t1, hex::IntegrityPoll(2), hex::EmptyResponse(2));
+
+    const auto statistics = scheduler->GetStatistics();
+    REQUIRE(statistics.numTasksStarted == 4);
+    REQUIRE(statistics.numTasksStartedEarly == 2);
+    REQUIRE(statistics.elapsedMicroseconds == 10000000);
+}
+
+TEST_CASE(SUITE("Poll planner interleaves equally urgent tasks of different sessions"))
+{
+    const auto executor = std::make_shared<exe4cpp::MockExecutor>();
+    const auto scheduler = std::make_shared<MasterSchedulerBackend>(executor);
+    const auto log = std::make_shared<MockLogHandlerImpl>();
+
+    scheduler->SetPollPlanner(PollPlannerConfig(TimeDuration::Zero(), true));
+
+    MasterTestFixture t1(NoStartupTasks(), Addresses(1, 10), "s1", log, executor, scheduler);
+    MasterTestFixture t2(NoStartupTasks(), Addresses(1, 11), "s2", log, executor, scheduler);
+
+    auto integrity1 = t1.context->AddClassScan(ClassField::AllClasses(), TimeDuration::Seconds(10), t1.meas);
+    auto event1 = t1.context->AddClassScan(ClassField::AllEventClasses(), TimeDuration::Seconds(10), t1.meas);
+    auto integrity2 = t2.context->AddClassScan(ClassField::AllClasses(), TimeDuration::Seconds(10), t2.meas);
+
+    t1.context->OnLowerLayerUp();
+    t2.context->OnLowerLayerUp();
+
+    REQUIRE(executor->run_many() > 0);
+
+    // all three polls are due together, S2 is served between the two polls of S1
+    ExpectRequestAndRespond(t1, hex::IntegrityPoll(0), hex::EmptyResponse(0));
+    ExpectRequestAndRespond(t2, hex::IntegrityPoll(0), hex::EmptyResponse(0));
+    ExpectRequestAndRespond(t1, hex::EventPoll(1), hex::EmptyResponse(1));
+
+    // S1 was served last, so S2 goes first in the next round
+    REQUIRE(executor->advance_to_next_timer());
+    REQUIRE(executor->run_many() > 0);
+    ExpectRequestAndRespond(t2, hex::IntegrityPoll(1), hex::EmptyResponse(1));
+    ExpectRequestAndRespond(t1, hex::IntegrityPoll(2), hex::EmptyResponse(2));
+    ExpectRequestAndRespond(t1, hex::EventPoll(3), hex::EmptyResponse(3));
+}
+
 void ExpectRequestAndCauseResponseTimeout(MasterTestFixture& session, const std::string& expected)
 {
     REQUIRE(session.lower->PopWriteAsHex() == expected);
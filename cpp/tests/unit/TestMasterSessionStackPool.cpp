@@ -0,0 +1,111 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <catch.hpp>
+#include <MemoryAccount.h>
+#include <master/MasterSessionStackPool.h>
+
+#include <array>
+
+using namespace opendnp3;
+
+#define SUITE(name) "MasterSessionStackPoolTestSuite - " name
+
+struct PooledObject
+{
+    std::array<uint8_t, 256> data;
+};
+
+template<class T> std::shared_ptr<T> CreateFrom(const std::shared_ptr<MasterSessionStackPool>& pool)
+{
+    MemoryScope scope(MemoryAccount::Create(pool));
+    return std::allocate_shared<T>(ResourceAllocator<T>());
+}
+
+TEST_CASE(SUITE("Reuses the block of a destroyed object"))
+{
+    auto pool = std::make_shared<MasterSessionStackPool>(1);
+
+    auto first = CreateFrom<PooledObject>(pool);
+    const void* address = first.get();
+    first.reset();
+
+    REQUIRE(pool->NumRetained() == 1);
+
+    auto second = CreateFrom<PooledObject>(pool);
+    REQUIRE(second.get() == address);
+    REQUIRE(pool->NumRetained() == 0);
+}
+
+TEST_CASE(SUITE("Retains at most capacity blocks of each size"))
+{
+    auto pool = std::make_shared<MasterSessionStackPool>(2);
+
+    std::vector<std::shared_ptr<PooledObject>> objects;
+    for (int i = 0; i < 4; ++i)
+    {
+        objects.push_back(CreateFrom<PooledObject>(pool));
+    }
+
+    objects.clear();
+
+    REQUIRE(pool->NumRetained() == 2);
+}
+
+TEST_CASE(SUITE("Keeps blocks of different sizes apart"))
+{
+    auto pool = std::make_shared<MasterSessionStackPool>(1);
+
+    auto object = CreateFrom<PooledObject>(pool);
+    const void* address = object.get();
+    object.reset();
+
+    // a block of a different size doesn't get the retained one
+    auto other = CreateFrom<std::array<uint8_t, 1024>>(pool);
+    REQUIRE(static_cast<void*>(other.get()) != address);
+    other.reset();
+
+    REQUIRE(pool->NumRetained() == 2);
+    REQUIRE(CreateFrom<PooledObject>(pool).get() == address);
+}
+
+TEST_CASE(SUITE("Containers created in scope draw from the pool"))
+{
+    auto pool = std::make_shared<MasterSessionStackPool>(1);
+
+    {
+        MemoryScope scope(MemoryAccount::Create(pool));
+        std::vector<uint8_t, ResourceAllocator<uint8_t>> buffer(2048);
+    }
+
+    REQUIRE(pool->NumRetained() == 1);
+}
+
+TEST_CASE(SUITE("Objects keep the pool alive"))
+{
+    auto pool = std::make_shared<MasterSessionStackPool>(1);
+    auto object = CreateFrom<PooledObject>(pool);
+
+    std::weak_ptr<MasterSessionStackPool> weak = pool;
+    pool.reset();
+
+    REQUIRE_FALSE(weak.expired());
+    object.reset();
+    REQUIRE(weak.expired());
+}
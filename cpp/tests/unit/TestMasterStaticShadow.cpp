@@ -0,0 +1,212 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "utils/APDUHexBuilders.h"
+#include "utils/MasterTestFixture.h"
+
+#include "dnp3mocks/MockLogHandler.h"
+
+#include <catch.hpp>
+#include <master/MeasurementHandler.h>
+#include <master/ShadowSOEHandler.h>
+
+using namespace opendnp3;
+
+#define SUITE(name) "MasterStaticShadowTestSuite - " name
+
+// g30v1 analogs 0 and 1, both online, with values 1 and 2
+const char* const ANALOGS = "C0 81 00 00 1E 01 00 00 01 01 01 00 00 00 01 02 00 00 00";
+
+MasterParams SuppressUnchanged();
+void Integrity(MasterTestFixture& t, uint8_t seq, const std::string& response);
+std::vector<uint8_t> AnalogObjects(uint16_t count, int32_t changed, uint16_t changeEvery);
+
+TEST_CASE(SUITE("Unchanged static values are suppressed"))
+{
+    MasterTestFixture t(SuppressUnchanged());
+    t.context->OnLowerLayerUp();
+
+    Integrity(t, 0, ANALOGS);
+    REQUIRE(t.meas->TotalReceived() == 2);
+    REQUIRE(t.meas->headers.back().numUnchanged == 0);
+
+    t.meas->Clear();
+    Integrity(t, 1, "C1 81 00 00 1E 01 00 00 01 01 01 00 00 00 01 02 00 00 00");
+    REQUIRE(t.meas->TotalReceived() == 0);
+    REQUIRE(t.meas->headers.size() == 1);
+    REQUIRE(t.meas->headers.back().numUnchanged == 2);
+}
+
+TEST_CASE(SUITE("Only changed values are delivered"))
+{
+    MasterTestFixture t(SuppressUnchanged());
+    t.context->OnLowerLayerUp();
+
+    Integrity(t, 0, ANALOGS);
+    t.meas->Clear();
+
+    // index 1 changes value
+    Integrity(t, 1, "C1 81 00 00 1E 01 00 00 01 01 01 00 00 00 01 03 00 00 00");
+    REQUIRE(t.meas->TotalReceived() == 1);
+    REQUIRE(t.meas->analogSOE[1].meas.value == 3);
+    REQUIRE(t.meas->analogSOE[1].info.numUnchanged == 1);
+    t.meas->Clear();
+
+    // index 0 changes flags only
+    Integrity(t, 2, "C2 81 00 00 1E 01 00 00 01 03 01 00 00 00 01 03 00 00 00");
+    REQUIRE(t.meas->TotalReceived() == 1);
+    REQUIRE(t.meas->analogSOE[0].meas.flags.value == 0x03);
+}
+
+TEST_CASE(SUITE("Events are never suppressed"))
+{
+    MasterTestFixture t(SuppressUnchanged());
+    t.context->OnLowerLayerUp();
+
+    Integrity(t, 0, "C0 81 00 00 20 01 28 01 00 00 00 01 01 00 00 00");
+    Integrity(t, 1, "C1 81 00 00 20 01 28 01 00 00 00 01 01 00 00 00");
+    REQUIRE(t.meas->TotalReceived() == 2);
+}
+
+TEST_CASE(SUITE("Static value is delivered when it differs from the last event"))
+{
+    MasterTestFixture t(SuppressUnchanged());
+    t.context->OnLowerLayerUp();
+
+    Integrity(t, 0, ANALOGS);
+
+    // g32v1 event for index 0 with value 5
+    Integrity(t, 1, "C1 81 00 00 20 01 28 01 00 00 00 01 05 00 00 00");
+    t.meas->Clear();
+
+    // the event back to 1 was lost, the integrity poll has to restore it even though the last static value was 1
+    Integrity(t, 2, "C2 81 00 00 1E 01 00 00 01 01 01 00 00 00 01 02 00 00 00");
+    REQUIRE(t.meas->TotalReceived() == 1);
+    REQUIRE(t.meas->analogSOE[0].meas.value == 1);
+    REQUIRE(t.meas->analogSOE[0].info.numUnchanged == 1);
+}
+
+TEST_CASE(SUITE("Static value equal to the last event is suppressed"))
+{
+    MasterTestFixture t(SuppressUnchanged());
+    t.context->OnLowerLayerUp();
+
+    Integrity(t, 0, ANALOGS);
+    Integrity(t, 1, "C1 81 00 00 20 01 28 01 00 00 00 01 05 00 00 00");
+    t.meas->Clear();
+
+    Integrity(t, 2, "C2 81 00 00 1E 01 00 00 01 01 05 00 00 00 01 02 00 00 00");
+    REQUIRE(t.meas->TotalReceived() == 0);
+    REQUIRE(t.meas->headers.back().numUnchanged == 2);
+}
+
+TEST_CASE(SUITE("Shadow is cleared when the link is lost"))
+{
+    MasterTestFixture t(SuppressUnchanged());
+    t.context->OnLowerLayerUp();
+
+    Integrity(t, 0, ANALOGS);
+    t.meas->Clear();
+
+    t.context->OnLowerLayerDown();
+    t.context->OnLowerLayerUp();
+
+    Integrity(t, 0, ANALOGS);
+    REQUIRE(t.meas->TotalReceived() == 2);
+}
+
+TEST_CASE(SUITE("All values are delivered by default"))
+{
+    MasterTestFixture t(NoStartupTasks());
+    t.context->OnLowerLayerUp();
+
+    Integrity(t, 0, ANALOGS);
+    Integrity(t, 1, "C1 81 00 00 1E 01 00 00 01 01 01 00 00 00 01 02 00 00 00");
+    REQUIRE(t.meas->TotalReceived() == 4);
+}
+
+TEST_CASE(SUITE("Only the changed values of a large integrity poll are delivered"))
+{
+    const uint16_t NUM_POINTS = 1000;
+    const int NUM_POLLS = 5;
+
+    MockLogHandler log;
+    auto deliver = [&](ISOEHandler& handler) {
+        for (int poll = 0; poll < NUM_POLLS; ++poll)
+        {
+            // a different 1% of the points changes on every poll
+            const auto objects = AnalogObjects(NUM_POINTS, poll, 100);
+            REQUIRE(MeasurementHandler::ProcessMeasurements(ResponseInfo(false, true, true),
+                                                            ser4cpp::rseq_t(objects.data(), objects.size()),
+                                                            log.logger, &handler)
+                    == ParseResult::OK);
+        }
+    };
+
+    auto all = std::make_shared<MockSOEHandler>();
+    deliver(*all);
+
+    auto changed = std::make_shared<MockSOEHandler>();
+    ShadowSOEHandler shadow(std::make_shared<StaticShadowTable>(), changed);
+    deliver(shadow);
+
+    REQUIRE(all->TotalReceived() == NUM_POLLS * NUM_POINTS);
+    // the first poll fills the shadow, after which only the 1% that changed and the 1% that changed back are new
+    REQUIRE(changed->TotalReceived() == NUM_POINTS + (NUM_POLLS - 1) * 2 * (NUM_POINTS / 100));
+    REQUIRE(changed->headers.back().numUnchanged == NUM_POINTS - 2 * (NUM_POINTS / 100));
+}
+
+MasterParams SuppressUnchanged()
+{
+    auto params = NoStartupTasks();
+    params.suppressUnchangedStaticValues = true;
+    return params;
+}
+
+void Integrity(MasterTestFixture& t, uint8_t seq, const std::string& response)
+{
+    t.context->ScanClasses(ClassField::AllClasses(), t.meas);
+    REQUIRE(t.exe->run_many() > 0);
+    REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(seq));
+    REQUIRE(t.context->OnTxReady());
+    t.SendToMaster(response);
+    REQUIRE(t.exe->run_many() > 0);
+    REQUIRE(t.application->taskCompletionEvents.back().result == TaskCompletion::SUCCESS);
+}
+
+std::vector<uint8_t> AnalogObjects(uint16_t count, int32_t changed, uint16_t changeEvery)
+{
+    // g30v1 with a 16-bit start/stop range
+    const uint16_t stop = count - 1;
+    std::vector<uint8_t> objects{0x1E, 0x01, 0x01, 0x00, 0x00, static_cast<uint8_t>(stop & 0xFF),
+                                 static_cast<uint8_t>(stop >> 8)};
+
+    for (uint16_t i = 0; i < count; ++i)
+    {
+        // every changeEvery-th point offset by the poll number reports a new value
+        const auto value = ((i % changeEvery) == (changed % changeEvery)) ? changed + 1 : 0;
+        objects.push_back(0x01);
+        for (int shift = 0; shift < 32; shift += 8)
+        {
+            objects.push_back(static_cast<uint8_t>((value >> shift) & 0xFF));
+        }
+    }
+
+    return objects;
+}
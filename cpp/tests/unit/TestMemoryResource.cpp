@@ -0,0 +1,142 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <MemoryAccount.h>
+#include <outstation/event/List.h>
+
+#include <opendnp3/util/MonotonicMemoryResource.h>
+
+#include <catch.hpp>
+
+#include <cstdint>
+#include <map>
+#include <new>
+#include <vector>
+
+using namespace opendnp3;
+
+#define SUITE(name) "MemoryResourceTestSuite - " name
+
+TEST_CASE(SUITE("monotonic resource aligns allocations"))
+{
+    MonotonicMemoryResource resource(256);
+
+    auto a = resource.Allocate(1, 1);
+    auto b = resource.Allocate(8, 8);
+    auto c = resource.Allocate(3, 16);
+
+    REQUIRE(reinterpret_cast<std::uintptr_t>(b) % 8 == 0);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(c) % 16 == 0);
+    REQUIRE(static_cast<uint8_t*>(a) < static_cast<uint8_t*>(b));
+    REQUIRE(static_cast<uint8_t*>(b) < static_cast<uint8_t*>(c));
+    REQUIRE(resource.NumAllocatedBytes() <= resource.Capacity());
+}
+
+TEST_CASE(SUITE("monotonic resource throws when exhausted"))
+{
+    MonotonicMemoryResource resource(64);
+
+    resource.Allocate(64, 1);
+    REQUIRE(resource.NumAllocatedBytes() == 64);
+    REQUIRE_THROWS_AS(resource.Allocate(1, 1), std::bad_alloc);
+
+    // deallocation never frees space
+    resource.Deallocate(nullptr, 64, 1);
+    REQUIRE_THROWS_AS(resource.Allocate(1, 1), std::bad_alloc);
+}
+
+TEST_CASE(SUITE("allocators use the global heap outside of a scope"))
+{
+    REQUIRE_FALSE(MemoryScope::Current());
+
+    std::vector<int, ResourceAllocator<int>> values(100);
+    REQUIRE(values.size() == 100);
+}
+
+TEST_CASE(SUITE("scopes nest and restore the previous account"))
+{
+    auto resource = std::make_shared<MonotonicMemoryResource>(1024);
+    auto outer = MemoryAccount::Create(resource);
+    auto inner = MemoryAccount::Create(resource);
+
+    {
+        MemoryScope scope1(outer);
+        REQUIRE(MemoryScope::Current() == outer);
+        {
+            MemoryScope scope2(inner);
+            REQUIRE(MemoryScope::Current() == inner);
+        }
+        REQUIRE(MemoryScope::Current() == outer);
+    }
+
+    REQUIRE_FALSE(MemoryScope::Current());
+}
+
+TEST_CASE(SUITE("containers keep drawing from the account they were constructed in"))
+{
+    auto resource = std::make_shared<MonotonicMemoryResource>(64 * 1024);
+    auto account = MemoryAccount::Create(resource);
+
+    using map_t = std::map<uint16_t, int, std::less<uint16_t>, ResourceAllocator<std::pair<const uint16_t, int>>>;
+
+    std::unique_ptr<map_t> map;
+
+    {
+        MemoryScope scope(account);
+        map.reset(new map_t());
+    }
+
+    REQUIRE(account->NumAllocatedBytes() == 0);
+
+    // inserted outside of the scope
+    for (uint16_t i = 0; i < 10; ++i)
+    {
+        (*map)[i] = i;
+    }
+
+    const auto used = account->NumAllocatedBytes();
+    REQUIRE(used > 0);
+    REQUIRE(resource->NumAllocatedBytes() >= used);
+
+    map.reset();
+    REQUIRE(account->NumAllocatedBytes() == 0);
+}
+
+TEST_CASE(SUITE("event list storage comes from the arena"))
+{
+    auto resource = std::make_shared<MonotonicMemoryResource>(64 * 1024);
+    auto account = MemoryAccount::Create(resource);
+
+    MemoryScope scope(account);
+    List<uint32_t> list(100);
+
+    REQUIRE(list.Capacity() == 100);
+    REQUIRE(account->NumAllocatedBytes() >= 100 * sizeof(Node<uint32_t>));
+
+    const auto before = resource->NumAllocatedBytes();
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        REQUIRE(list.Add(i));
+    }
+    list.RemoveAll([](uint32_t value) { return value % 2 == 0; });
+
+    // the list never allocates after construction
+    REQUIRE(resource->NumAllocatedBytes() == before);
+    REQUIRE(list.length() == 50);
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <app/OctetStringPool.h>
+
+#include <opendnp3/app/OctetString.h>
+
+#include <catch.hpp>
+
+#include <string>
+
+using namespace opendnp3;
+
+#define SUITE(name) "OctetStringTestSuite - " name
+
+namespace
+{
+const static size_t MAX_SIZE = OctetData::MAX_SIZE;
+
+std::string ToString(const OctetString& value)
+{
+    const auto buffer = value.ToBuffer();
+    return std::string(reinterpret_cast<const char*>(buffer.data), buffer.length);
+}
+} // namespace
+
+TEST_CASE(SUITE("DefaultValueIsSingleZeroByte"))
+{
+    OctetString value;
+    REQUIRE(value.Size() == 1);
+    REQUIRE(value.ToBuffer().data[0] == 0x00);
+}
+
+TEST_CASE(SUITE("EmptyInputHasDefaultValue"))
+{
+    OctetString value("");
+    REQUIRE(value.Size() == 1);
+    REQUIRE(value.ToBuffer().data[0] == 0x00);
+}
+
+TEST_CASE(SUITE("OversizedInputIsTruncated"))
+{
+    const std::string input(300, 'a');
+    const Buffer buffer(reinterpret_cast<const uint8_t*>(input.data()), input.size());
+    OctetString value(buffer);
+    REQUIRE(value.Size() == MAX_SIZE);
+    REQUIRE(!value.Set(buffer));
+    REQUIRE(value.Size() == MAX_SIZE);
+}
+
+TEST_CASE(SUITE("CopiesShareStorageUntilModified"))
+{
+    OctetString original("hello");
+    OctetString copy(original);
+    REQUIRE(copy.ToBuffer().data == original.ToBuffer().data);
+
+    REQUIRE(copy.Set("world"));
+    REQUIRE(ToString(original) == "hello");
+    REQUIRE(ToString(copy) == "world");
+}
+
+TEST_CASE(SUITE("SetToEmptyClearsTheValue"))
+{
+    OctetString value("hello");
+    REQUIRE(!value.Set(""));
+    REQUIRE(value.Size() == 0);
+}
+
+TEST_CASE(SUITE("PoolUsageScalesWithLength"))
+{
+    const auto before = OctetStringPool::NumUsedBytes();
+
+    {
+        OctetString small("12345678");
+        const auto usedBySmall = OctetStringPool::NumUsedBytes() - before;
+        REQUIRE(usedBySmall <= 16);
+
+        OctetString copy = small;
+        REQUIRE(OctetStringPool::NumUsedBytes() - before == usedBySmall);
+
+        const std::string input(200, 'a');
+        OctetString large(input.c_str());
+        REQUIRE(OctetStringPool::NumUsedBytes() - before > 200);
+    }
+
+    REQUIRE(OctetStringPool::NumUsedBytes() == before);
+}
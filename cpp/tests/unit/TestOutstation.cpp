@@ -365,6 +365,67 @@ TEST_CASE(SUITE("ReadClass0MultiFragAnalog"))
     REQUIRE(t.lower->PopWriteAsHex().empty());
 }
 
+TEST_CASE(SUITE("ReadClass0MultiFragReportsValuesAtTimeOfRequest"))
+{
+    OutstationConfig config;
+    config.params.maxTxFragSize = 20;
+    OutstationTestObject t(config, configure::by_count_of::analog_input(4));
+    t.LowerLayerUp();
+
+    t.SendToOutstation("C0 01 3C 01 06"); // Read class 0
+    REQUIRE(t.lower->PopWriteAsHex() == "A0 81 80 00 1E 01 00 00 01 02 00 00 00 00 02 00 00 00 00");
+    t.OnTxReady();
+
+    // updates made while the response is in progress are not part of it
+    t.Transaction([](IUpdateHandler& db) { db.Update(Analog(7, Flags(0x01)), 3, EventMode::Suppress); });
+
+    t.SendToOutstation("C0 00");
+    REQUIRE(t.lower->PopWriteAsHex() == "41 81 80 00 1E 01 00 02 03 02 00 00 00 00 02 00 00 00 00");
+    t.OnTxReady();
+    t.SendToOutstation("C1 00");
+
+    t.SendToOutstation("C2 01 3C 01 06"); // Read class 0
+    REQUIRE(t.lower->PopWriteAsHex() == "A2 81 80 00 1E 01 00 00 01 02 00 00 00 00 02 00 00 00 00");
+    t.OnTxReady();
+    t.SendToOutstation("C2 00");
+    REQUIRE(t.lower->PopWriteAsHex() == "43 81 80 00 1E 01 00 02 03 02 00 00 00 00 01 07 00 00 00");
+}
+
+TEST_CASE(SUITE("ReadClass0WithSpecificVariation"))
+{
+    OutstationConfig config;
+    OutstationTestObject t(config, configure::by_count_of::analog_input(3));
+    t.LowerLayerUp();
+
+    t.Transaction([](IUpdateHandler& db) {
+        for (uint16_t i = 0; i < 3; i++)
+        {
+            db.Update(Analog(i, Flags(0x01)), i);
+        }
+    });
+
+    // class 0 with index 1 requested as 30/2
+    t.SendToOutstation("C0 01 3C 01 06 1E 02 00 01 01");
+    REQUIRE(t.lower->PopWriteAsHex()
+            == "C0 81 80 00 1E 01 00 00 00 01 00 00 00 00 1E 02 00 01 01 01 01 00 1E 01 00 02 02 01 02 00 00 00");
+}
+
+TEST_CASE(SUITE("ReadClass0LargeFragment"))
+{
+    OutstationConfig config;
+    config.params.maxTxFragSize = 65536;
+    OutstationTestObject t(config, configure::by_count_of::analog_input(10000));
+    t.LowerLayerUp();
+
+    t.SendToOutstation("C0 01 3C 01 06"); // Read class 0
+
+    // all 10000 (30,1) values fit in a single unconfirmed fragment
+    const auto response = t.lower->PopWriteAsHex();
+    const std::string header("C0 81 80 00 1E 01 01 00 00 0F 27");
+    REQUIRE(response.substr(0, header.size()) == header);
+    REQUIRE(response.size() == (4 + 3 + 4 + 10000 * 5) * 3 - 1);
+}
+
 TEST_CASE(SUITE("ReadFuncNotSupported"))
 {
     OutstationConfig config;
@@ -549,6 +610,36 @@ TEST_CASE(SUITE("ReadGrp1Var1"))
     REQUIRE(t.lower->PopWriteAsHex() == "C0 81 80 00 01 01 00 00 09 00 00");
 }
 
+TEST_CASE(SUITE("ReadGrp1Var1MultiFrag"))
+{
+    OutstationConfig cfg;
+    cfg.params.maxTxFragSize = 11; // room for 16 bits per fragment
+    DatabaseConfig database = configure::by_count_of::binary_input(20);
+
+    for (auto& item : database.binary_input)
+    {
+        item.second.svariation = StaticBinaryVariation::Group1Var1;
+    }
+
+    OutstationTestObject t(cfg, std::move(database));
+
+    t.Transaction([](IUpdateHandler& handler) {
+        for (uint16_t i = 0; i < 20; ++i)
+        {
+            handler.Update(Binary((i % 2) == 0, Flags(0x01)), i);
+        }
+    });
+
+    t.LowerLayerUp();
+
+    t.SendToOutstation("C0 01 3C 01 06"); // Read class 0
+
+    REQUIRE(t.lower->PopWriteAsHex() == "A0 81 80 00 01 01 00 00 0F 55 55");
+    t.OnTxReady();
+    t.SendToOutstation("C0 00");
+    REQUIRE(t.lower->PopWriteAsHex() == "41 81 80 00 01 01 00 10 13 05");
+}
+
 TEST_CASE(SUITE("Group1Var1 is promoted to Group1Var2 if quality not online"))
 {
     DatabaseConfig database = configure::by_count_of::binary_input(2);
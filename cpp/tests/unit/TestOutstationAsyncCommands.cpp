@@ -0,0 +1,181 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "utils/OutstationTestObject.h"
+
+#include <catch.hpp>
+
+using namespace opendnp3;
+
+#define SUITE(name) "OutstationAsyncCommandsTestSuite - " name
+
+TEST_CASE(SUITE("DirectOperateRespondsWhenCommandCompletes"))
+{
+    OutstationConfig config;
+    auto handler = std::make_shared<MockAsyncCommandHandler>();
+    OutstationTestObject t(config, DatabaseConfig(), handler);
+    t.LowerLayerUp();
+
+    // direct operate group 41 var 2, count = 1, index = 3
+    t.SendToOutstation("C1 05 29 02 17 01 03 00 00 00");
+    REQUIRE(t.lower->HasNoData());
+    REQUIRE(handler->operates.size() == 1);
+    REQUIRE(handler->operates[0].index == 3);
+    REQUIRE(handler->operates[0].opType == OperateType::DirectOperate);
+    REQUIRE(handler->numBegin == 1);
+    REQUIRE(handler->numEnd == 1);
+
+    REQUIRE(handler->operates[0].completion.Complete(CommandStatus::SUCCESS));
+    REQUIRE(t.lower->HasNoData()); // completions are posted to the outstation's executor
+    t.RunPending();
+    REQUIRE(t.lower->PopWriteAsHex() == "C1 81 80 00 29 02 17 01 03 00 00 00");
+}
+
+TEST_CASE(SUITE("ResponseWaitsForEveryCommandAndEchoesTheirStatus"))
+{
+    OutstationConfig config;
+    auto handler = std::make_shared<MockAsyncCommandHandler>();
+    OutstationTestObject t(config, DatabaseConfig(), handler);
+    t.LowerLayerUp();
+
+    // direct operate group 41 var 2, count = 2, index = 3 & 4
+    t.SendToOutstation("C1 05 29 02 17 02 03 00 00 00 04 00 00 00");
+    REQUIRE(handler->operates.size() == 2);
+
+    // complete out of order
+    handler->operates[1].completion.Complete(CommandStatus::HARDWARE_ERROR);
+    t.RunPending();
+    REQUIRE(t.lower->HasNoData());
+
+    handler->operates[0].completion.Complete(CommandStatus::SUCCESS);
+    t.RunPending();
+    REQUIRE(t.lower->PopWriteAsHex() == "C1 81 80 00 29 02 17 02 03 00 00 00 04 00 00 06"); // 0x06 == HARDWARE_ERROR
+}
+
+TEST_CASE(SUITE("OutstandingCommandsTimeOut"))
+{
+    OutstationConfig config;
+    auto handler = std::make_shared<MockAsyncCommandHandler>();
+    OutstationTestObject t(config, DatabaseConfig(), handler);
+    t.LowerLayerUp();
+
+    t.SendToOutstation("C1 05 29 02 17 02 03 00 00 00 04 00 00 00");
+    REQUIRE(handler->operates.size() == 2);
+    handler->operates[0].completion.Complete(CommandStatus::SUCCESS);
+    t.RunPending();
+    REQUIRE(t.lower->HasNoData());
+
+    t.AdvanceTime(config.params.commandResponseTimeout);
+    REQUIRE(t.lower->PopWriteAsHex() == "C1 81 80 00 29 02 17 02 03 00 00 00 04 00 00 01"); // 0x01 == TIMEOUT
+
+    // the late completion is ignored
+    t.OnTxReady();
+    REQUIRE(handler->operates[1].completion.Complete(CommandStatus::SUCCESS));
+    t.RunPending();
+    REQUIRE(t.lower->HasNoData());
+}
+
+TEST_CASE(SUITE("RequestsAreDeferredUntilCommandsComplete"))
+{
+    OutstationConfig config;
+    auto handler = std::make_shared<MockAsyncCommandHandler>();
+    OutstationTestObject t(config, DatabaseConfig(), handler);
+    t.LowerLayerUp();
+
+    t.SendToOutstation("C1 05 29 02 17 01 03 00 00 00");
+    t.SendToOutstation("C2 01 3C 01 06"); // read class 0
+    REQUIRE(t.lower->HasNoData());
+
+    handler->operates[0].completion.Complete(CommandStatus::SUCCESS);
+    t.RunPending();
+    REQUIRE(t.lower->PopWriteAsHex() == "C1 81 80 00 29 02 17 01 03 00 00 00");
+    t.OnTxReady();
+    REQUIRE(t.lower->PopWriteAsHex() == "C2 81 80 00");
+}
+
+TEST_CASE(SUITE("SelectIsSynchronousAndOperateIsAsynchronous"))
+{
+    OutstationConfig config;
+    auto handler = std::make_shared<MockAsyncCommandHandler>();
+    OutstationTestObject t(config, DatabaseConfig(), handler);
+    t.LowerLayerUp();
+
+    // select group 12 var 1, count = 1, index = 3
+    t.SendToOutstation("C0 03 0C 01 17 01 03 01 01 01 00 00 00 01 00 00 00 00");
+    REQUIRE(t.lower->PopWriteAsHex() == "C0 81 80 00 0C 01 17 01 03 01 01 01 00 00 00 01 00 00 00 00");
+    REQUIRE(handler->numSelect == 1);
+    t.OnTxReady();
+
+    t.SendToOutstation("C1 04 0C 01 17 01 03 01 01 01 00 00 00 01 00 00 00 00");
+    REQUIRE(t.lower->HasNoData());
+    REQUIRE(handler->operates.size() == 1);
+    REQUIRE(handler->operates[0].opType == OperateType::SelectBeforeOperate);
+
+    handler->operates[0].completion.Complete(CommandStatus::SUCCESS);
+    t.RunPending();
+    REQUIRE(t.lower->PopWriteAsHex() == "C1 81 80 00 0C 01 17 01 03 01 01 01 00 00 00 01 00 00 00 00");
+}
+
+TEST_CASE(SUITE("OperateWithoutSelectIsAnsweredImmediately"))
+{
+    OutstationConfig config;
+    auto handler = std::make_shared<MockAsyncCommandHandler>();
+    OutstationTestObject t(config, DatabaseConfig(), handler);
+    t.LowerLayerUp();
+
+    t.SendToOutstation("C1 04 0C 01 17 01 03 01 01 01 00 00 00 01 00 00 00 00");
+    REQUIRE(t.lower->PopWriteAsHex() == "C1 81 80 00 0C 01 17 01 03 01 01 01 00 00 00 01 00 00 00 02"); // NO_SELECT
+    REQUIRE(handler->operates.empty());
+}
+
+TEST_CASE(SUITE("DirectOperateNoAckIgnoresCompletion"))
+{
+    OutstationConfig config;
+    auto handler = std::make_shared<MockAsyncCommandHandler>();
+    OutstationTestObject t(config, DatabaseConfig(), handler);
+    t.LowerLayerUp();
+
+    t.SendToOutstation("C1 06 29 02 17 01 03 00 00 00");
+    REQUIRE(handler->operates.size() == 1);
+    REQUIRE(handler->operates[0].opType == OperateType::DirectOperateNoAck);
+    REQUIRE_FALSE(handler->operates[0].completion.Complete(CommandStatus::SUCCESS));
+    t.RunPending();
+    REQUIRE(t.lower->HasNoData());
+}
+
+TEST_CASE(SUITE("CompletionAfterLowerLayerDownIsIgnored"))
+{
+    OutstationConfig config;
+    auto handler = std::make_shared<MockAsyncCommandHandler>();
+    OutstationTestObject t(config, DatabaseConfig(), handler);
+    t.LowerLayerUp();
+
+    t.SendToOutstation("C1 05 29 02 17 01 03 00 00 00");
+    REQUIRE(handler->operates.size() == 1);
+    t.LowerLayerDown();
+    t.LowerLayerUp();
+
+    handler->operates[0].completion.Complete(CommandStatus::SUCCESS);
+    t.RunPending();
+    REQUIRE(t.lower->HasNoData());
+
+    // the outstation isn't blocked by the abandoned request
+    t.SendToOutstation("C2 01 3C 01 06");
+    REQUIRE(t.lower->PopWriteAsHex() == "C2 81 80 00");
+}
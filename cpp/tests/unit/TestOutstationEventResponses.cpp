@@ -437,6 +437,86 @@ TEST_CASE(SUITE("ReadGrp2Var3TwoValuesWithDifferentInvalidOrUnsynchronizedAreRep
     TestEventRead("C0 01 02 03 06", rsp, update);
 }
 
+TEST_CASE(SUITE("ReadClass1WithRelativeTimeEvents"))
+{
+    OutstationConfig config;
+    config.params.useRelativeTimeEvents = true;
+    config.eventBufferConfig = EventBufferConfig::AllTypes(10);
+    auto database = configure::by_count_of::all_types(5);
+    database.binary_input[3].evariation = EventBinaryVariation::Group2Var2;
+    database.binary_input[4].evariation = EventBinaryVariation::Group2Var2;
+    database.double_binary[0].evariation = EventDoubleBinaryVariation::Group4Var2;
+    OutstationTestObject t(config, std::move(database));
+    t.LowerLayerUp();
+
+    t.Transaction([](IUpdateHandler& db) {
+        db.Update(Binary(false, Flags(0x01), DNPTime(0x4571, TimestampQuality::SYNCHRONIZED)), 3);
+        db.Update(Binary(true, Flags(0x01), DNPTime(0x4579, TimestampQuality::SYNCHRONIZED)), 4);
+        const DNPTime time(0x4580, TimestampQuality::SYNCHRONIZED);
+        db.Update(DoubleBitBinary(DoubleBit::DETERMINED_ON, Flags(0x01), time), 0);
+    });
+
+    t.SendToOutstation("C0 01 3C 02 06"); // Read class 1
+    REQUIRE(t.lower->PopWriteAsHex()
+            == "E0 81 80 00 33 01 07 01 71 45 00 00 00 00 02 03 28 02 00 03 00 01 00 00 04 00 81 08 00 "
+               "33 01 07 01 80 45 00 00 00 00 04 03 28 01 00 00 00 81 00 00");
+}
+
+TEST_CASE(SUITE("ReadGrp2Var2WithRelativeTimeEvents"))
+{
+    OutstationConfig config;
+    config.params.useRelativeTimeEvents = true;
+    config.eventBufferConfig = EventBufferConfig::AllTypes(10);
+    auto database = configure::by_count_of::all_types(5);
+    database.binary_input[3].evariation = EventBinaryVariation::Group2Var2;
+    OutstationTestObject t(config, std::move(database));
+    t.LowerLayerUp();
+
+    t.Transaction([](IUpdateHandler& db) { db.Update(Binary(false, Flags(0x01), DNPTime(0x4571)), 3); });
+
+    // a specific variation is still reported with absolute time
+    t.SendToOutstation("C0 01 02 02 06");
+    REQUIRE(t.lower->PopWriteAsHex() == "E0 81 80 00 02 02 28 01 00 03 00 01 71 45 00 00 00 00");
+}
+
+size_t Class1ResponseSizeForBinaryEvents(bool useRelativeTimeEvents, uint16_t num)
+{
+    OutstationConfig config;
+    config.params.useRelativeTimeEvents = useRelativeTimeEvents;
+    config.eventBufferConfig = EventBufferConfig::AllTypes(num);
+    auto database = configure::by_count_of::binary_input(num);
+    for (auto& point : database.binary_input)
+    {
+        point.second.evariation = EventBinaryVariation::Group2Var2;
+    }
+    OutstationTestObject t(config, std::move(database));
+    t.LowerLayerUp();
+
+    t.Transaction([num](IUpdateHandler& db) {
+        for (uint16_t i = 0; i < num; ++i)
+        {
+            db.Update(Binary(true, Flags(0x01), DNPTime(1512595515000 + 10 * i, TimestampQuality::SYNCHRONIZED)), i);
+        }
+    });
+
+    t.SendToOutstation("C0 01 3C 02 06"); // Read class 1
+    const auto rsp = t.lower->PopWriteAsHex();
+    REQUIRE(rsp.substr(0, 11) == "E0 81 80 00");
+    return (rsp.size() + 1) / 3;
+}
+
+TEST_CASE(SUITE("RelativeTimeEventsUseFewerBytesPerEvent"))
+{
+    const uint16_t NUM_EVENTS = 100;
+
+    const auto absoluteSize = Class1ResponseSizeForBinaryEvents(false, NUM_EVENTS);
+    const auto relativeSize = Class1ResponseSizeForBinaryEvents(true, NUM_EVENTS);
+
+    // header + 9 bytes per 2/2 event vs header + CTO + 5 bytes per 2/3 event
+    REQUIRE(absoluteSize == 4 + 5 + 9 * NUM_EVENTS);
+    REQUIRE(relativeSize == 4 + 10 + 5 + 5 * NUM_EVENTS);
+}
+
 TEST_CASE(SUITE("reports octet string events w/ same size in same header"))
 {
     OutstationConfig config;
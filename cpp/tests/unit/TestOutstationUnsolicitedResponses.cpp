@@ -353,6 +353,82 @@ TEST_CASE(SUITE("UnsolMultiFragments"))
     REQUIRE(t.lower->PopWriteAsHex().empty());
 }
 
+TEST_CASE(SUITE("UnsolBatchHoldTime"))
+{
+    OutstationConfig cfg;
+    cfg.params.allowUnsolicited = true;
+    cfg.params.unsolClassMask = ClassField::AllEventClasses();
+    cfg.params.unsolBatchPolicy = UnsolicitedBatchPolicy::AllClasses(TimeDuration::Seconds(1), 0);
+    cfg.eventBufferConfig = EventBufferConfig(5);
+    OutstationTestObject t(cfg, configure::by_count_of::binary_input(5));
+
+    t.LowerLayerUp();
+    REQUIRE(t.lower->PopWriteAsHex() == hex::NullUnsolicited(0));
+    t.OnTxReady();
+    t.SendToOutstation(hex::UnsolConfirm(0));
+
+    t.Transaction([](IUpdateHandler& db) { db.Update(Binary(true, Flags(0x01)), 0); });
+    REQUIRE(t.lower->PopWriteAsHex().empty());
+
+    t.AdvanceTime(TimeDuration::Milliseconds(500));
+    t.Transaction([](IUpdateHandler& db) { db.Update(Binary(false, Flags(0x01)), 0); });
+    REQUIRE(t.lower->PopWriteAsHex().empty());
+
+    // the hold time runs from the first event, both are reported together
+    t.AdvanceTime(TimeDuration::Milliseconds(500));
+    REQUIRE(t.lower->PopWriteAsHex() == "F1 82 80 00 02 01 28 02 00 00 00 81 00 00 01");
+    t.OnTxReady();
+    t.SendToOutstation(hex::UnsolConfirm(1));
+
+    REQUIRE(t.lower->PopWriteAsHex().empty());
+    REQUIRE(t.NumPendingTimers() == 0);
+}
+
+TEST_CASE(SUITE("UnsolBatchEventCount"))
+{
+    OutstationConfig cfg;
+    cfg.params.allowUnsolicited = true;
+    cfg.params.unsolClassMask = ClassField::AllEventClasses();
+    cfg.params.unsolBatchPolicy = UnsolicitedBatchPolicy::AllClasses(TimeDuration::Seconds(10), 3);
+    cfg.eventBufferConfig = EventBufferConfig(5);
+    OutstationTestObject t(cfg, configure::by_count_of::binary_input(5));
+
+    t.LowerLayerUp();
+    REQUIRE(t.lower->PopWriteAsHex() == hex::NullUnsolicited(0));
+    t.OnTxReady();
+    t.SendToOutstation(hex::UnsolConfirm(0));
+
+    t.Transaction([](IUpdateHandler& db) { db.Update(Binary(true, Flags(0x01)), 0); });
+    t.Transaction([](IUpdateHandler& db) { db.Update(Binary(true, Flags(0x01)), 1); });
+    REQUIRE(t.lower->PopWriteAsHex().empty());
+
+    t.Transaction([](IUpdateHandler& db) { db.Update(Binary(true, Flags(0x01)), 2); });
+    REQUIRE(t.lower->PopWriteAsHex() == "F1 82 80 00 02 01 28 03 00 00 00 81 01 00 81 02 00 81");
+    REQUIRE(t.NumPendingTimers() == 1); // only the confirm timer
+}
+
+TEST_CASE(SUITE("UnsolBatchByteThreshold"))
+{
+    OutstationConfig cfg;
+    cfg.params.allowUnsolicited = true;
+    cfg.params.unsolClassMask = ClassField::AllEventClasses();
+    // a fragment with two binary events is 15 bytes long
+    cfg.params.unsolBatchPolicy = UnsolicitedBatchPolicy::AllClasses(TimeDuration::Seconds(10), 0, 15);
+    cfg.eventBufferConfig = EventBufferConfig(5);
+    OutstationTestObject t(cfg, configure::by_count_of::binary_input(5));
+
+    t.LowerLayerUp();
+    REQUIRE(t.lower->PopWriteAsHex() == hex::NullUnsolicited(0));
+    t.OnTxReady();
+    t.SendToOutstation(hex::UnsolConfirm(0));
+
+    t.Transaction([](IUpdateHandler& db) { db.Update(Binary(true, Flags(0x01)), 3); });
+    REQUIRE(t.lower->PopWriteAsHex().empty());
+
+    t.Transaction([](IUpdateHandler& db) { db.Update(Binary(false, Flags(0x01)), 4); });
+    REQUIRE(t.lower->PopWriteAsHex() == "F1 82 80 00 02 01 28 02 00 03 00 81 04 00 01");
+}
+
 void WriteDuringUnsol(bool beforeTx)
 {
     OutstationConfig cfg;
@@ -0,0 +1,215 @@
+/*
+ * Copyright 2013-2020 Automatak, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Automatak
+ * LLC (www.automatak.com) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Automatak LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <MemoryAccount.h>
+#include <channel/RouteTable.h>
+
+#include <opendnp3/util/MonotonicMemoryResource.h>
+
+#include <catch.hpp>
+
+#include <new>
+#include <vector>
+
+using namespace opendnp3;
+
+#define SUITE(name) "RouteTableTestSuite - " name
+
+namespace
+{
+class NullSession final : public ILinkSession
+{
+public:
+    bool OnFrame(const LinkHeaderFields& /*header*/, const ser4cpp::rseq_t& /*userdata*/) final
+    {
+        return true;
+    }
+    bool OnTxReady() final
+    {
+        return true;
+    }
+    bool OnLowerLayerUp() final
+    {
+        return true;
+    }
+    bool OnLowerLayerDown() final
+    {
+        return true;
+    }
+};
+
+std::vector<std::shared_ptr<ILinkSession>> CreateSessions(size_t num)
+{
+    std::vector<std::shared_ptr<ILinkSession>> sessions;
+    for (size_t i = 0; i < num; ++i)
+    {
+        sessions.push_back(std::make_shared<NullSession>());
+    }
+    return sessions;
+}
+
+Addresses RouteAddresses(size_t i)
+{
+    return Addresses(static_cast<uint16_t>(10 + i), 1);
+}
+} // namespace
+
+TEST_CASE(SUITE("EmptyTableFindsNothing"))
+{
+    RouteTable table;
+    NullSession session;
+
+    REQUIRE(table.Find(Addresses(1, 1024)) == nullptr);
+    REQUIRE(table.Find(&session) == nullptr);
+    REQUIRE_FALSE(table.Remove(&session));
+}
+
+TEST_CASE(SUITE("FindsRoutesByAddressesAndSession"))
+{
+    RouteTable table;
+    const auto sessions = CreateSessions(250);
+
+    for (size_t i = 0; i < sessions.size(); ++i)
+    {
+        REQUIRE(table.Add(sessions[i], RouteAddresses(i)));
+    }
+
+    REQUIRE(table.Size() == 250);
+
+    for (size_t i = 0; i < sessions.size(); ++i)
+    {
+        const auto route = table.Find(RouteAddresses(i));
+        REQUIRE(route != nullptr);
+        REQUIRE(route->session == sessions[i]);
+        REQUIRE(table.Find(sessions[i].get()) == route);
+    }
+
+    // the reverse direction is a different route
+    REQUIRE(table.Find(RouteAddresses(0).Reverse()) == nullptr);
+}
+
+TEST_CASE(SUITE("RejectsDuplicateAddressesOrSession"))
+{
+    RouteTable table;
+    const auto sessions = CreateSessions(2);
+
+    REQUIRE(table.Add(sessions[0], Addresses(1024, 1)));
+    REQUIRE_FALSE(table.Add(sessions[1], Addresses(1024, 1)));
+    REQUIRE_FALSE(table.Add(sessions[0], Addresses(1025, 1)));
+    REQUIRE(table.Size() == 1);
+}
+
+TEST_CASE(SUITE("RemovingKeepsOtherRoutesReachable"))
+{
+    RouteTable table;
+    const auto sessions = CreateSessions(100);
+
+    for (size_t i = 0; i < sessions.size(); ++i)
+    {
+        REQUIRE(table.Add(sessions[i], RouteAddresses(i)));
+    }
+
+    table.Find(RouteAddresses(99))->enabled = true;
+
+    // remove every even route, including the first and the ones moved into their places
+    for (size_t i = 0; i < sessions.size(); i += 2)
+    {
+        REQUIRE(table.Remove(sessions[i].get()));
+        REQUIRE_FALSE(table.Remove(sessions[i].get()));
+    }
+
+    REQUIRE(table.Size() == 50);
+
+    for (size_t i = 0; i < sessions.size(); ++i)
+    {
+        const auto route = table.Find(RouteAddresses(i));
+        if (i % 2 == 0)
+        {
+            REQUIRE(route == nullptr);
+            REQUIRE(table.Find(sessions[i].get()) == nullptr);
+        }
+        else
+        {
+            REQUIRE(route != nullptr);
+            REQUIRE(route->session == sessions[i]);
+            REQUIRE(table.Find(sessions[i].get()) == route);
+        }
+    }
+
+    // state travels with the route when it is moved
+    REQUIRE(table.Find(RouteAddresses(99))->enabled);
+}
+
+TEST_CASE(SUITE("RoutesCanBeReaddedAfterChurn"))
+{
+    RouteTable table;
+    const auto sessions = CreateSessions(64);
+
+    for (int round = 0; round < 10; ++round)
+    {
+        for (size_t i = 0; i < sessions.size(); ++i)
+        {
+            REQUIRE(table.Add(sessions[i], RouteAddresses(i)));
+        }
+
+        for (size_t i = 0; i < sessions.size(); ++i)
+        {
+            REQUIRE(table.Remove(sessions[(i * 7) % sessions.size()].get()));
+        }
+
+        REQUIRE(table.Size() == 0);
+    }
+
+    REQUIRE(table.Find(RouteAddresses(0)) == nullptr);
+}
+
+TEST_CASE(SUITE("ExhaustedMemoryResourceLeavesTableUnchanged"))
+{
+    const auto sessions = CreateSessions(200);
+
+    MemoryScope scope(MemoryAccount::Create(std::make_shared<MonotonicMemoryResource>(4096)));
+    RouteTable table;
+
+    size_t numAdded = 0;
+    try
+    {
+        for (; numAdded < sessions.size(); ++numAdded)
+        {
+            table.Add(sessions[numAdded], RouteAddresses(numAdded));
+        }
+    }
+    catch (const std::bad_alloc&)
+    {
+    }
+
+    REQUIRE(numAdded < sessions.size());
+    REQUIRE(table.Size() == numAdded);
+    REQUIRE(table.Find(sessions[numAdded].get()) == nullptr);
+
+    for (size_t i = 0; i < numAdded; ++i)
+    {
+        REQUIRE(table.Find(RouteAddresses(i)) != nullptr);
+        REQUIRE(table.Find(sessions[i].get()) != nullptr);
+    }
+
+    // removing makes room in the existing storage again
+    REQUIRE(table.Remove(sessions[0].get()));
+    REQUIRE(table.Add(sessions[numAdded], RouteAddresses(numAdded)));
+    REQUIRE(table.Find(RouteAddresses(numAdded))->session == sessions[numAdded]);
+}
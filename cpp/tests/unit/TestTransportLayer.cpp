@@ -136,6 +136,26 @@ TEST_CASE(SUITE("ReceiveLargestPossibleAPDU"))
     REQUIRE(test.upper.received.AsHex() == apdu); // check that the correct data was written
 }
 
+TEST_CASE(SUITE("ReceiveLargeAPDU"))
+{
+    const uint32_t MAX_RX_FRAG_SIZE = 65536;
+    TransportTestObject test(true, MAX_RX_FRAG_SIZE);
+
+    // spans several wraps of the 6-bit sequence number
+    uint32_t num_packets = CalcMaxPackets(MAX_RX_FRAG_SIZE, MAX_TPDU_PAYLOAD);
+    uint32_t last_packet_length = CalcLastPacketSize(MAX_RX_FRAG_SIZE, MAX_TPDU_PAYLOAD);
+
+    std::vector<std::string> packets;
+    const auto apdu = test.GeneratePacketSequence(packets, num_packets, last_packet_length);
+    for (const auto& s : packets)
+    {
+        test.link.SendUp(s);
+    }
+
+    REQUIRE(test.upper.received.AsHex() == apdu);
+    REQUIRE(test.transport.GetStatistics().rx.numTransportIgnore == 0);
+}
+
 TEST_CASE(SUITE("ReceiveBufferOverflow"))
 {
     TransportTestObject test(true, 4); // maximum ASDU size of 4
@@ -242,3 +262,53 @@ TEST_CASE(SUITE("SendFullAPDU"))
 
     test.transport.OnTxReady();
 }
+
+TEST_CASE(SUITE("Pooled reassembly buffer is only held while a fragment is in flight"))
+{
+    MockLogHandler log;
+    auto pool = std::make_shared<FragmentBufferPool>();
+    TransportRx rx(log.logger, DEFAULT_MAX_APDU_SIZE, pool);
+
+    StackStatistics::Memory idle;
+    rx.RecordMemory(idle);
+    REQUIRE(idle.numBufferBytes == 0);
+
+    HexSequence first("40 01 02"); // FIR, seq = 0
+    REQUIRE(rx.ProcessReceive(Message(Addresses(), first.ToRSeq())).payload.is_empty());
+    rx.ReleaseBuffer();
+    REQUIRE(pool->NumBorrowedBytes() == DEFAULT_MAX_APDU_SIZE);
+
+    StackStatistics::Memory assembling;
+    rx.RecordMemory(assembling);
+    REQUIRE(assembling.numBufferBytes == DEFAULT_MAX_APDU_SIZE);
+    REQUIRE(assembling.numPooledBufferBytes == DEFAULT_MAX_APDU_SIZE);
+
+    HexSequence last("81 03"); // FIN, seq = 1
+    const auto fragment = rx.ProcessReceive(Message(Addresses(), last.ToRSeq()));
+    REQUIRE(HexConversions::to_hex(fragment.payload) == "01 02 03");
+
+    rx.ReleaseBuffer();
+    REQUIRE(pool->NumBorrowedBytes() == 0);
+    REQUIRE(pool->NumRetainedBytes() == DEFAULT_MAX_APDU_SIZE);
+}
+
+TEST_CASE(SUITE("Single segment fragments are passed up without copying"))
+{
+    MockLogHandler log;
+    TransportRx rx(log.logger, DEFAULT_MAX_APDU_SIZE);
+
+    HexSequence segment("C0 01 02 03"); // FIR, FIN, seq = 0
+    const auto input = segment.ToRSeq();
+    const auto fragment = rx.ProcessReceive(Message(Addresses(), input));
+
+    REQUIRE(HexConversions::to_hex(fragment.payload) == "01 02 03");
+    REQUIRE(static_cast<const uint8_t*>(fragment.payload) == static_cast<const uint8_t*>(input) + 1);
+    REQUIRE(rx.Statistics().numTransportRx == 1);
+    REQUIRE(rx.Statistics().numTransportZeroCopyRx == 1);
+
+    HexSequence first("41 04"); // FIR, seq = 1
+    HexSequence last("82 05"); // FIN, seq = 2
+    REQUIRE(rx.ProcessReceive(Message(Addresses(), first.ToRSeq())).payload.is_empty());
+    REQUIRE(HexConversions::to_hex(rx.ProcessReceive(Message(Addresses(), last.ToRSeq())).payload) == "04 05");
+    REQUIRE(rx.Statistics().numTransportZeroCopyRx == 1);
+}
@@ -21,10 +21,67 @@
 
 #include <catch.hpp>
 
+#include <string>
+#include <vector>
+
 using namespace opendnp3;
 
 #define SUITE(name) "UpdateBuilderTestSuite - " name
 
+class RecordingUpdateHandler final : public IUpdateHandler
+{
+public:
+    bool Update(const Binary& meas, uint16_t index, EventMode mode) override
+    {
+        return Record("binary", index);
+    }
+    bool Update(const DoubleBitBinary& meas, uint16_t index, EventMode mode) override
+    {
+        return Record("double", index);
+    }
+    bool Update(const Analog& meas, uint16_t index, EventMode mode) override
+    {
+        return Record("analog", index);
+    }
+    bool Update(const Counter& meas, uint16_t index, EventMode mode) override
+    {
+        return Record("counter", index);
+    }
+    bool FreezeCounter(uint16_t index, bool clear, EventMode mode) override
+    {
+        return Record("freeze", index);
+    }
+    bool Update(const BinaryOutputStatus& meas, uint16_t index, EventMode mode) override
+    {
+        return Record("bos", index);
+    }
+    bool Update(const AnalogOutputStatus& meas, uint16_t index, EventMode mode) override
+    {
+        return Record("aos", index);
+    }
+    bool Update(const OctetString& meas, uint16_t index, EventMode mode) override
+    {
+        return Record("octet", index);
+    }
+    bool Update(const TimeAndInterval& meas, uint16_t index) override
+    {
+        return Record("tai", index);
+    }
+    bool Modify(FlagsType type, uint16_t start, uint16_t stop, uint8_t flags) override
+    {
+        return Record("modify", start);
+    }
+
+    std::vector<std::string> records;
+
+private:
+    bool Record(const std::string& type, uint16_t index)
+    {
+        records.push_back(type + std::to_string(index));
+        return true;
+    }
+};
+
 TEST_CASE(SUITE("builder is cleared after building"))
 {
     UpdateBuilder builder;
@@ -40,3 +97,38 @@ TEST_CASE(SUITE("builder is cleared after building"))
         REQUIRE(updates.IsEmpty());
     }
 }
+
+TEST_CASE(SUITE("updates are applied in the order they were added"))
+{
+    UpdateBuilder builder;
+    builder.Update(Counter(1), 3);
+    builder.Update(Binary(true), 1);
+    builder.FreezeCounter(3, false);
+    builder.Update(Counter(2), 4);
+    builder.Update(Analog(1.0), 0);
+    builder.Update(Binary(false), 2);
+
+    RecordingUpdateHandler handler;
+    builder.Build().Apply(handler);
+
+    REQUIRE(handler.records
+            == std::vector<std::string>{"counter3", "binary1", "freeze3", "counter4", "analog0", "binary2"});
+}
+
+TEST_CASE(SUITE("building again doesn't modify updates that are still in use"))
+{
+    UpdateBuilder builder;
+    builder.Update(Binary(true), 1);
+    const auto first = builder.Build();
+
+    for (uint16_t i = 0; i < 10; ++i)
+    {
+        builder.Update(Analog(1.0), i);
+        builder.Build();
+    }
+
+    RecordingUpdateHandler handler;
+    first.Apply(handler);
+
+    REQUIRE(handler.records == std::vector<std::string>{"binary1"});
+}
@@ -43,6 +43,7 @@ MasterTestFixture::MasterTestFixture(const MasterParams& params,
     : addresses(addresses),
       log(log),
       exe(executor ? executor : std::make_shared<exe4cpp::MockExecutor>()),
+      decodeExe(std::make_shared<exe4cpp::MockExecutor>()),
       meas(std::make_shared<MockSOEHandler>()),
       lower(std::make_shared<MockLowerLayer>()),
       application(std::make_shared<MockMasterApplication>()),
@@ -54,7 +55,9 @@ MasterTestFixture::MasterTestFixture(const MasterParams& params,
                                          meas,
                                          application,
                                          this->scheduler,
-                                         params))
+                                         params,
+                                         nullptr,
+                                         decodeExe))
 {
 }
 
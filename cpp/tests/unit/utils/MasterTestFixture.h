@@ -51,6 +51,8 @@ public:
 
     const std::shared_ptr<opendnp3::ILogHandler> log;
     const std::shared_ptr<exe4cpp::MockExecutor> exe;
+    // only used when the params set decodeOnThreadPool
+    const std::shared_ptr<exe4cpp::MockExecutor> decodeExe;
     const std::shared_ptr<MockSOEHandler> meas;
     const std::shared_ptr<MockLowerLayer> lower;
     const std::shared_ptr<MockMasterApplication> application;
@@ -23,12 +23,14 @@
 
 using namespace opendnp3;
 
-OutstationTestObject::OutstationTestObject(const OutstationConfig& config, const opendnp3::DatabaseConfig& db_config)
+OutstationTestObject::OutstationTestObject(const OutstationConfig& config,
+                                           const opendnp3::DatabaseConfig& db_config,
+                                           const std::shared_ptr<MockAsyncCommandHandler>& asyncCmdHandler)
     : exe(std::make_shared<exe4cpp::MockExecutor>()),
       lower(std::make_shared<MockLowerLayer>()),
       cmdHandler(std::make_shared<MockCommandHandler>(CommandStatus::SUCCESS)),
       application(std::make_shared<MockOutstationApplication>()),
-      context(Addresses(), config, db_config, log.logger, exe, lower, cmdHandler, application)
+      context(Addresses(), config, db_config, log.logger, exe, lower, cmdHandler, application, nullptr, asyncCmdHandler)
 {
     lower->SetUpperLayer(context);
 }
@@ -85,3 +87,8 @@ size_t OutstationTestObject::AdvanceTime(const TimeDuration& td)
     exe->advance_time(td.value);
     return exe->run_many();
 }
+
+size_t OutstationTestObject::RunPending()
+{
+    return exe->run_many();
+}
@@ -24,6 +24,7 @@
 
 #include <exe4cpp/MockExecutor.h>
 
+#include "dnp3mocks/MockAsyncCommandHandler.h"
 #include "dnp3mocks/MockCommandHandler.h"
 #include "dnp3mocks/MockLogHandler.h"
 #include "dnp3mocks/MockLowerLayer.h"
@@ -40,7 +41,8 @@ class OutstationTestObject
 
 public:
     OutstationTestObject(const opendnp3::OutstationConfig& config,
-                         const opendnp3::DatabaseConfig& db_config = opendnp3::DatabaseConfig());
+                         const opendnp3::DatabaseConfig& db_config = opendnp3::DatabaseConfig(),
+                         const std::shared_ptr<MockAsyncCommandHandler>& asyncCmdHandler = nullptr);
 
     size_t SendToOutstation(const std::string& hex);
 
@@ -58,6 +60,8 @@ public:
 
     size_t AdvanceTime(const opendnp3::TimeDuration& td);
 
+    size_t RunPending();
+
     MockLogHandler log;
 
     void Transaction(const std::function<void(opendnp3::IUpdateHandler&)>& apply)
@@ -0,0 +1,17 @@
+include(FetchContent)
+
+FetchContent_Declare(
+    benchmark
+    GIT_REPOSITORY https://github.com/google/benchmark.git
+    GIT_TAG        d572f4777349d43653b21d6c2fc63020ab326db2 # v1.7.1
+)
+
+FetchContent_GetProperties(benchmark)
+if(NOT benchmark_POPULATED)
+    FetchContent_Populate(benchmark)
+
+    set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "Don't build the tests of the benchmark library" FORCE)
+    set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "Don't install the benchmark library" FORCE)
+    set(BENCHMARK_ENABLE_WERROR OFF CACHE BOOL "Don't fail the build on warnings in the benchmark library" FORCE)
+    add_subdirectory(${benchmark_SOURCE_DIR} ${benchmark_BINARY_DIR} EXCLUDE_FROM_ALL)
+endif()